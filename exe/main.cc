@@ -1,11 +1,193 @@
 #include <puppet/compiler/settings.hpp>
 #include <puppet/compiler/node.hpp>
+#include <puppet/compiler/process_pool.hpp>
+#include <puppet/compiler/scheduler.hpp>
+#include <puppet/compiler/server.hpp>
 #include <puppet/facts/yaml.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <limits>
 
 using namespace std;
 using namespace puppet::logging;
 using namespace puppet::facts;
 namespace compiler = puppet::compiler;
+namespace runtime = puppet::runtime;
+namespace fs = boost::filesystem;
+namespace sys = boost::system;
+
+static void write_catalog(logger& logger, runtime::catalog const& catalog, compiler::node const& node, string const& environment, string const& path)
+{
+    ofstream file(path, ios::trunc);
+    if (file) {
+        catalog.write(file, node.name(), environment);
+    }
+    if (!file) {
+        LOG(error, "node '%1%': failed to write catalog to '%2%'.", node.name(), path);
+        return;
+    }
+    LOG(info, "wrote catalog for node '%1%' to '%2%'.", node.name(), path);
+}
+
+static bool compile_node(logger& logger, compiler::settings const& settings, compiler::environment& environment, fs::path const& facts_file)
+{
+    try {
+        auto facts = make_shared<yaml>(facts_file.string());
+        auto name = facts->node_name();
+        if (name.empty()) {
+            name = facts_file.stem().string();
+        }
+
+        // The catalog file is named after the node, so a name from the facts must not lead outside of the output directory
+        if (name.find_first_of("/\\") != string::npos || name.find("..") != string::npos) {
+            LOG(error, "node '%1%' from facts file '%2%': node names cannot contain path separators or '..'.", name, facts_file.string());
+            return false;
+        }
+
+        compiler::node node(name, environment, facts);
+        try {
+            LOG(notice, "compiling for node '%1%' with environment '%2%'.", node.name(), settings.environment());
+            auto catalog = node.compile(logger, settings);
+            write_catalog(logger, catalog, node, settings.environment(), (fs::path(settings.output_file()) / (node.name() + ".json")).string());
+            return true;
+        } catch (compiler::compilation_exception const& ex) {
+            LOG(error, ex.line(), ex.column(), ex.text(), ex.path(), "node '%1%': %2%", node.name(), ex.what());
+        }
+    } catch (yaml_parse_exception const& ex) {
+        LOG(error, ex.line(), ex.column(), ex.text(), ex.path(), ex.what());
+    }
+    return false;
+}
+
+static void compile_batch(logger& logger, compiler::settings const& settings, compiler::environment& environment)
+{
+    typedef chrono::steady_clock clock;
+
+    // Sort the facts files so that the output is the same on every run
+    vector<fs::path> files;
+    sys::error_code ec;
+    for (fs::directory_iterator it(settings.batch_directory(), ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() == ".yaml" && fs::is_regular_file(it->status())) {
+            files.emplace_back(it->path());
+        }
+    }
+    sort(files.begin(), files.end());
+
+    if (files.empty()) {
+        LOG(warning, "no YAML facts files were found in batch directory '%1%'.", settings.batch_directory());
+        return;
+    }
+
+    fs::create_directories(settings.output_file(), ec);
+    if (ec) {
+        LOG(error, "failed to create output directory '%1%': %2%.", settings.output_file(), ec.message());
+        return;
+    }
+
+    auto to_seconds = [](clock::duration duration) { return chrono::duration<double>(duration).count(); };
+
+    // Each job writes only its own result, so the results need no locking
+    struct result
+    {
+        bool compiled = false;
+        double time = 0;
+    };
+    vector<result> results(files.size());
+    auto batch_start = clock::now();
+
+    if (settings.fork_workers()) {
+        // Parse every manifest before forking so that the workers share the parsed manifests copy-on-write
+        compiler::node preloader("preload", environment, nullptr);
+        auto manifests = preloader.preload(logger, settings);
+        LOG(info, "preloaded %1% %2% in %3$.3f seconds.", manifests, (manifests != 1 ? "manifests" : "manifest"), to_seconds(clock::now() - batch_start));
+
+        compiler::process_pool pool(settings.jobs());
+        LOG(debug, "compiling %1% nodes with %2% worker processes.", files.size(), min(pool.workers(), files.size()));
+
+        auto pool_results = pool.run(logger, files.size(), [&](size_t index, size_t) {
+            // Buffer each node's messages so they are written together rather than interleaved with other workers'
+            buffered_logger node_logger(logger);
+            auto compiled = compile_node(node_logger, settings, environment, files[index]);
+            node_logger.flush();
+            return compiled;
+        });
+        for (size_t i = 0; i < results.size(); ++i) {
+            results[i].compiled = pool_results.jobs[i].completed && pool_results.jobs[i].succeeded;
+            results[i].time = pool_results.jobs[i].seconds;
+        }
+        for (size_t i = 0; i < pool_results.workers.size(); ++i) {
+            auto const& worker = pool_results.workers[i];
+            if (!worker.exited) {
+                continue;
+            }
+            LOG(notice, "worker %1%: compiled %2% %3% (%4% failed) in %5$.3f seconds (%6$.1f nodes per second); peak RSS %7% KiB, %8% KiB not shared.",
+                i,
+                worker.jobs,
+                (worker.jobs != 1 ? "nodes" : "node"),
+                worker.failed,
+                worker.seconds,
+                worker.seconds > 0 ? worker.jobs / worker.seconds : 0.0,
+                worker.peak_resident,
+                worker.private_resident
+            );
+        }
+    } else {
+        // Every node shares the environment, so each manifest is parsed once for the whole batch
+        compiler::scheduler scheduler(settings.jobs());
+        LOG(debug, "compiling %1% nodes with %2% workers.", files.size(), min(scheduler.workers(), files.size()));
+
+        scheduler.run(files.size(), [&](size_t index, size_t) {
+            // Buffer each node's messages so they are not interleaved with those of nodes compiling on other threads
+            buffered_logger node_logger(logger);
+            auto start = clock::now();
+            results[index].compiled = compile_node(node_logger, settings, environment, files[index]);
+            results[index].time = to_seconds(clock::now() - start);
+            node_logger.flush();
+        });
+    }
+
+    auto wall = to_seconds(clock::now() - batch_start);
+    auto nodes = files.size();
+    size_t succeeded = 0;
+    double total = 0;
+    auto fastest = numeric_limits<double>::max();
+    double slowest = 0;
+    for (auto const& result : results) {
+        succeeded += result.compiled ? 1 : 0;
+        total += result.time;
+        fastest = min(fastest, result.time);
+        slowest = max(slowest, result.time);
+    }
+
+    LOG(notice, "compiled %1% of %2% %3% (%4% failed) in %5$.3f seconds (%6$.1f nodes per second).",
+        succeeded,
+        nodes,
+        (nodes != 1 ? "nodes" : "node"),
+        nodes - succeeded,
+        wall,
+        wall > 0 ? nodes / wall : 0.0
+    );
+    LOG(notice, "per-node compilation time: mean %1$.3f seconds, min %2$.3f seconds, max %3$.3f seconds.",
+        total / nodes,
+        fastest,
+        slowest
+    );
+}
+
+// Only a lock-free atomic may be set from a signal handler; the server polls it between requests
+static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "expected lock-free atomic booleans.");
+static atomic<bool> interrupted(false);
+
+static void interrupt_server(int)
+{
+    interrupted = true;
+}
 
 int main(int argc, char const* argv[])
 {
@@ -32,29 +214,49 @@ int main(int argc, char const* argv[])
             LOG(debug, "using directory '%1%' to search for global modules.", directory);
         }
 
-        // Construct an environment
-        compiler::environment environment(settings.environment(), settings.environment_directory());
-
-        // Construct a node
-        compiler::node node(settings.node_name(), environment);
-
         // TODO: remove this check
         if (settings.manifests().empty()) {
             throw compiler::settings_exception("expected at least one manifest to compile (default manifest file not yet implemented).");
         }
 
-        try {
-            LOG(notice, "compiling for node '%1%' with environment '%2%'.", settings.node_name(), settings.environment());
+        if (!settings.server_socket().empty()) {
+            // Serve requests until interrupted
+            // Don't restart system calls so that a worker waiting for a connection sees the flag immediately
+            struct sigaction action;
+            memset(&action, 0, sizeof(action));
+            action.sa_handler = interrupt_server;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = 0;
+            sigaction(SIGINT, &action, nullptr);
+            sigaction(SIGTERM, &action, nullptr);
 
-            // Compile the manifest
-            auto catalog = node.compile(logger, settings);
+            compiler::server server(logger, settings);
+            server.run(&interrupted);
+        } else {
+            // Construct an environment
+            compiler::environment environment(settings.environment(), settings.environment_directory(), settings.module_directories(), settings.cache_directory());
 
-            // TODO: output the catalog
-        } catch (compiler::compilation_exception const& ex) {
-            LOG(error, ex.line(), ex.column(), ex.text(), ex.path(), "node '%1%': %2%", node.name(), ex.what());
+            if (!settings.batch_directory().empty()) {
+                compile_batch(logger, settings, environment);
+            } else {
+                // Construct a node
+                compiler::node node(settings.node_name(), environment, settings.facts());
+
+                try {
+                    LOG(notice, "compiling for node '%1%' with environment '%2%'.", settings.node_name(), settings.environment());
+
+                    // Compile the manifest and write the catalog
+                    auto catalog = node.compile(logger, settings);
+                    write_catalog(logger, catalog, node, settings.environment(), settings.output_file());
+                } catch (compiler::compilation_exception const& ex) {
+                    LOG(error, ex.line(), ex.column(), ex.text(), ex.path(), "node '%1%': %2%", node.name(), ex.what());
+                }
+            }
         }
     } catch (yaml_parse_exception const& ex) {
         LOG(error, ex.line(), ex.column(), ex.text(), ex.path(), ex.what());
+    } catch (compiler::server_exception const& ex) {
+        LOG(error, "%1%", ex.what());
     } catch (compiler::settings_exception const& ex) {
         LOG(error, "%1%", ex.what());
         LOG(notice, "use 'puppetcpp --help' for help.");
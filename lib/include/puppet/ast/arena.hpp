@@ -0,0 +1,149 @@
+/**
+ * @file
+ * Declares the AST node arena.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace puppet { namespace ast {
+
+    /**
+     * Represents a bump-pointer arena that owns the storage of recursively wrapped AST nodes.
+     * Storage is released all at once when the arena is destroyed; the nodes themselves must be destroyed first.
+     */
+    struct arena
+    {
+        /**
+         * Constructs an empty arena.
+         */
+        arena();
+
+        /**
+         * Destructs the arena and releases all of its storage.
+         */
+        ~arena();
+
+        /**
+         * Arenas cannot be copied.
+         */
+        arena(arena const&) = delete;
+
+        /**
+         * Arenas cannot be copied.
+         * @return Returns this arena.
+         */
+        arena& operator=(arena const&) = delete;
+
+        /**
+         * Allocates storage from the arena.
+         * The storage is suitably aligned for any type.
+         * @param size The number of bytes to allocate.
+         * @return Returns a pointer to the allocated storage.
+         */
+        void* allocate(std::size_t size);
+
+        /**
+         * Gets the number of allocations made from the arena.
+         * @return Returns the number of allocations made from the arena.
+         */
+        std::size_t allocations() const;
+
+        /**
+         * Gets the number of bytes allocated from the arena.
+         * @return Returns the number of bytes allocated from the arena.
+         */
+        std::size_t bytes() const;
+
+        /**
+         * Gets the arena that AST nodes are currently allocated from on the calling thread.
+         * @return Returns the current arena or nullptr if AST nodes are allocated from the heap.
+         */
+        static arena* current();
+
+     private:
+        friend struct arena_scope;
+
+        std::vector<std::unique_ptr<char[]>> _blocks;
+        char* _next;
+        char* _end;
+        std::size_t _allocations;
+        std::size_t _bytes;
+    };
+
+    /**
+     * Makes an arena the current arena for the calling thread until the scope is destroyed.
+     */
+    struct arena_scope
+    {
+        /**
+         * Constructs an arena scope.
+         * @param arena The arena to allocate AST nodes from while the scope exists.
+         */
+        explicit arena_scope(ast::arena& arena);
+
+        /**
+         * Destructs the arena scope and restores the previous arena.
+         */
+        ~arena_scope();
+
+        /**
+         * Arena scopes cannot be copied.
+         */
+        arena_scope(arena_scope const&) = delete;
+
+        /**
+         * Arena scopes cannot be copied.
+         * @return Returns this arena scope.
+         */
+        arena_scope& operator=(arena_scope const&) = delete;
+
+     private:
+        ast::arena* _previous;
+    };
+
+    /**
+     * Base type for AST nodes that are held in a boost::recursive_wrapper.
+     * The wrapper allocates each node with new; this routes those allocations to the current arena, if any.
+     */
+    struct arena_allocated
+    {
+        /**
+         * Allocates storage for an AST node.
+         * @param size The size of the node.
+         * @return Returns the storage for the node.
+         */
+        static void* operator new(std::size_t size);
+
+        /**
+         * Deallocates storage for an AST node.
+         * Storage allocated from an arena is released when the arena is destroyed.
+         * @param ptr The storage to deallocate.
+         */
+        static void operator delete(void* ptr);
+
+        /**
+         * Constructs an AST node in existing storage.
+         * Required because declaring operator new hides the global placement form used by boost::variant.
+         * @param size The size of the node.
+         * @param ptr The storage to construct the node in.
+         * @return Returns the given storage.
+         */
+        static void* operator new(std::size_t size, void* ptr)
+        {
+            return ptr;
+        }
+
+        /**
+         * Matching deallocation for placement construction; does nothing.
+         * @param ptr The storage the node was constructed in.
+         * @param place The storage the node was constructed in.
+         */
+        static void operator delete(void* ptr, void* place)
+        {
+        }
+    };
+
+}}  // namespace puppet::ast
@@ -15,7 +15,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST array.
      */
-    struct array
+    struct array : arena_allocated
     {
         /**
          * Default constructor for array.
@@ -21,6 +21,13 @@ namespace puppet { namespace ast {
          */
         bare_word() = default;
 
+        /**
+         * Constructs a bare word with the given position and value.
+         * @param position The position of the bare word.
+         * @param value The value of the bare word.
+         */
+        bare_word(lexer::position position, std::string value);
+
         /**
          * Constructs a bare word from a token.
          * @tparam Iterator The underlying iterator type for the token.
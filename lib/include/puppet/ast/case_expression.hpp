@@ -62,7 +62,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST case expression.
      */
-    struct case_expression
+    struct case_expression : arena_allocated
     {
         /**
          * Default constructor for case_expression.
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "expression.hpp"
+#include "deferred_body.hpp"
 #include "parameter.hpp"
 #include <vector>
 #include <iostream>
@@ -14,7 +15,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST class definition expression.
      */
-    struct class_definition_expression
+    struct class_definition_expression : arena_allocated
     {
         /**
          * Default constructor for class_definition_expression.
@@ -31,6 +32,16 @@ namespace puppet { namespace ast {
          */
         class_definition_expression(lexer::position position, ast::name name, boost::optional<std::vector<parameter>> parameters, boost::optional<ast::name> parent, boost::optional<std::vector<expression>> body);
 
+        /**
+         * Constructs a class definition expression whose body has not been parsed.
+         * @param position The position of the expression.
+         * @param name The name of the class.
+         * @param parameters The optional class parameters.
+         * @param parent The optional parent name.
+         * @param body The range of the body in the source.
+         */
+        class_definition_expression(lexer::position position, ast::name name, boost::optional<std::vector<parameter>> parameters, boost::optional<ast::name> parent, ast::deferred_body body);
+
         /**
          * Gets the name of the class.
          * @return Returns the name of the class.
@@ -55,6 +66,26 @@ namespace puppet { namespace ast {
          */
         boost::optional<std::vector<expression>> const& body() const;
 
+        /**
+         * Sets the body expressions of a class whose body was deferred.
+         * The body is parsed when first needed, so it can be set on a syntax tree that is otherwise immutable.
+         * @param body The body expressions.
+         */
+        void body(boost::optional<std::vector<expression>> body) const;
+
+        /**
+         * Gets the range of the body if the body has not been parsed.
+         * @return Returns the range of the body or none if the body has been parsed.
+         */
+        boost::optional<ast::deferred_body> const& deferred_body() const;
+
+        /**
+         * Determines if the body has been parsed.
+         * This can be called without holding a lock; when it returns true, the parsed body is visible to the calling thread.
+         * @return Returns true if the body has been parsed or false if parsing it was deferred and has not happened yet.
+         */
+        bool body_parsed() const;
+
         /**
          * Gets the position of the expression.
          * @return Returns the position of the expression.
@@ -66,7 +97,9 @@ namespace puppet { namespace ast {
         ast::name _name;
         boost::optional<std::vector<parameter>> _parameters;
         boost::optional<ast::name> _parent;
-        boost::optional<std::vector<expression>> _body;
+        mutable boost::optional<std::vector<expression>> _body;
+        mutable boost::optional<ast::deferred_body> _deferred_body;
+        mutable ast::parsed_flag _parsed;
     };
 
     /**
@@ -196,7 +196,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST collection expression.
      */
-    struct collection_expression
+    struct collection_expression : arena_allocated
     {
         /**
          * Default constructor for collection_expression.
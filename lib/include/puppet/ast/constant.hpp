@@ -0,0 +1,32 @@
+/**
+ * @file
+ * Declares the AST constant.
+ */
+#pragma once
+
+#include "../runtime/values/value.hpp"
+
+namespace puppet { namespace ast {
+
+    /**
+     * Represents the value of a constant expression, computed once after parsing.
+     */
+    struct constant
+    {
+        /**
+         * Constructs a constant.
+         * @param value The value of the constant.
+         */
+        explicit constant(runtime::values::value value);
+
+        /**
+         * Gets the value of the constant.
+         * @return Returns the value of the constant.
+         */
+        runtime::values::value const& value() const;
+
+     private:
+        runtime::values::value _value;
+    };
+
+}}  // namespace puppet::ast
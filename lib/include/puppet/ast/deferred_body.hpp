@@ -0,0 +1,96 @@
+/**
+ * @file
+ * Declares the AST deferred body.
+ */
+#pragma once
+
+#include "../lexer/position.hpp"
+#include <atomic>
+#include <iostream>
+
+namespace puppet { namespace ast {
+
+    /**
+     * Represents the source range of a class, defined type, or node definition body that has not been parsed.
+     * The body is parsed from the source when it is first evaluated.
+     */
+    struct deferred_body
+    {
+        /**
+         * Default constructor for deferred_body.
+         */
+        deferred_body() = default;
+
+        /**
+         * Constructs a deferred body with the given range.
+         * @param begin The position of the body's opening brace.
+         * @param end The position of the body's closing brace.
+         */
+        deferred_body(lexer::position begin, lexer::position end);
+
+        /**
+         * Gets the position of the body's opening brace.
+         * @return Returns the position of the body's opening brace.
+         */
+        lexer::position const& begin() const;
+
+        /**
+         * Gets the position of the body's closing brace.
+         * @return Returns the position of the body's closing brace.
+         */
+        lexer::position const& end() const;
+
+     private:
+        lexer::position _begin;
+        lexer::position _end;
+    };
+
+    /**
+     * Represents whether the body of a definition has been parsed.
+     * Once the flag is set, the parsed body is visible to any thread that sees the flag set, so the flag can be checked without a lock.
+     */
+    struct parsed_flag
+    {
+        /**
+         * Constructs a parsed flag.
+         * @param parsed True if the body has already been parsed or false if parsing it was deferred.
+         */
+        explicit parsed_flag(bool parsed = true);
+
+        /**
+         * Copies a parsed flag.
+         * @param other The flag to copy.
+         */
+        parsed_flag(parsed_flag const& other);
+
+        /**
+         * Copies a parsed flag.
+         * @param other The flag to copy.
+         * @return Returns this flag.
+         */
+        parsed_flag& operator=(parsed_flag const& other);
+
+        /**
+         * Determines if the body has been parsed.
+         * @return Returns true if the body has been parsed and is visible to the calling thread or false if it has not been parsed.
+         */
+        bool get() const;
+
+        /**
+         * Sets the flag after the body has been parsed, publishing the body to other threads.
+         */
+        void set();
+
+     private:
+        std::atomic<bool> _parsed;
+    };
+
+    /**
+     * Stream insertion operator for AST deferred body.
+     * @param os The output stream to write the deferred body to.
+     * @param body The deferred body to write.
+     * @return Returns the given output stream.
+     */
+    std::ostream& operator<<(std::ostream& os, deferred_body const& body);
+
+}}  // namespace puppet::ast
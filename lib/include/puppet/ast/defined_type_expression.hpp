@@ -5,6 +5,7 @@
 #pragma once
 
 #include "expression.hpp"
+#include "deferred_body.hpp"
 #include "parameter.hpp"
 #include <vector>
 #include <iostream>
@@ -14,7 +15,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST defined type expression.
      */
-    struct defined_type_expression
+    struct defined_type_expression : arena_allocated
     {
         /**
          * Default constructor for defined_type_expression.
@@ -30,6 +31,15 @@ namespace puppet { namespace ast {
          */
         defined_type_expression(lexer::position position, ast::name name, boost::optional<std::vector<parameter>> parameters, boost::optional<std::vector<expression>> body);
 
+        /**
+         * Constructs a defined type expression whose body has not been parsed.
+         * @param position The position of the expression.
+         * @param name The name of the type.
+         * @param parameters The optional type parameters.
+         * @param body The range of the body in the source.
+         */
+        defined_type_expression(lexer::position position, ast::name name, boost::optional<std::vector<parameter>> parameters, ast::deferred_body body);
+
         /**
          * Gets the name of the type.
          * @return Returns the name of the type.
@@ -48,6 +58,26 @@ namespace puppet { namespace ast {
          */
         boost::optional<std::vector<expression>> const& body() const;
 
+        /**
+         * Sets the body expressions of a defined type whose body was deferred.
+         * The body is parsed when first needed, so it can be set on a syntax tree that is otherwise immutable.
+         * @param body The body expressions.
+         */
+        void body(boost::optional<std::vector<expression>> body) const;
+
+        /**
+         * Gets the range of the body if the body has not been parsed.
+         * @return Returns the range of the body or none if the body has been parsed.
+         */
+        boost::optional<ast::deferred_body> const& deferred_body() const;
+
+        /**
+         * Determines if the body has been parsed.
+         * This can be called without holding a lock; when it returns true, the parsed body is visible to the calling thread.
+         * @return Returns true if the body has been parsed or false if parsing it was deferred and has not happened yet.
+         */
+        bool body_parsed() const;
+
         /**
          * Gets the position of the expression.
          * @return Returns the position of the expression.
@@ -58,7 +88,9 @@ namespace puppet { namespace ast {
         lexer::position _position;
         ast::name _name;
         boost::optional<std::vector<parameter>> _parameters;
-        boost::optional<std::vector<expression>> _body;
+        mutable boost::optional<std::vector<expression>> _body;
+        mutable boost::optional<ast::deferred_body> _deferred_body;
+        mutable ast::parsed_flag _parsed;
     };
 
     /**
@@ -14,10 +14,13 @@
 #include "type.hpp"
 #include "name.hpp"
 #include "bare_word.hpp"
+#include "arena.hpp"
 #include <boost/variant.hpp>
 #include <iostream>
 #include <vector>
 #include <functional>
+#include <memory>
+#include <cstdint>
 
 namespace puppet { namespace ast {
 
@@ -42,6 +45,9 @@ namespace puppet { namespace ast {
     struct postfix_expression;
     struct expression;
 
+    // Forward declaration of constant
+    struct constant;
+
     /**
      * Represents a basic expression.
      */
@@ -143,7 +149,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST unary expression.
      */
-    struct unary_expression
+    struct unary_expression : arena_allocated
     {
         /**
          * Default constructor for unary expression.
@@ -301,6 +307,20 @@ namespace puppet { namespace ast {
      */
     std::ostream& operator<<(std::ostream& os, binary_operator op);
 
+    /**
+     * Gets the precedence of a binary operator.
+     * @param op The binary operator.
+     * @return Returns the precedence of the operator (higher values bind tighter).
+     */
+    std::uint8_t get_precedence(binary_operator op);
+
+    /**
+     * Determines if a binary operator is right associative.
+     * @param op The binary operator.
+     * @return Returns true if the operator is right associative or false if it is left associative.
+     */
+    bool is_right_associative(binary_operator op);
+
     /**
      * Represents an AST binary expression.
      */
@@ -330,6 +350,19 @@ namespace puppet { namespace ast {
          */
         primary_expression const& operand() const;
 
+        /**
+         * Gets the constant the right-hand operand was folded into.
+         * @return Returns the constant value of the operand or nullptr if the operand is not constant.
+         */
+        std::shared_ptr<ast::constant const> const& constant() const;
+
+        /**
+         * Folds the right-hand operand into a constant.
+         * The constant caches the value of the operand, so it can be set on a syntax tree that is otherwise immutable.
+         * @param constant The constant value of the operand.
+         */
+        void fold(std::shared_ptr<ast::constant const> constant) const;
+
         /**
          * Gets the position of the binary expression.
          * @return Returns the position of the binary expression.
@@ -339,6 +372,7 @@ namespace puppet { namespace ast {
      private:
         binary_operator _op;
         primary_expression _operand;
+        mutable std::shared_ptr<ast::constant const> _constant;
     };
 
     /**
@@ -352,7 +386,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST expression.
      */
-    struct expression
+    struct expression : arena_allocated
     {
         /**
          * Default constructor for expression.
@@ -378,6 +412,29 @@ namespace puppet { namespace ast {
          */
         std::vector<binary_expression> const& binary() const;
 
+        /**
+         * Gets the end of the right-hand operand of a binary expression.
+         * The right-hand operand of the binary expression at the given index is its primary operand followed by
+         * the binary expressions in the range [index + 1, operand_end(index)).
+         * The ranges are resolved from operator precedence and associativity when the expression is constructed.
+         * @param index The index of the binary expression.
+         * @return Returns the index one past the last binary expression belonging to the right-hand operand.
+         */
+        std::size_t operand_end(std::size_t index) const;
+
+        /**
+         * Gets the constant the expression was folded into.
+         * @return Returns the constant value of the expression or nullptr if the expression is not constant.
+         */
+        std::shared_ptr<ast::constant const> const& constant() const;
+
+        /**
+         * Folds the expression into a constant.
+         * The constant caches the value of the expression, so it can be set on a syntax tree that is otherwise immutable.
+         * @param constant The constant value of the expression.
+         */
+        void fold(std::shared_ptr<ast::constant const> constant) const;
+
         /**
          * Gets the position of the expression.
          * @return Returns the position of the expression.
@@ -393,6 +450,8 @@ namespace puppet { namespace ast {
      private:
         primary_expression _primary;
         std::vector<binary_expression> _binary;
+        std::vector<std::size_t> _operand_ends;
+        mutable std::shared_ptr<ast::constant const> _constant;
     };
 
     /**
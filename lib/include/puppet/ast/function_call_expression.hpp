@@ -16,7 +16,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST function call expression.
     */
-    struct function_call_expression
+    struct function_call_expression : arena_allocated
     {
         /**
          * Default constructor for function_call_expression.
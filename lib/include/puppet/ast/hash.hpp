@@ -28,7 +28,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST hash.
      */
-    struct hash
+    struct hash : arena_allocated
     {
         /**
          * Default constructor for hash.
@@ -106,7 +106,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST "if" expression.
      */
-    struct if_expression
+    struct if_expression : arena_allocated
     {
         /**
          * Default constructor for if_expression.
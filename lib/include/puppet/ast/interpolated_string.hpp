@@ -0,0 +1,62 @@
+/**
+ * @file
+ * Declares the AST interpolated string.
+ */
+#pragma once
+
+#include "expression.hpp"
+#include "../lexer/position.hpp"
+#include <boost/variant.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace puppet { namespace ast {
+
+    /**
+     * Represents a string that has been compiled for interpolation.
+     * Escape sequences and heredoc margins have already been applied to the literal segments.
+     */
+    struct interpolated_string
+    {
+        /**
+         * Represents a segment of the string: either literal text or the expressions of an interpolation.
+         * The value of an interpolation is the value of its last expression.
+         */
+        typedef boost::variant<std::string, std::vector<expression>> segment;
+
+        /**
+         * Represents a warning found when compiling the string.
+         */
+        typedef std::pair<lexer::position, std::string> warning;
+
+        /**
+         * Default constructor for interpolated_string.
+         */
+        interpolated_string();
+
+        /**
+         * Constructs an interpolated string from its parts.
+         * @param segments The segments of the string.
+         * @param warnings The warnings found when compiling the string.
+         */
+        interpolated_string(std::vector<segment> segments, std::vector<warning> warnings);
+
+        /**
+         * Gets the segments of the string.
+         * @return Returns the segments of the string.
+         */
+        std::vector<segment> const& segments() const;
+
+        /**
+         * Gets the warnings found when compiling the string.
+         * @return Returns the warnings found when compiling the string.
+         */
+        std::vector<warning> const& warnings() const;
+
+     private:
+        std::vector<segment> _segments;
+        std::vector<warning> _warnings;
+    };
+
+}}  // namespace puppet::ast
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../lexer/position.hpp"
+#include "../symbol.hpp"
 #include <boost/range.hpp>
 #include <iostream>
 #include <string>
@@ -36,7 +37,7 @@ namespace puppet { namespace ast {
         template <typename Iterator>
         explicit name(boost::iterator_range<Iterator> const& token) :
             _position(token.begin().position()),
-            _value(token.begin(), token.end())
+            _value(std::string(token.begin(), token.end()))
         {
         }
 
@@ -46,6 +47,12 @@ namespace puppet { namespace ast {
          */
         std::string const& value() const;
 
+        /**
+         * Gets the interned symbol for the name.
+         * @return Returns the interned symbol for the name.
+         */
+        puppet::symbol const& symbol() const;
+
         /**
          * Gets the position of the name.
          * @return Returns the position of the name.
@@ -54,7 +61,7 @@ namespace puppet { namespace ast {
 
     private:
         lexer::position _position;
-        std::string _value;
+        puppet::symbol _value;
     };
 
     /**
@@ -90,7 +97,7 @@ namespace std
         /**
          * The result type of the hash.
          */
-        typedef std::hash<std::string>::result_type result_type;
+        typedef std::hash<puppet::symbol>::result_type result_type;
 
         /**
          * Responsible for hashing the argument.
@@ -99,8 +106,8 @@ namespace std
          */
         result_type operator()(argument_type const& arg) const
         {
-            std::hash<std::string> hasher;
-            return hasher(arg.value());
+            std::hash<puppet::symbol> hasher;
+            return hasher(arg.symbol());
         }
     };
 }
@@ -6,6 +6,7 @@
 
 #include "../lexer/position.hpp"
 #include "expression.hpp"
+#include "deferred_body.hpp"
 #include <boost/optional.hpp>
 #include <iostream>
 #include <string>
@@ -46,6 +47,14 @@ namespace puppet { namespace ast {
          */
         explicit hostname(ast::regex const& name);
 
+        /**
+         * Constructs a hostname from its parts.
+         * @param position The position of the hostname.
+         * @param value The value of the hostname (empty for the default hostname).
+         * @param regex True if the hostname is a regex or false if not.
+         */
+        hostname(lexer::position position, std::string value, bool regex);
+
         /**
          * Gets the value of the hostname.
          * @return Returns the value of the hostname.
@@ -87,7 +96,7 @@ namespace puppet { namespace ast {
     /**
      * Represents the AST node definition expression.
      */
-    struct node_definition_expression
+    struct node_definition_expression : arena_allocated
     {
         /**
          * Default constructor for node_definition_expression.
@@ -102,6 +111,14 @@ namespace puppet { namespace ast {
          */
         node_definition_expression(lexer::position position, std::vector<hostname> names, boost::optional<std::vector<expression>> body);
 
+        /**
+         * Constructs the node definition whose body has not been parsed.
+         * @param position The position of the node definition expression.
+         * @param names The hostnames for the node definition.
+         * @param body The range of the body in the source.
+         */
+        node_definition_expression(lexer::position position, std::vector<hostname> names, ast::deferred_body body);
+
         /**
          * Gets the list of hostnames for the node definition.
          * @return Returne the hostnames for the node definition.
@@ -114,6 +131,26 @@ namespace puppet { namespace ast {
          */
         boost::optional<std::vector<expression>> const& body() const;
 
+        /**
+         * Sets the body expressions of a node definition whose body was deferred.
+         * The body is parsed when first needed, so it can be set on a syntax tree that is otherwise immutable.
+         * @param body The body expressions.
+         */
+        void body(boost::optional<std::vector<expression>> body) const;
+
+        /**
+         * Gets the range of the body if the body has not been parsed.
+         * @return Returns the range of the body or none if the body has been parsed.
+         */
+        boost::optional<ast::deferred_body> const& deferred_body() const;
+
+        /**
+         * Determines if the body has been parsed.
+         * This can be called without holding a lock; when it returns true, the parsed body is visible to the calling thread.
+         * @return Returns true if the body has been parsed or false if parsing it was deferred and has not happened yet.
+         */
+        bool body_parsed() const;
+
         /**
          * Gets the position of the node definition expression.
          * @return Returns the position of the node definition expression.
@@ -123,7 +160,9 @@ namespace puppet { namespace ast {
      private:
         lexer::position _position;
         std::vector<hostname> _names;
-        boost::optional<std::vector<expression>> _body;
+        mutable boost::optional<std::vector<expression>> _body;
+        mutable boost::optional<ast::deferred_body> _deferred_body;
+        mutable ast::parsed_flag _parsed;
     };
 
     /**
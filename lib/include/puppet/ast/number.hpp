@@ -30,6 +30,13 @@ namespace puppet { namespace ast {
          */
         explicit number(lexer::number_token const& token);
 
+        /**
+         * Constructs a number with the given position and value.
+         * @param position The position of the number.
+         * @param value The value of the number.
+         */
+        number(lexer::position position, value_type value);
+
         /**
          * Gets the value of the number.
          * @return Returns the value of the number.
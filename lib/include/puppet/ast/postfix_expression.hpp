@@ -23,7 +23,7 @@ namespace puppet { namespace ast {
     /**
      * Represents a postfix expression.
      */
-    struct postfix_expression
+    struct postfix_expression : arena_allocated
     {
         /**
          * Default constructor for postfix expression.
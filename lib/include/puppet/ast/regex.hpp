@@ -22,6 +22,13 @@ namespace puppet { namespace ast {
          */
         regex();
 
+        /**
+         * Constructs a regex with the given position and value.
+         * @param position The position of the regex.
+         * @param value The value of the regex (without the enclosing slashes).
+         */
+        regex(lexer::position position, std::string value);
+
         /**
          * Constructs a regex from a token.
          * @tparam Iterator The underlying iterator type for the token.
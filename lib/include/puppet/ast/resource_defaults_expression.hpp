@@ -13,7 +13,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST resource defaults expression.
      */
-    struct resource_defaults_expression
+    struct resource_defaults_expression : arena_allocated
     {
         /**
          * Default constructor for resource defaults expression.
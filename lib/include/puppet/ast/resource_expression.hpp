@@ -163,7 +163,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST resource expression.
      */
-    struct resource_expression
+    struct resource_expression : arena_allocated
     {
         /**
          * Default constructor for resource_expression.
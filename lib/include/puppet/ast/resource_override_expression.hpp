@@ -14,7 +14,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST resource override expression.
      */
-    struct resource_override_expression
+    struct resource_override_expression : arena_allocated
     {
         /**
          * Default constructor for resource_override_expression.
@@ -0,0 +1,48 @@
+/**
+ * @file
+ * Declares the binary serialization of syntax trees.
+ */
+#pragma once
+
+#include "syntax_tree.hpp"
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <cstdint>
+
+namespace puppet { namespace ast {
+
+    /**
+     * The version of the binary syntax tree format.
+     * This must be incremented whenever the format or any AST type changes.
+     */
+    constexpr const std::uint32_t SERIALIZATION_FORMAT_VERSION = 3;
+
+    /**
+     * Exception for syntax tree serialization errors.
+     */
+    struct serialization_exception : std::runtime_error
+    {
+        /**
+         * Constructs a serialization exception.
+         * @param message The exception message.
+         */
+        explicit serialization_exception(std::string const& message);
+    };
+
+    /**
+     * Serializes a syntax tree into a binary form, including all positions.
+     * @param os The output stream to write to.
+     * @param tree The syntax tree to serialize.
+     */
+    void serialize(std::ostream& os, syntax_tree const& tree);
+
+    /**
+     * Deserializes a syntax tree from its binary form.
+     * Throws serialization_exception if the input is not a valid serialized syntax tree.
+     * @param is The input stream to read from.
+     * @return Returns the deserialized syntax tree.
+     */
+    syntax_tree deserialize(std::istream& is);
+
+}}  // namespace puppet::ast
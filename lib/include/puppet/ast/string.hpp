@@ -6,10 +6,14 @@
 
 #include "../lexer/string_token.hpp"
 #include <iostream>
+#include <memory>
 #include <string>
 
 namespace puppet { namespace ast {
 
+    // Forward declaration of interpolated_string
+    struct interpolated_string;
+
     /**
      * Represents an AST string.
      */
@@ -20,6 +24,20 @@ namespace puppet { namespace ast {
          */
         string();
 
+        /**
+         * Constructs a string from its parts.
+         * @param position The position of the string.
+         * @param value The value of the string.
+         * @param escapes The valid escape characters for the string.
+         * @param quote The quote character of the string (null character for heredocs).
+         * @param interpolated True if the string should be interpolated or false if not.
+         * @param format The format of the string (heredocs only).
+         * @param margin The margin of the string (heredocs only).
+         * @param remove_break True if the last line break should be removed (heredocs only).
+         * @param compiled The compiled form of the string or nullptr if the string has not been compiled.
+         */
+        string(lexer::position position, std::string value, std::string escapes, char quote, bool interpolated, std::string format, int margin, bool remove_break, std::shared_ptr<interpolated_string const> compiled = nullptr);
+
         /**
          * Constructs a string from a string token.
          * @tparam Iterator The underlying iterator type for the token.
@@ -87,6 +105,13 @@ namespace puppet { namespace ast {
          */
         lexer::position const& position() const;
 
+        /**
+         * Gets the compiled form of the string.
+         * Strings produced by the parser are compiled with escapes, margins, and interpolations already processed.
+         * @return Returns the compiled form of the string or nullptr if the string has not been compiled.
+         */
+        std::shared_ptr<interpolated_string const> const& compiled() const;
+
      private:
         lexer::position _position;
         std::string _value;
@@ -96,6 +121,7 @@ namespace puppet { namespace ast {
         std::string _format;
         int _margin;
         bool _remove_break;
+        std::shared_ptr<interpolated_string const> _compiled;
     };
 
     /**
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../lexer/position.hpp"
+#include "../symbol.hpp"
 #include <boost/range.hpp>
 #include <iostream>
 #include <string>
@@ -21,6 +22,13 @@ namespace puppet { namespace ast {
          */
         type();
 
+        /**
+         * Constructs a type with the given position and name.
+         * @param position The position of the type.
+         * @param name The name of the type.
+         */
+        type(lexer::position position, std::string name);
+
         /**
          * Constructs a type from a token.
          * @tparam Iterator The underlying iterator type for the token.
@@ -29,7 +37,7 @@ namespace puppet { namespace ast {
         template <typename Iterator>
         explicit type(boost::iterator_range<Iterator> const& token) :
             _position(token.begin().position()),
-            _name(token.begin(), token.end())
+            _name(std::string(token.begin(), token.end()))
         {
         }
 
@@ -39,6 +47,12 @@ namespace puppet { namespace ast {
          */
         std::string const& name() const;
 
+        /**
+         * Gets the interned symbol for the type's name.
+         * @return Returns the interned symbol for the type's name.
+         */
+        puppet::symbol const& symbol() const;
+
         /**
          * Gets the position of the type.
          * @return Returns the position of the type.
@@ -47,7 +61,7 @@ namespace puppet { namespace ast {
 
      private:
         lexer::position _position;
-        std::string _name;
+        puppet::symbol _name;
     };
 
     /**
@@ -15,7 +15,7 @@ namespace puppet { namespace ast {
     /**
      * Represents an AST "unless" expression.
      */
-    struct unless_expression
+    struct unless_expression : arena_allocated
     {
         /**
          * Default constructor for unless_expression.
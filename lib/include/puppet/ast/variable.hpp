@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../lexer/position.hpp"
+#include "../symbol.hpp"
 #include <boost/range.hpp>
 #include <iostream>
 #include <string>
@@ -33,7 +34,7 @@ namespace puppet { namespace ast {
             // Remove the $ from the name
             auto it = token.begin();
             ++it;
-            _name.assign(it, token.end());
+            _name = puppet::symbol(std::string(it, token.end()));
 
             validate_name();
         }
@@ -51,6 +52,12 @@ namespace puppet { namespace ast {
          */
         std::string const& name() const;
 
+        /**
+         * Gets the interned symbol for the variable's name.
+         * @return Returns the interned symbol for the variable's name.
+         */
+        puppet::symbol const& symbol() const;
+
         /**
          * Gets the position of the variable.
          * @return Returns the position of the variable.
@@ -61,7 +68,7 @@ namespace puppet { namespace ast {
         void validate_name() const;
 
         lexer::position _position;
-        std::string _name;
+        puppet::symbol _name;
     };
 
     /**
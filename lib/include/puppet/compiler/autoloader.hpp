@@ -0,0 +1,105 @@
+/**
+ * @file
+ * Declares the module autoloader.
+ */
+#pragma once
+
+#include "file_stamp.hpp"
+#include <boost/optional.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Represents the location of a class or defined type definition in a module manifest.
+     */
+    struct definition_location
+    {
+        /**
+         * The path to the manifest containing the definition.
+         */
+        std::string path;
+    };
+
+    /**
+     * Represents the module autoloader.
+     * The autoloader maps class and defined type names to the module manifests that define them.
+     * The index is built by lexing (not parsing) every manifest in the module directories and can be persisted so that
+     * later runs only need to check directory stamps to know the index is still current.
+     * The autoloader is safe to use from multiple threads.
+     */
+    struct autoloader
+    {
+        /**
+         * Constructs a module autoloader.
+         * The index is not built or read until the first lookup.
+         * @param directories The directories to search for modules, in order of precedence.
+         * @param index_path The path of the persisted index or an empty string to keep the index in memory only.
+         */
+        explicit autoloader(std::vector<std::string> directories, std::string index_path = {});
+
+        /**
+         * Gets the directories searched for modules.
+         * @return Returns the directories searched for modules.
+         */
+        std::vector<std::string> const& directories() const;
+
+        /**
+         * Gets the path of the persisted index.
+         * @return Returns the path of the persisted index or an empty string if the index is not persisted.
+         */
+        std::string const& index_path() const;
+
+        /**
+         * Finds the manifest that defines the given class or defined type.
+         * @param name The name of the class or defined type to find.
+         * @return Returns the location of the definition or an empty optional if no module defines the name.
+         */
+        boost::optional<definition_location> find(std::string const& name);
+
+        /**
+         * Rebuilds the index from the module manifests.
+         * This is used when a manifest found by the index no longer defines the expected name.
+         */
+        void rebuild();
+
+        /**
+         * Forgets the names that no module was found to define, unless they were last forgotten within the given interval.
+         * Long-running compilers call this so that manifests added since a name was last looked up are found.
+         * @param interval The minimum time between forgetting the names.
+         */
+        void refresh(std::chrono::steady_clock::duration interval);
+
+        /**
+         * Gets the module manifests that define classes or defined types.
+         * @return Returns the paths of the manifests, sorted so that they are always loaded in the same order.
+         */
+        std::vector<std::string> manifests();
+
+     private:
+        void load();
+        bool read();
+        void write() const;
+        void build();
+        void scan_directory(std::string const& directory);
+        void scan_manifest(std::string const& path, file_stamp const& stamp);
+        bool scan_conventional(std::string const& name);
+        void add_definition(std::string name, std::string const& path);
+
+        std::vector<std::string> _directories;
+        std::string _index_path;
+        bool _loaded;
+        std::vector<std::pair<std::string, file_stamp>> _directory_stamps;
+        std::unordered_map<std::string, file_stamp> _manifest_stamps;
+        std::unordered_map<std::string, definition_location> _definitions;
+        std::unordered_set<std::string> _misses;
+        std::chrono::steady_clock::time_point _refreshed;
+        std::mutex _mutex;
+    };
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,59 @@
+/**
+ * @file
+ * Declares the syntax tree cache.
+ */
+#pragma once
+
+#include "../lexer/source_buffer.hpp"
+#include "../ast/syntax_tree.hpp"
+#include <boost/optional.hpp>
+#include <string>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Represents an on-disk cache of parsed syntax trees.
+     * Entries are keyed by a hash of the source contents, so renamed or copied manifests still hit the cache
+     * and modified manifests never do.
+     * Trees with deferred bodies are keyed separately so that they are never loaded when bodies must be parsed up front.
+     */
+    struct cache
+    {
+        /**
+         * Constructs a syntax tree cache.
+         * @param directory The directory to store cached syntax trees in; it is created when the first tree is stored.
+         */
+        explicit cache(std::string directory);
+
+        /**
+         * Gets the directory cached syntax trees are stored in.
+         * @return Returns the directory cached syntax trees are stored in.
+         */
+        std::string const& directory() const;
+
+        /**
+         * Loads the cached syntax tree for the given source.
+         * Missing, stale, or corrupt entries are treated as a cache miss.
+         * @param source The source to load the syntax tree for.
+         * @param defer_bodies True to load a tree whose class, defined type, and node bodies were deferred or false to load a fully parsed tree.
+         * @return Returns the cached syntax tree or an empty optional if the source is not cached.
+         */
+        boost::optional<ast::syntax_tree> load(lexer::source_buffer const& source, bool defer_bodies = false) const;
+
+        /**
+         * Stores the syntax tree for the given source.
+         * The entry is written to a temporary file and renamed into place so concurrent readers never see a partial entry.
+         * @param source The source the syntax tree was parsed from.
+         * @param tree The syntax tree to store.
+         * @param defer_bodies True if the tree's class, defined type, and node bodies were deferred or false if the tree is fully parsed.
+         * @return Returns true if the syntax tree was stored or false if the cache could not be written.
+         */
+        bool store(lexer::source_buffer const& source, ast::syntax_tree const& tree, bool defer_bodies = false) const;
+
+     private:
+        std::string entry_path(lexer::source_buffer const& source, bool defer_bodies) const;
+
+        std::string _directory;
+    };
+
+}}  // namespace puppet::compiler
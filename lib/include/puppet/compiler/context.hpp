@@ -5,11 +5,13 @@
 #pragma once
 
 #include "exceptions.hpp"
+#include "manifest.hpp"
 #include "../logging/logger.hpp"
 #include "../lexer/position.hpp"
+#include "../lexer/source_buffer.hpp"
 #include "../ast/syntax_tree.hpp"
+#include "../ast/arena.hpp"
 #include <string>
-#include <fstream>
 #include <memory>
 
 namespace puppet { namespace compiler {
@@ -17,18 +19,32 @@ namespace puppet { namespace compiler {
     // Forward declaration of node
     struct node;
 
+    // Forward declaration of cache
+    struct cache;
+
     /**
      * Represents a compilation context.
+     * A compilation context binds a parsed manifest to the node it is being compiled for.
      */
     struct context
     {
         /**
-         * Constructs a compilation context.
+         * Constructs a compilation context by parsing the given file.
          * @param logger The logger to use during compilation.
          * @param path The path to the file being compiled.
          * @param node The node the file is being compiled for.
+         * @param cache The syntax tree cache to use or nullptr to always parse the file.
+         * @param defer_bodies True to defer parsing class, defined type, and node bodies until they are evaluated or false to parse them now.
          */
-        context(logging::logger& logger, std::shared_ptr<std::string> path, compiler::node& node);
+        context(logging::logger& logger, std::shared_ptr<std::string> path, compiler::node& node, compiler::cache const* cache = nullptr, bool defer_bodies = false);
+
+        /**
+         * Constructs a compilation context for an already parsed manifest.
+         * @param logger The logger to use during compilation.
+         * @param manifest The parsed manifest being compiled; it may be shared with the contexts of other nodes.
+         * @param node The node the file is being compiled for.
+         */
+        context(logging::logger& logger, std::shared_ptr<compiler::manifest> manifest, compiler::node& node);
 
         /**
          * Gets the logger used for logging messages.
@@ -42,18 +58,60 @@ namespace puppet { namespace compiler {
          */
         std::shared_ptr<std::string> const& path() const;
 
+        /**
+         * Gets the source buffer of the file being compiled.
+         * @return Returns the source buffer of the file being compiled.
+         */
+        std::shared_ptr<lexer::source_buffer const> const& source() const;
+
         /**
          * Gets the syntax tree that was parsed.
          * @return Returns the syntax tree that was parsed.
          */
         ast::syntax_tree const& tree() const;
 
+        /**
+         * Gets the arena that owns the nodes of the syntax tree.
+         * @return Returns the arena that owns the nodes of the syntax tree.
+         */
+        ast::arena const& arena() const;
+
+        /**
+         * Gets the parsed manifest being compiled.
+         * @return Returns the parsed manifest being compiled.
+         */
+        std::shared_ptr<compiler::manifest> const& manifest() const;
+
         /**
          * Gets the current compilation node.
          * @return Returns the current compilation node.
          */
         compiler::node& node();
 
+        /**
+         * Parses the body of a class definition if parsing of the body was deferred.
+         * @param expression The class definition expression from this context's syntax tree.
+         * @param parsed The callback to call with the body after it is parsed but before it is visible to other threads.
+         * @return Returns true if the body was parsed or false if the body was not deferred.
+         */
+        bool parse_body(ast::class_definition_expression const& expression, compiler::manifest::parsed_callback const& parsed = nullptr);
+
+        /**
+         * Parses the body of a defined type if parsing of the body was deferred.
+         * @param expression The defined type expression from this context's syntax tree.
+         * @param parsed The callback to call with the body after it is parsed but before it is visible to other threads.
+         * @return Returns true if the body was parsed or false if the body was not deferred.
+         */
+        bool parse_body(ast::defined_type_expression const& expression, compiler::manifest::parsed_callback const& parsed = nullptr);
+
+        /**
+         * Parses the body of a node definition if parsing of the body was deferred.
+         * @param expression The node definition expression from this context's syntax tree.
+         * @param parsed The callback to call with the body after it is parsed but before it is visible to other threads.
+         * @return Returns true if the body was parsed or false if the body was not deferred.
+         */
+        bool parse_body(ast::node_definition_expression const& expression, compiler::manifest::parsed_callback const& parsed = nullptr);
+
         /**
          * Writes a message to the log with the given position.
          * @param level The logging level.
@@ -71,10 +129,11 @@ namespace puppet { namespace compiler {
         compilation_exception create_exception(lexer::position const& position, std::string const& message);
 
      private:
+        template <typename Expression>
+        bool parse_deferred_body(Expression const& expression, compiler::manifest::parsed_callback const& parsed);
+
         logging::logger& _logger;
-        std::ifstream _stream;
-        std::shared_ptr<std::string> _path;
-        ast::syntax_tree _tree;
+        std::shared_ptr<compiler::manifest> _manifest;
         compiler::node& _node;
     };
 
@@ -0,0 +1,1463 @@
+/**
+ * @file
+ * Declares the hand-written recursive descent parser.
+ * This parser builds the same syntax tree as the Spirit.Qi based grammar, but parses the token stream directly instead of
+ * going through Qi's rules, attribute propagation, and multi_pass iterators.
+ */
+#pragma once
+
+#include "string_compiler.hpp"
+#include "../lexer/lexer.hpp"
+#include "../lexer/token_id.hpp"
+#include "../ast/syntax_tree.hpp"
+#include "../cast.hpp"
+#include <boost/optional.hpp>
+#include <stdexcept>
+#include <sstream>
+#include <vector>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Implements a recursive descent parser for the Puppet language.
+     * Each parse function mirrors a rule of the grammar (see grammar.hpp) and has the same semantics: a function returns
+     * false without consuming any tokens if its rule does not match and throws expectation_failure where the rule expects
+     * a token or rule to follow.
+     * Binary expressions are parsed as a chain of operators and operands; precedence is resolved when the expression is constructed.
+     * @tparam Lexer The lexer type to use for the token stream.
+     */
+    template <typename Lexer>
+    struct descent_parser
+    {
+        /**
+         * The token iterator type of the parser.
+         */
+        typedef typename Lexer::iterator_type iterator_type;
+
+        /**
+         * The token type of the parser.
+         */
+        typedef typename Lexer::token_type token_type;
+
+        /**
+         * The token id type of the parser.
+         */
+        typedef typename Lexer::id_type id_type;
+
+        /**
+         * The input iterator type of the parser.
+         */
+        typedef typename Lexer::input_iterator_type input_iterator_type;
+
+        /**
+         * The string token type of the parser.
+         */
+        typedef typename Lexer::string_token_type string_token_type;
+
+        /**
+         * Exception for when the parser expects a token or rule that is not in the input.
+         */
+        struct expectation_failure : std::runtime_error
+        {
+            /**
+             * Constructs an expectation failure.
+             * @param token The token that was found instead of the expected token or rule.
+             * @param message The exception message.
+             */
+            expectation_failure(token_type token, std::string const& message) :
+                std::runtime_error(message),
+                _token(rvalue_cast(token))
+            {
+            }
+
+            /**
+             * Gets the token that was found instead of the expected token or rule.
+             * The token is the default token if the end of input was found.
+             * @return Returns the token that was found.
+             */
+            token_type const& token() const
+            {
+                return _token;
+            }
+
+         private:
+            token_type _token;
+        };
+
+        /**
+         * Constructs a recursive descent parser for the given input.
+         * @param lexer The lexer to use for the token stream.
+         * @param begin The beginning of the input; this iterator is advanced as tokens are lexed.
+         * @param end The end of the input.
+         * @param interpolation True if parsing for string interpolation or false if not.
+         * @param defer_bodies True to defer parsing the bodies of class, defined type, and node definitions or false to parse them.
+         */
+        descent_parser(Lexer const& lexer, input_iterator_type& begin, input_iterator_type const& end, bool interpolation = false, bool defer_bodies = false) :
+            _current(lexer.begin(begin, end)),
+            _end(lexer.end()),
+            _started(false),
+            _index(0),
+            _interpolation(interpolation),
+            _defer_bodies(defer_bodies)
+        {
+        }
+
+        /**
+         * Parses the input into a syntax tree.
+         * For string interpolation, parsing ends at the first '}' token that isn't part of the syntax tree and no tokens
+         * after it are lexed.
+         * @param tree The resulting syntax tree.
+         * @return Returns true if the input was parsed or false if the input did not start a syntax tree.
+         */
+        bool parse(ast::syntax_tree& tree)
+        {
+            if (_interpolation) {
+                if (!accept('{')) {
+                    return false;
+                }
+                auto body = statements();
+                auto end = position();
+                expect('}');
+                tree = ast::syntax_tree(rvalue_cast(body), rvalue_cast(end));
+                return true;
+            }
+            tree = ast::syntax_tree(statements(true));
+            return true;
+        }
+
+        /**
+         * Parses a deferred definition body.
+         * The input must start at the body's opening '{'; parsing ends at the matching '}' and no tokens after it are lexed.
+         * @return Returns the body expressions.
+         */
+        boost::optional<std::vector<ast::expression>> parse_body()
+        {
+            return block();
+        }
+
+        /**
+         * Gets the current token of the parser.
+         * After parsing, this is the first token that was not parsed.
+         * The token is the default token if the end of input was reached.
+         * @return Returns the current token.
+         */
+        token_type const& current()
+        {
+            return peek();
+        }
+
+     private:
+        typedef boost::iterator_range<input_iterator_type> range_type;
+
+        static constexpr id_type to_id(char id)
+        {
+            return static_cast<id_type>(id);
+        }
+
+        static constexpr id_type to_id(lexer::token_id id)
+        {
+            return static_cast<id_type>(id);
+        }
+
+        token_type const& peek(size_t offset = 0)
+        {
+            // Tokens are only lexed when needed, so that string interpolation never lexes past its closing '}'
+            while (_tokens.size() <= _index + offset) {
+                if (_started && _current != _end) {
+                    ++_current;
+                }
+                _started = true;
+                _tokens.emplace_back(_current == _end ? token_type() : *_current);
+            }
+            return _tokens[_index + offset];
+        }
+
+        template <typename Id>
+        bool is(Id id, size_t offset = 0)
+        {
+            return peek(offset).id() == to_id(id);
+        }
+
+        template <typename Id>
+        bool accept(Id id)
+        {
+            if (!is(id)) {
+                return false;
+            }
+            ++_index;
+            return true;
+        }
+
+        template <typename Id>
+        void expect(Id id)
+        {
+            if (!accept(id)) {
+                fail(id);
+            }
+        }
+
+        template <typename Expected>
+        [[noreturn]] void fail(Expected const& expected)
+        {
+            auto& token = peek();
+
+            std::ostringstream ss;
+            ss << "expected ";
+            describe(ss, expected);
+            ss << " but found " << static_cast<lexer::token_id>(token.id());
+            if (_interpolation) {
+                ss << " during string interpolation";
+            }
+            ss << ".";
+            throw expectation_failure(token, ss.str());
+        }
+
+        static void describe(std::ostream& os, char const* rule)
+        {
+            os << rule;
+        }
+
+        static void describe(std::ostream& os, char id)
+        {
+            os << static_cast<lexer::token_id>(id);
+        }
+
+        static void describe(std::ostream& os, lexer::token_id id)
+        {
+            os << id;
+        }
+
+        lexer::position position()
+        {
+            return boost::apply_visitor(lexer::token_position_visitor(), peek().value());
+        }
+
+        lexer::position next_position()
+        {
+            auto result = position();
+            ++_index;
+            return result;
+        }
+
+        range_type next_range()
+        {
+            auto result = boost::get<range_type>(peek().value());
+            ++_index;
+            return result;
+        }
+
+        void discard()
+        {
+            // Release the tokens that have been parsed; only safe when there is nothing to backtrack to
+            _tokens.erase(_tokens.begin(), _tokens.begin() + _index);
+            _index = 0;
+        }
+
+        // Statements
+        boost::optional<std::vector<ast::expression>> statements(bool top_level = false)
+        {
+            // -(statement % -';') > -';'
+            std::vector<ast::expression> result;
+            ast::expression expression;
+            if (top_level) {
+                discard();
+            }
+            if (statement(expression)) {
+                result.emplace_back(rvalue_cast(expression));
+                while (true) {
+                    if (top_level) {
+                        discard();
+                    }
+                    auto mark = _index;
+                    accept(';');
+                    if (!statement(expression)) {
+                        _index = mark;
+                        break;
+                    }
+                    result.emplace_back(rvalue_cast(expression));
+                }
+            }
+            accept(';');
+
+            if (result.empty()) {
+                return boost::none;
+            }
+            return result;
+        }
+
+        bool statement(ast::expression& result)
+        {
+            ast::primary_expression primary;
+            if (!statement_expression(primary)) {
+                return false;
+            }
+
+            std::vector<ast::binary_expression> binary;
+            ast::binary_operator op;
+            while (binary_operator(op)) {
+                ast::primary_expression operand;
+                if (!statement_expression(operand)) {
+                    fail("statement expression");
+                }
+                binary.emplace_back(op, rvalue_cast(operand));
+            }
+            result = ast::expression(rvalue_cast(primary), rvalue_cast(binary));
+            return true;
+        }
+
+        bool statement_expression(ast::primary_expression& result)
+        {
+            {
+                ast::resource_expression expression;
+                if (resource_expression(expression)) {
+                    result = ast::catalog_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+            {
+                ast::resource_defaults_expression expression;
+                if (resource_defaults_expression(expression)) {
+                    result = ast::catalog_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+            {
+                ast::resource_override_expression expression;
+                if (resource_override_expression(expression)) {
+                    result = ast::catalog_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+            {
+                ast::class_definition_expression expression;
+                if (class_definition_expression(expression)) {
+                    result = ast::catalog_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+            {
+                ast::defined_type_expression expression;
+                if (defined_type_expression(expression)) {
+                    result = ast::catalog_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+            {
+                ast::node_definition_expression expression;
+                if (node_definition_expression(expression)) {
+                    result = ast::catalog_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+            {
+                ast::function_call_expression expression;
+                if (statement_call_expression(expression)) {
+                    result = ast::control_flow_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+            return primary_expression(result);
+        }
+
+        // Expressions
+        bool expressions(std::vector<ast::expression>& result)
+        {
+            // (expression % ',') > -','
+            ast::expression current;
+            if (!expression(current)) {
+                return false;
+            }
+            result.emplace_back(rvalue_cast(current));
+            while (true) {
+                auto mark = _index;
+                if (!accept(',')) {
+                    break;
+                }
+                if (!expression(current)) {
+                    _index = mark;
+                    break;
+                }
+                result.emplace_back(rvalue_cast(current));
+            }
+            accept(',');
+            return true;
+        }
+
+        boost::optional<std::vector<ast::expression>> optional_expressions()
+        {
+            std::vector<ast::expression> result;
+            if (!expressions(result)) {
+                return boost::none;
+            }
+            return result;
+        }
+
+        bool expression(ast::expression& result)
+        {
+            ast::primary_expression primary;
+            if (!primary_expression(primary)) {
+                return false;
+            }
+
+            std::vector<ast::binary_expression> binary;
+            ast::binary_operator op;
+            while (binary_operator(op)) {
+                ast::primary_expression operand;
+                if (!primary_expression(operand)) {
+                    fail("primary expression");
+                }
+                binary.emplace_back(op, rvalue_cast(operand));
+            }
+            result = ast::expression(rvalue_cast(primary), rvalue_cast(binary));
+            return true;
+        }
+
+        // Primary expression
+        bool primary_expression(ast::primary_expression& result)
+        {
+            ast::primary_expression primary;
+            if (!unary_expression(primary) &&
+                !catalog_expression(primary) &&
+                !control_flow_expression(primary) &&
+                !basic_expression(primary)) {
+                if (!accept('(')) {
+                    return false;
+                }
+                ast::expression nested;
+                if (!expression(nested)) {
+                    fail("expression");
+                }
+                expect(')');
+                primary = rvalue_cast(nested);
+            }
+
+            std::vector<ast::postfix_subexpression> subexpressions;
+            ast::postfix_subexpression subexpression;
+            while (postfix_subexpression(subexpression)) {
+                subexpressions.emplace_back(rvalue_cast(subexpression));
+            }
+            if (subexpressions.empty()) {
+                result = rvalue_cast(primary);
+            } else {
+                result = ast::postfix_expression(rvalue_cast(primary), rvalue_cast(subexpressions));
+            }
+            return true;
+        }
+
+        // Basic expressions
+        bool basic_expression(ast::primary_expression& result)
+        {
+            ast::basic_expression expression;
+            if (!basic_expression(expression)) {
+                return false;
+            }
+            result = rvalue_cast(expression);
+            return true;
+        }
+
+        bool basic_expression(ast::basic_expression& result)
+        {
+            switch (peek().id()) {
+                case to_id(lexer::token_id::keyword_undef):
+                    result = ast::undef(next_position());
+                    return true;
+
+                case to_id(lexer::token_id::keyword_default):
+                    result = ast::defaulted(next_position());
+                    return true;
+
+                case to_id(lexer::token_id::keyword_true):
+                    result = ast::boolean(next_position(), true);
+                    return true;
+
+                case to_id(lexer::token_id::keyword_false):
+                    result = ast::boolean(next_position(), false);
+                    return true;
+
+                case to_id(lexer::token_id::number): {
+                    ast::number number;
+                    this->number(number);
+                    result = rvalue_cast(number);
+                    return true;
+                }
+
+                case to_id(lexer::token_id::single_quoted_string):
+                case to_id(lexer::token_id::double_quoted_string):
+                case to_id(lexer::token_id::heredoc): {
+                    ast::string string;
+                    this->string(string);
+                    result = rvalue_cast(string);
+                    return true;
+                }
+
+                case to_id(lexer::token_id::regex):
+                    result = ast::regex(next_range());
+                    return true;
+
+                case to_id(lexer::token_id::variable):
+                    result = ast::variable(next_range());
+                    return true;
+
+                case to_id(lexer::token_id::name):
+                case to_id(lexer::token_id::statement_call):
+                    result = ast::name(next_range());
+                    return true;
+
+                case to_id(lexer::token_id::bare_word):
+                    result = ast::bare_word(next_range());
+                    return true;
+
+                case to_id(lexer::token_id::type):
+                    result = ast::type(next_range());
+                    return true;
+
+                case to_id('['):
+                case to_id(lexer::token_id::array_start): {
+                    auto position = next_position();
+                    auto elements = optional_expressions();
+                    expect(']');
+                    result = ast::array(rvalue_cast(position), rvalue_cast(elements));
+                    return true;
+                }
+
+                case to_id('{'):
+                    result = hash();
+                    return true;
+
+                default:
+                    return false;
+            }
+        }
+
+        bool number(ast::number& result)
+        {
+            if (!is(lexer::token_id::number)) {
+                return false;
+            }
+            result = ast::number(boost::get<lexer::number_token>(peek().value()));
+            ++_index;
+            return true;
+        }
+
+        bool string(ast::string& result)
+        {
+            if (!is(lexer::token_id::single_quoted_string) && !is(lexer::token_id::double_quoted_string) && !is(lexer::token_id::heredoc)) {
+                return false;
+            }
+            // Copy the token as the parser may backtrack over it
+            auto token = boost::get<string_token_type>(peek().value());
+            ++_index;
+            result = string_compiler::compile(ast::string(token));
+            return true;
+        }
+
+        bool name(ast::name& result)
+        {
+            if (!is(lexer::token_id::name) && !is(lexer::token_id::statement_call)) {
+                return false;
+            }
+            result = ast::name(next_range());
+            return true;
+        }
+
+        ast::name expect_name()
+        {
+            ast::name result;
+            if (!name(result)) {
+                fail("name");
+            }
+            return result;
+        }
+
+        ast::hash hash()
+        {
+            // '{' > -(hash_pair % ',') > -',' > '}'
+            auto position = next_position();
+            boost::optional<std::vector<ast::hash_pair>> elements;
+            ast::hash_pair pair;
+            if (hash_pair(pair)) {
+                elements = std::vector<ast::hash_pair>();
+                elements->emplace_back(rvalue_cast(pair));
+                while (true) {
+                    auto mark = _index;
+                    if (!accept(',')) {
+                        break;
+                    }
+                    if (!hash_pair(pair)) {
+                        _index = mark;
+                        break;
+                    }
+                    elements->emplace_back(rvalue_cast(pair));
+                }
+            }
+            accept(',');
+            expect('}');
+            return ast::hash(rvalue_cast(position), rvalue_cast(elements));
+        }
+
+        bool hash_pair(ast::hash_pair& result)
+        {
+            // expression > '=>' > expression
+            ast::expression key;
+            if (!expression(key)) {
+                return false;
+            }
+            expect(lexer::token_id::fat_arrow);
+            result = ast::hash_pair(rvalue_cast(key), expect_expression());
+            return true;
+        }
+
+        ast::expression expect_expression()
+        {
+            ast::expression result;
+            if (!expression(result)) {
+                fail("expression");
+            }
+            return result;
+        }
+
+        // Control-flow expressions
+        bool control_flow_expression(ast::primary_expression& result)
+        {
+            switch (peek().id()) {
+                case to_id(lexer::token_id::keyword_case):
+                    result = ast::control_flow_expression(case_expression());
+                    return true;
+
+                case to_id(lexer::token_id::keyword_if):
+                    result = ast::control_flow_expression(if_expression());
+                    return true;
+
+                case to_id(lexer::token_id::keyword_unless):
+                    result = ast::control_flow_expression(unless_expression());
+                    return true;
+
+                default: {
+                    ast::function_call_expression expression;
+                    if (!function_call_expression(expression)) {
+                        return false;
+                    }
+                    result = ast::control_flow_expression(rvalue_cast(expression));
+                    return true;
+                }
+            }
+        }
+
+        ast::case_expression case_expression()
+        {
+            // case > expression > '{' > +case_proposition > '}'
+            auto position = next_position();
+            auto expression = expect_expression();
+            expect('{');
+
+            std::vector<ast::case_proposition> propositions;
+            ast::case_proposition proposition;
+            if (!case_proposition(proposition)) {
+                fail("case proposition");
+            }
+            do {
+                propositions.emplace_back(rvalue_cast(proposition));
+            } while (case_proposition(proposition));
+            expect('}');
+            return ast::case_expression(rvalue_cast(position), rvalue_cast(expression), rvalue_cast(propositions));
+        }
+
+        bool case_proposition(ast::case_proposition& result)
+        {
+            // expressions > ':' > '{' > statements > '}'
+            std::vector<ast::expression> options;
+            if (!expressions(options)) {
+                return false;
+            }
+            expect(':');
+            result = ast::case_proposition(rvalue_cast(options), block());
+            return true;
+        }
+
+        boost::optional<std::vector<ast::expression>> block()
+        {
+            // '{' > statements > '}'
+            expect('{');
+            auto body = statements();
+            expect('}');
+            return body;
+        }
+
+        boost::optional<ast::deferred_body> deferred_block(size_t start)
+        {
+            // '{' > *token > '}' where the tokens are not parsed
+            // Bodies with definitions in them are parsed now so that the definitions can be scanned
+            if (!_defer_bodies || !is('{')) {
+                return boost::none;
+            }
+
+            // A heredoc in the signature continues on the lines after the '{', so the body cannot be lexed from the '{'
+            for (size_t i = start; i < _index; ++i) {
+                if (_tokens[i].id() == to_id(lexer::token_id::heredoc)) {
+                    return boost::none;
+                }
+            }
+
+            auto mark = _index;
+            auto begin = next_position();
+            for (size_t depth = 1;;) {
+                auto& token = peek();
+                auto id = token.id();
+                if (id == boost::lexer::npos ||
+                    !token_is_valid(token) ||
+                    id == to_id(lexer::token_id::keyword_define) ||
+                    id == to_id(lexer::token_id::keyword_node) ||
+                    (id == to_id(lexer::token_id::keyword_class) && (is(lexer::token_id::name, 1) || is(lexer::token_id::statement_call, 1)))) {
+                    // Let the block report any errors
+                    _index = mark;
+                    return boost::none;
+                }
+                if (id == to_id('{')) {
+                    ++depth;
+                } else if (id == to_id('}') && --depth == 0) {
+                    return ast::deferred_body(rvalue_cast(begin), next_position());
+                }
+                ++_index;
+            }
+        }
+
+        ast::if_expression if_expression()
+        {
+            // if > expression > '{' > statements > '}' > *elsif_expression > -else_expression
+            auto position = next_position();
+            auto conditional = expect_expression();
+            auto body = block();
+
+            std::vector<ast::elsif_expression> elsifs;
+            while (is(lexer::token_id::keyword_elsif)) {
+                auto elsif_position = next_position();
+                auto elsif_conditional = expect_expression();
+                elsifs.emplace_back(rvalue_cast(elsif_position), rvalue_cast(elsif_conditional), block());
+            }
+            return ast::if_expression(rvalue_cast(position), rvalue_cast(conditional), rvalue_cast(body), rvalue_cast(elsifs), else_expression());
+        }
+
+        boost::optional<ast::else_expression> else_expression()
+        {
+            // else > '{' > statements > '}'
+            if (!is(lexer::token_id::keyword_else)) {
+                return boost::none;
+            }
+            auto position = next_position();
+            return ast::else_expression(rvalue_cast(position), block());
+        }
+
+        ast::unless_expression unless_expression()
+        {
+            // unless > expression > '{' > statements > '}' > -else_expression
+            auto position = next_position();
+            auto conditional = expect_expression();
+            auto body = block();
+            return ast::unless_expression(rvalue_cast(position), rvalue_cast(conditional), rvalue_cast(body), else_expression());
+        }
+
+        bool function_call_expression(ast::function_call_expression& result)
+        {
+            // (name >> '(') > -expressions > ')' > -lambda
+            if (!is('(', 1)) {
+                return false;
+            }
+            ast::name function;
+            if (!name(function)) {
+                return false;
+            }
+            ++_index;
+            auto arguments = optional_expressions();
+            expect(')');
+            result = ast::function_call_expression(rvalue_cast(function), rvalue_cast(arguments), lambda());
+            return true;
+        }
+
+        bool statement_call_expression(ast::function_call_expression& result)
+        {
+            // statement_call >> !'(' >> expressions >> -lambda
+            if (!is(lexer::token_id::statement_call) || is('(', 1)) {
+                return false;
+            }
+            auto mark = _index;
+            ast::name function(next_range());
+            std::vector<ast::expression> arguments;
+            if (!expressions(arguments)) {
+                _index = mark;
+                return false;
+            }
+            result = ast::function_call_expression(rvalue_cast(function), rvalue_cast(arguments), lambda());
+            return true;
+        }
+
+        boost::optional<ast::lambda> lambda()
+        {
+            // '|' > -(parameter % ',') > -',' > '|' > '{' > statements > '}'
+            if (!is('|')) {
+                return boost::none;
+            }
+            auto position = next_position();
+            auto parameters = this->parameters();
+            expect('|');
+            return ast::lambda(rvalue_cast(position), rvalue_cast(parameters), block());
+        }
+
+        boost::optional<std::vector<ast::parameter>> parameters()
+        {
+            // -(parameter % ',') > -','
+            boost::optional<std::vector<ast::parameter>> result;
+            ast::parameter current;
+            if (parameter(current)) {
+                result = std::vector<ast::parameter>();
+                result->emplace_back(rvalue_cast(current));
+                while (true) {
+                    auto mark = _index;
+                    if (!accept(',')) {
+                        break;
+                    }
+                    if (!parameter(current)) {
+                        _index = mark;
+                        break;
+                    }
+                    result->emplace_back(rvalue_cast(current));
+                }
+            }
+            accept(',');
+            return result;
+        }
+
+        bool parameter(ast::parameter& result)
+        {
+            // -type_expression >> matches['*'] >> variable >> -('=' > expression)
+            auto mark = _index;
+            boost::optional<ast::primary_expression> type;
+            ast::primary_expression type_expression;
+            if (this->type_expression(type_expression)) {
+                type = rvalue_cast(type_expression);
+            }
+            bool captures = accept('*');
+            if (!is(lexer::token_id::variable)) {
+                _index = mark;
+                return false;
+            }
+            ast::variable variable(next_range());
+
+            boost::optional<ast::expression> default_value;
+            if (accept('=')) {
+                default_value = expect_expression();
+            }
+            result = ast::parameter(rvalue_cast(type), captures, rvalue_cast(variable), rvalue_cast(default_value));
+            return true;
+        }
+
+        // Catalog expressions
+        bool catalog_expression(ast::primary_expression& result)
+        {
+            // Everything but collection expressions are statement-level only
+            ast::collection_expression expression;
+            if (!collection_expression(expression)) {
+                return false;
+            }
+            result = ast::catalog_expression(rvalue_cast(expression));
+            return true;
+        }
+
+        bool resource_expression(ast::resource_expression& result)
+        {
+            auto status = ast::resource_status::realized;
+            ast::primary_expression type;
+            std::vector<ast::resource_body> bodies;
+            ast::resource_body body;
+
+            if (accept('@')) {
+                status = ast::resource_status::virtualized;
+            } else if (accept(lexer::token_id::atat)) {
+                status = ast::resource_status::exported;
+            }
+
+            if (status != ast::resource_status::realized) {
+                // '@' > resource_type > '{' > (resource_body % ';') > -';' > '}'
+                if (!resource_type(type)) {
+                    fail("resource type");
+                }
+                expect('{');
+                if (!resource_body(body)) {
+                    fail("list of resource body");
+                }
+            } else {
+                // (resource_type >> '{') >> (resource_body % ';') > -';' > '}'
+                // Only a name, class, or type followed by '{' (or a type followed by an access) can start a resource expression
+                if (!is('{', 1) && !(is(lexer::token_id::type) && is('[', 1))) {
+                    return false;
+                }
+                auto mark = _index;
+                if (!resource_type(type) || !accept('{') || !resource_body(body)) {
+                    _index = mark;
+                    return false;
+                }
+            }
+
+            bodies.emplace_back(rvalue_cast(body));
+            while (true) {
+                auto mark = _index;
+                if (!accept(';')) {
+                    break;
+                }
+                if (!resource_body(body)) {
+                    _index = mark;
+                    break;
+                }
+                bodies.emplace_back(rvalue_cast(body));
+            }
+            accept(';');
+            expect('}');
+            result = ast::resource_expression(rvalue_cast(type), rvalue_cast(bodies), status);
+            return true;
+        }
+
+        bool resource_type(ast::primary_expression& result)
+        {
+            // name | class | type_expression
+            if (is(lexer::token_id::name) || is(lexer::token_id::statement_call) || is(lexer::token_id::keyword_class)) {
+                result = ast::basic_expression(ast::name(next_range()));
+                return true;
+            }
+            return type_expression(result);
+        }
+
+        bool resource_body(ast::resource_body& result)
+        {
+            // (expression >> ':') > -(attribute_expression % ',') > -','
+            auto mark = _index;
+            ast::expression title;
+            if (!expression(title) || !accept(':')) {
+                _index = mark;
+                return false;
+            }
+            result = ast::resource_body(rvalue_cast(title), attribute_expressions());
+            return true;
+        }
+
+        boost::optional<std::vector<ast::attribute_expression>> attribute_expressions()
+        {
+            // -(attribute_expression % ',') > -','
+            boost::optional<std::vector<ast::attribute_expression>> result;
+            ast::attribute_expression current;
+            if (attribute_expression(current)) {
+                result = std::vector<ast::attribute_expression>();
+                result->emplace_back(rvalue_cast(current));
+                while (true) {
+                    auto mark = _index;
+                    if (!accept(',')) {
+                        break;
+                    }
+                    if (!attribute_expression(current)) {
+                        _index = mark;
+                        break;
+                    }
+                    result->emplace_back(rvalue_cast(current));
+                }
+            }
+            accept(',');
+            return result;
+        }
+
+        bool attribute_expression(ast::attribute_expression& result)
+        {
+            // attribute_name > attribute_operator > expression
+            if (!is_attribute_name(peek().id())) {
+                return false;
+            }
+            ast::name name(next_range());
+
+            ast::attribute_operator op;
+            if (accept(lexer::token_id::fat_arrow)) {
+                op = ast::attribute_operator::assignment;
+            } else if (accept(lexer::token_id::plus_arrow)) {
+                op = ast::attribute_operator::append;
+            } else {
+                fail("attribute operator");
+            }
+            result = ast::attribute_expression(rvalue_cast(name), op, expect_expression());
+            return true;
+        }
+
+        static bool is_attribute_name(id_type id)
+        {
+            switch (id) {
+                case to_id(lexer::token_id::name):
+                case to_id(lexer::token_id::statement_call):
+                case to_id(lexer::token_id::keyword_and):
+                case to_id(lexer::token_id::keyword_case):
+                case to_id(lexer::token_id::keyword_class):
+                case to_id(lexer::token_id::keyword_default):
+                case to_id(lexer::token_id::keyword_define):
+                case to_id(lexer::token_id::keyword_else):
+                case to_id(lexer::token_id::keyword_elsif):
+                case to_id(lexer::token_id::keyword_if):
+                case to_id(lexer::token_id::keyword_in):
+                case to_id(lexer::token_id::keyword_inherits):
+                case to_id(lexer::token_id::keyword_node):
+                case to_id(lexer::token_id::keyword_or):
+                case to_id(lexer::token_id::keyword_undef):
+                case to_id(lexer::token_id::keyword_unless):
+                case to_id(lexer::token_id::keyword_type):
+                case to_id(lexer::token_id::keyword_attr):
+                case to_id(lexer::token_id::keyword_function):
+                case to_id(lexer::token_id::keyword_private):
+                    return true;
+
+                default:
+                    return false;
+            }
+        }
+
+        bool resource_defaults_expression(ast::resource_defaults_expression& result)
+        {
+            // (type >> '{') > -(attribute_expression % ',') > -',' > '}'
+            if (!is(lexer::token_id::type) || !is('{', 1)) {
+                return false;
+            }
+            ast::type type(next_range());
+            ++_index;
+            auto attributes = attribute_expressions();
+            expect('}');
+            result = ast::resource_defaults_expression(rvalue_cast(type), rvalue_cast(attributes));
+            return true;
+        }
+
+        bool resource_override_expression(ast::resource_override_expression& result)
+        {
+            // (variable_type_expression >> '{') > -(attribute_expression % ',') > -',' > '}'
+            // Avoid parsing a variable or type only to backtrack over it when it cannot start an override
+            if ((!is(lexer::token_id::type) && !is(lexer::token_id::variable)) || (!is('{', 1) && !is('[', 1))) {
+                return false;
+            }
+            auto mark = _index;
+            ast::primary_expression reference;
+            if (!variable_type_expression(reference) || !accept('{')) {
+                _index = mark;
+                return false;
+            }
+            auto attributes = attribute_expressions();
+            expect('}');
+            result = ast::resource_override_expression(rvalue_cast(reference), rvalue_cast(attributes));
+            return true;
+        }
+
+        bool class_definition_expression(ast::class_definition_expression& result)
+        {
+            // class > name > -('(' > -(parameter % ',') > -',' > ')') > -(inherits > name) > '{' > -statements > '}'
+            if (!is(lexer::token_id::keyword_class)) {
+                return false;
+            }
+            auto start = _index;
+            auto position = next_position();
+            auto name = expect_name();
+            auto parameters = optional_parameters();
+
+            boost::optional<ast::name> parent;
+            if (accept(lexer::token_id::keyword_inherits)) {
+                parent = expect_name();
+            }
+            if (auto body = deferred_block(start)) {
+                result = ast::class_definition_expression(rvalue_cast(position), rvalue_cast(name), rvalue_cast(parameters), rvalue_cast(parent), rvalue_cast(*body));
+                return true;
+            }
+            result = ast::class_definition_expression(rvalue_cast(position), rvalue_cast(name), rvalue_cast(parameters), rvalue_cast(parent), block());
+            return true;
+        }
+
+        boost::optional<std::vector<ast::parameter>> optional_parameters()
+        {
+            // -('(' > -(parameter % ',') > -',' > ')')
+            if (!accept('(')) {
+                return boost::none;
+            }
+            auto result = parameters();
+            expect(')');
+            return result;
+        }
+
+        bool defined_type_expression(ast::defined_type_expression& result)
+        {
+            // define > name > -('(' > -(parameter % ',') > -',' > ')') > '{' > -statements > '}'
+            if (!is(lexer::token_id::keyword_define)) {
+                return false;
+            }
+            auto start = _index;
+            auto position = next_position();
+            auto name = expect_name();
+            auto parameters = optional_parameters();
+            if (auto body = deferred_block(start)) {
+                result = ast::defined_type_expression(rvalue_cast(position), rvalue_cast(name), rvalue_cast(parameters), rvalue_cast(*body));
+                return true;
+            }
+            result = ast::defined_type_expression(rvalue_cast(position), rvalue_cast(name), rvalue_cast(parameters), block());
+            return true;
+        }
+
+        bool node_definition_expression(ast::node_definition_expression& result)
+        {
+            // node > (hostname % ',') > -',' > '{' > statements > '}'
+            if (!is(lexer::token_id::keyword_node)) {
+                return false;
+            }
+            auto start = _index;
+            auto position = next_position();
+
+            std::vector<ast::hostname> names;
+            ast::hostname name;
+            if (!hostname(name)) {
+                fail("list of hostname");
+            }
+            names.emplace_back(rvalue_cast(name));
+            while (true) {
+                auto mark = _index;
+                if (!accept(',')) {
+                    break;
+                }
+                if (!hostname(name)) {
+                    _index = mark;
+                    break;
+                }
+                names.emplace_back(rvalue_cast(name));
+            }
+            accept(',');
+            if (auto body = deferred_block(start)) {
+                result = ast::node_definition_expression(rvalue_cast(position), rvalue_cast(names), rvalue_cast(*body));
+                return true;
+            }
+            result = ast::node_definition_expression(rvalue_cast(position), rvalue_cast(names), block());
+            return true;
+        }
+
+        bool hostname(ast::hostname& result)
+        {
+            // string | default | regex | ((name | bare_word | number) % '.')
+            ast::string string;
+            if (this->string(string)) {
+                result = ast::hostname(string);
+                return true;
+            }
+            if (is(lexer::token_id::keyword_default)) {
+                result = ast::hostname(ast::defaulted(next_position()));
+                return true;
+            }
+            if (is(lexer::token_id::regex)) {
+                result = ast::hostname(ast::regex(next_range()));
+                return true;
+            }
+
+            std::vector<boost::variant<ast::name, ast::bare_word, ast::number>> parts;
+            boost::variant<ast::name, ast::bare_word, ast::number> part;
+            if (!hostname_part(part)) {
+                return false;
+            }
+            parts.emplace_back(rvalue_cast(part));
+            while (true) {
+                auto mark = _index;
+                if (!accept('.')) {
+                    break;
+                }
+                if (!hostname_part(part)) {
+                    _index = mark;
+                    break;
+                }
+                parts.emplace_back(rvalue_cast(part));
+            }
+            result = ast::hostname(parts);
+            return true;
+        }
+
+        bool hostname_part(boost::variant<ast::name, ast::bare_word, ast::number>& result)
+        {
+            ast::name name;
+            if (this->name(name)) {
+                result = rvalue_cast(name);
+                return true;
+            }
+            if (is(lexer::token_id::bare_word)) {
+                result = ast::bare_word(next_range());
+                return true;
+            }
+            ast::number number;
+            if (this->number(number)) {
+                result = rvalue_cast(number);
+                return true;
+            }
+            return false;
+        }
+
+        bool collection_expression(ast::collection_expression& result)
+        {
+            // (type >> '<|') > -query > *binary_query_expression > '|>'
+            // (type >> '<<|') > -query > *binary_query_expression > '|>>'
+            if (!is(lexer::token_id::type)) {
+                return false;
+            }
+            ast::collection_kind kind;
+            lexer::token_id close;
+            if (is(lexer::token_id::left_collect, 1)) {
+                kind = ast::collection_kind::all;
+                close = lexer::token_id::right_collect;
+            } else if (is(lexer::token_id::left_double_collect, 1)) {
+                kind = ast::collection_kind::exported;
+                close = lexer::token_id::right_double_collect;
+            } else {
+                return false;
+            }
+            ast::type type(next_range());
+            ++_index;
+
+            boost::optional<ast::query> first;
+            ast::query current;
+            if (query(current)) {
+                first = rvalue_cast(current);
+            }
+
+            std::vector<ast::binary_query_expression> remainder;
+            while (true) {
+                ast::binary_query_operator op;
+                if (accept(lexer::token_id::keyword_and)) {
+                    op = ast::binary_query_operator::logical_and;
+                } else if (accept(lexer::token_id::keyword_or)) {
+                    op = ast::binary_query_operator::logical_or;
+                } else {
+                    break;
+                }
+                if (!query(current)) {
+                    fail("query");
+                }
+                remainder.emplace_back(op, rvalue_cast(current));
+            }
+            expect(close);
+            result = ast::collection_expression(kind, rvalue_cast(type), rvalue_cast(first), rvalue_cast(remainder));
+            return true;
+        }
+
+        bool query(ast::query& result)
+        {
+            // name > attribute_query_operator > attribute_query_value
+            ast::name attribute;
+            if (!name(attribute)) {
+                return false;
+            }
+
+            ast::attribute_query_operator op;
+            if (accept(lexer::token_id::equals)) {
+                op = ast::attribute_query_operator::equals;
+            } else if (accept(lexer::token_id::not_equals)) {
+                op = ast::attribute_query_operator::not_equals;
+            } else {
+                fail("attribute query operator");
+            }
+
+            // variable | string | boolean | number | name
+            ast::basic_expression value;
+            switch (peek().id()) {
+                case to_id(lexer::token_id::variable):
+                case to_id(lexer::token_id::single_quoted_string):
+                case to_id(lexer::token_id::double_quoted_string):
+                case to_id(lexer::token_id::heredoc):
+                case to_id(lexer::token_id::keyword_true):
+                case to_id(lexer::token_id::keyword_false):
+                case to_id(lexer::token_id::number):
+                case to_id(lexer::token_id::name):
+                case to_id(lexer::token_id::statement_call):
+                    basic_expression(value);
+                    break;
+
+                default:
+                    fail("attribute query value");
+            }
+            result = ast::query(rvalue_cast(attribute), op, rvalue_cast(value));
+            return true;
+        }
+
+        // Unary expressions
+        bool unary_expression(ast::primary_expression& result)
+        {
+            ast::unary_operator op;
+            switch (peek().id()) {
+                case to_id('-'):
+                    op = ast::unary_operator::negate;
+                    break;
+
+                case to_id('*'):
+                    op = ast::unary_operator::splat;
+                    break;
+
+                case to_id('!'):
+                    op = ast::unary_operator::logical_not;
+                    break;
+
+                default:
+                    return false;
+            }
+            auto position = next_position();
+            ast::primary_expression operand;
+            if (!primary_expression(operand)) {
+                fail("primary expression");
+            }
+            result = ast::unary_expression(rvalue_cast(position), op, rvalue_cast(operand));
+            return true;
+        }
+
+        // Postfix expressions
+        bool postfix_subexpression(ast::postfix_subexpression& result)
+        {
+            if (is('?')) {
+                result = selector_expression();
+                return true;
+            }
+            if (is('[')) {
+                result = access_expression();
+                return true;
+            }
+            if (is('.')) {
+                result = method_call_expression();
+                return true;
+            }
+            return false;
+        }
+
+        ast::selector_expression selector_expression()
+        {
+            // '?' > '{' > (selector_case_expression % ',') > -',' > '}'
+            auto position = next_position();
+            expect('{');
+
+            std::vector<ast::selector_case_expression> cases;
+            ast::expression selector;
+            if (!expression(selector)) {
+                fail("list of selector case expression");
+            }
+            while (true) {
+                expect(lexer::token_id::fat_arrow);
+                cases.emplace_back(rvalue_cast(selector), expect_expression());
+
+                auto mark = _index;
+                if (!accept(',')) {
+                    break;
+                }
+                if (!expression(selector)) {
+                    _index = mark;
+                    break;
+                }
+            }
+            accept(',');
+            expect('}');
+            return ast::selector_expression(rvalue_cast(position), rvalue_cast(cases));
+        }
+
+        ast::access_expression access_expression()
+        {
+            // '[' > expressions > ']'
+            auto position = next_position();
+            std::vector<ast::expression> arguments;
+            if (!expressions(arguments)) {
+                fail("expressions");
+            }
+            expect(']');
+            return ast::access_expression(rvalue_cast(position), rvalue_cast(arguments));
+        }
+
+        ast::method_call_expression method_call_expression()
+        {
+            // '.' > name > -('(' > expressions > ')') > -lambda
+            ++_index;
+            auto method = expect_name();
+
+            boost::optional<std::vector<ast::expression>> arguments;
+            if (accept('(')) {
+                arguments = std::vector<ast::expression>();
+                if (!expressions(*arguments)) {
+                    fail("expressions");
+                }
+                expect(')');
+            }
+            return ast::method_call_expression(rvalue_cast(method), rvalue_cast(arguments), lambda());
+        }
+
+        // Binary expressions
+        bool binary_operator(ast::binary_operator& result)
+        {
+            switch (peek().id()) {
+                case to_id(lexer::token_id::keyword_in):     result = ast::binary_operator::in;                 break;
+                case to_id(lexer::token_id::match):          result = ast::binary_operator::match;              break;
+                case to_id(lexer::token_id::not_match):      result = ast::binary_operator::not_match;          break;
+                case to_id('*'):                             result = ast::binary_operator::multiply;           break;
+                case to_id('/'):                             result = ast::binary_operator::divide;             break;
+                case to_id('%'):                             result = ast::binary_operator::modulo;             break;
+                case to_id('+'):                             result = ast::binary_operator::plus;               break;
+                case to_id('-'):                             result = ast::binary_operator::minus;              break;
+                case to_id(lexer::token_id::left_shift):     result = ast::binary_operator::left_shift;         break;
+                case to_id(lexer::token_id::right_shift):    result = ast::binary_operator::right_shift;        break;
+                case to_id(lexer::token_id::equals):         result = ast::binary_operator::equals;             break;
+                case to_id(lexer::token_id::not_equals):     result = ast::binary_operator::not_equals;         break;
+                case to_id('>'):                             result = ast::binary_operator::greater_than;       break;
+                case to_id(lexer::token_id::greater_equals): result = ast::binary_operator::greater_equals;     break;
+                case to_id('<'):                             result = ast::binary_operator::less_than;          break;
+                case to_id(lexer::token_id::less_equals):    result = ast::binary_operator::less_equals;        break;
+                case to_id(lexer::token_id::keyword_and):    result = ast::binary_operator::logical_and;        break;
+                case to_id(lexer::token_id::keyword_or):     result = ast::binary_operator::logical_or;         break;
+                case to_id('='):                             result = ast::binary_operator::assignment;         break;
+                case to_id(lexer::token_id::in_edge):        result = ast::binary_operator::in_edge;            break;
+                case to_id(lexer::token_id::in_edge_sub):    result = ast::binary_operator::in_edge_subscribe;  break;
+                case to_id(lexer::token_id::out_edge):       result = ast::binary_operator::out_edge;           break;
+                case to_id(lexer::token_id::out_edge_sub):   result = ast::binary_operator::out_edge_subscribe; break;
+
+                default:
+                    return false;
+            }
+            ++_index;
+            return true;
+        }
+
+        // Type expressions
+        bool type_expression(ast::primary_expression& result)
+        {
+            // type > *access_expression
+            if (!is(lexer::token_id::type)) {
+                return false;
+            }
+            ast::type type(next_range());
+            result = ast::postfix_expression(ast::basic_expression(rvalue_cast(type)), access_expressions());
+            return true;
+        }
+
+        bool variable_type_expression(ast::primary_expression& result)
+        {
+            // (type | variable) > *access_expression
+            ast::basic_expression expression;
+            if (is(lexer::token_id::type)) {
+                expression = ast::type(next_range());
+            } else if (is(lexer::token_id::variable)) {
+                expression = ast::variable(next_range());
+            } else {
+                return false;
+            }
+            result = ast::postfix_expression(rvalue_cast(expression), access_expressions());
+            return true;
+        }
+
+        std::vector<ast::postfix_subexpression> access_expressions()
+        {
+            std::vector<ast::postfix_subexpression> result;
+            while (is('[')) {
+                result.emplace_back(access_expression());
+            }
+            return result;
+        }
+
+        iterator_type _current;
+        iterator_type _end;
+        bool _started;
+        std::vector<token_type> _tokens;
+        size_t _index;
+        bool _interpolation;
+        bool _defer_bodies;
+    };
+
+}}  // namespace puppet::compiler
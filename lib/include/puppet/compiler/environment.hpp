@@ -4,12 +4,28 @@
  */
 #pragma once
 
+#include "autoloader.hpp"
+#include "context.hpp"
+#include "file_stamp.hpp"
+#include "../logging/logger.hpp"
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace puppet { namespace compiler {
 
+    // Forward declaration of node
+    struct node;
+
+    // Forward declaration of cache
+    struct cache;
+
     /**
      * Represents a compilation environment.
+     * The environment shares parsed manifests between the nodes compiled against it; it is safe to use from multiple threads.
      */
     struct environment
     {
@@ -17,8 +33,10 @@ namespace puppet { namespace compiler {
          * Constructs a new environment.
          * @param name The name of the environment (e.g. 'production').
          * @param base The base path for the environment.
+         * @param module_directories The global module directories; the environment's own modules take precedence over these.
+         * @param cache_directory The directory to persist the module index in or an empty string to not persist it.
          */
-        environment(std::string name, std::string base);
+        environment(std::string name, std::string base, std::vector<std::string> const& module_directories = {}, std::string const& cache_directory = {});
 
         /**
          * Gets the name of the environment.
@@ -32,9 +50,49 @@ namespace puppet { namespace compiler {
          */
         std::string const& base() const;
 
+        /**
+         * Gets the autoloader for the environment's modules.
+         * @return Returns the autoloader for the environment's modules.
+         */
+        compiler::autoloader& autoloader();
+
+        /**
+         * Loads a manifest for the given node.
+         * Each manifest is parsed, folded, and scanned for definitions once and then shared by every node that loads it.
+         * The manifest is parsed again if the file has changed since it was last loaded.
+         * Changes are found by modification time and size; the contents are also compared if the file was changed just before it was loaded.
+         * @param logger The logger to use for the node.
+         * @param node The node loading the manifest.
+         * @param path The path of the manifest to load.
+         * @param cache The syntax tree cache to use or nullptr to always parse the manifest.
+         * @param defer_bodies True to defer parsing class, defined type, and node bodies until they are evaluated or false to parse them now.
+         * @param copy_source True to copy the file into memory so that rewriting it cannot affect the manifest or false to map it.
+         * @return Returns a compilation context for the node that shares the loaded manifest.
+         */
+        std::shared_ptr<compiler::context> load(
+            logging::logger& logger,
+            compiler::node& node,
+            std::string const& path,
+            compiler::cache const* cache = nullptr,
+            bool defer_bodies = false,
+            bool copy_source = false);
+
      private:
+        struct manifest_entry
+        {
+            std::mutex mutex;
+            std::shared_ptr<compiler::manifest> manifest;
+            file_stamp stamp;
+            std::uint64_t hash = 0;
+        };
+
+        static bool is_unchanged(manifest_entry& entry, std::string const& path, file_stamp const& stamp);
+
         std::string _name;
         std::string _base;
+        compiler::autoloader _autoloader;
+        std::unordered_map<std::string, std::shared_ptr<manifest_entry>> _manifests;
+        std::mutex _mutex;
     };
 
 }}  // puppet::compiler
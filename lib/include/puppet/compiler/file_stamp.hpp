@@ -0,0 +1,91 @@
+/**
+ * @file
+ * Declares the file stamp used to tell when a file has changed.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Represents the modification time and size of a file at the time it was stamped.
+     * Modification times are kept to the nanosecond so that a change within the same second is still seen.
+     * File systems update modification times from a coarse clock, so a stamp taken just after a change is "racy":
+     * a second change made within the same clock tick leaves the stamp unchanged and must be detected some other way.
+     */
+    struct file_stamp
+    {
+        /**
+         * Constructs a stamp for a file that does not exist.
+         */
+        file_stamp();
+
+        /**
+         * Constructs a stamp for the given file.
+         * @param path The path of the file to stamp; the stamp is for a missing file if it cannot be read.
+         */
+        explicit file_stamp(std::string const& path);
+
+        /**
+         * Constructs a stamp from its parts.
+         * This is used to restore a stamp that was persisted.
+         * @param modified The modification time of the file, in nanoseconds since the epoch, or -1 if the file does not exist.
+         * @param size The size of the file, in bytes.
+         * @param taken The time the stamp was taken, in nanoseconds since the epoch.
+         */
+        file_stamp(std::int64_t modified, std::uintmax_t size, std::int64_t taken);
+
+        /**
+         * Determines if the file existed when it was stamped.
+         * @return Returns true if the file existed or false if it did not.
+         */
+        bool exists() const;
+
+        /**
+         * Gets the modification time of the file.
+         * @return Returns the modification time of the file, in nanoseconds since the epoch, or -1 if the file does not exist.
+         */
+        std::int64_t modified() const;
+
+        /**
+         * Gets the size of the file.
+         * @return Returns the size of the file, in bytes.
+         */
+        std::uintmax_t size() const;
+
+        /**
+         * Gets the time the stamp was taken.
+         * @return Returns the time the stamp was taken, in nanoseconds since the epoch.
+         */
+        std::int64_t taken() const;
+
+        /**
+         * Determines if the file was modified so close to when it was stamped that a later change might not change the stamp.
+         * @return Returns true if an unchanged stamp does not prove the file is unchanged or false if it does.
+         */
+        bool racy() const;
+
+        /**
+         * Determines if two stamps record the same modification time and size.
+         * The time the stamps were taken is not compared.
+         * @param other The other stamp to compare with.
+         * @return Returns true if the stamps are equal or false if they are not.
+         */
+        bool operator==(file_stamp const& other) const;
+
+        /**
+         * Determines if two stamps record a different modification time or size.
+         * @param other The other stamp to compare with.
+         * @return Returns true if the stamps differ or false if they are equal.
+         */
+        bool operator!=(file_stamp const& other) const;
+
+     private:
+        std::int64_t _modified;
+        std::uintmax_t _size;
+        std::int64_t _taken;
+    };
+
+}}  // namespace puppet::compiler
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "token_pos.hpp"
+#include "string_compiler.hpp"
 #include "../lexer/token_id.hpp"
 #include "../ast/syntax_tree.hpp"
 #include "../cast.hpp"
@@ -118,7 +119,7 @@ namespace puppet { namespace compiler {
             number =
                 lexer.number [ _val = phx::construct<ast::number>(_1) ];
             string =
-                (lexer.single_quoted_string | lexer.double_quoted_string | lexer.heredoc) [ _val = phx::construct<ast::string>(_1) ];
+                (lexer.single_quoted_string | lexer.double_quoted_string | lexer.heredoc) [ _val = phx::bind(&string_compiler::compile, phx::construct<ast::string>(_1)) ];
             regex =
                 token(token_id::regex) [ _val = phx::construct<ast::regex>(_1) ];
             variable =
@@ -0,0 +1,22 @@
+/**
+ * @file
+ * Declares the hash used to tell when file contents have changed.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Hashes bytes with 64-bit FNV-1a.
+     * The hash is persisted in the syntax tree cache, so it must not change between runs or platforms.
+     * @param data The bytes to hash.
+     * @param size The number of bytes to hash.
+     * @param hash The hash to continue from; defaults to the FNV-1a offset basis.
+     * @return Returns the hash of the bytes.
+     */
+    std::uint64_t hash_bytes(char const* data, std::size_t size, std::uint64_t hash = 14695981039346656037ull);
+
+}}  // namespace puppet::compiler
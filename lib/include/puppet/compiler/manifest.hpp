@@ -0,0 +1,164 @@
+/**
+ * @file
+ * Declares the parsed manifest.
+ */
+#pragma once
+
+#include "exceptions.hpp"
+#include "../logging/logger.hpp"
+#include "../lexer/position.hpp"
+#include "../lexer/source_buffer.hpp"
+#include "../ast/syntax_tree.hpp"
+#include "../ast/arena.hpp"
+#include <functional>
+#include <string>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+#include <vector>
+
+namespace puppet { namespace runtime {
+
+    // Forward declaration of definitions
+    struct definitions;
+
+}}  // namespace puppet::runtime
+
+namespace puppet { namespace runtime { namespace vm {
+
+    // Forward declaration of program
+    struct program;
+
+}}}  // namespace puppet::runtime::vm
+
+namespace puppet { namespace compiler {
+
+    // Forward declaration of cache
+    struct cache;
+
+    /**
+     * Represents a parsed manifest.
+     * A manifest does not depend on the node being compiled, so one manifest can be shared by the compilation contexts
+     * of many nodes, including nodes compiled at the same time on different threads.
+     */
+    struct manifest
+    {
+        /**
+         * The callback type for when a deferred body is parsed.
+         */
+        using parsed_callback = std::function<void(std::vector<ast::expression> const&)>;
+
+        /**
+         * Constructs a manifest by parsing the given file.
+         * @param logger The logger to use while parsing.
+         * @param path The path to the file to parse.
+         * @param cache The syntax tree cache to use or nullptr to always parse the file.
+         * @param defer_bodies True to defer parsing class, defined type, and node bodies until they are evaluated or false to parse them now.
+         * @param copy_source True to copy the file into memory so that rewriting it cannot affect the manifest or false to map it.
+         */
+        manifest(logging::logger& logger, std::shared_ptr<std::string> path, compiler::cache const* cache = nullptr, bool defer_bodies = false, bool copy_source = false);
+
+        /**
+         * Gets the path of the manifest.
+         * @return Returns the path of the manifest.
+         */
+        std::shared_ptr<std::string> const& path() const;
+
+        /**
+         * Gets the source buffer of the manifest.
+         * @return Returns the source buffer of the manifest.
+         */
+        std::shared_ptr<lexer::source_buffer const> const& source() const;
+
+        /**
+         * Gets the syntax tree that was parsed.
+         * @return Returns the syntax tree that was parsed.
+         */
+        ast::syntax_tree const& tree() const;
+
+        /**
+         * Gets the arena that owns the nodes of the syntax tree.
+         * @return Returns the arena that owns the nodes of the syntax tree.
+         */
+        ast::arena const& arena() const;
+
+        /**
+         * Gets the definitions found by scanning the manifest.
+         * @return Returns the definitions found by scanning the manifest or nullptr if the manifest has not been scanned.
+         */
+        std::shared_ptr<runtime::definitions const> const& definitions() const;
+
+        /**
+         * Sets the definitions found by scanning the manifest.
+         * This must be set before the manifest is shared.
+         * @param definitions The definitions found by scanning the manifest.
+         */
+        void definitions(std::shared_ptr<runtime::definitions const> definitions);
+
+        /**
+         * Parses the body of a class definition if parsing of the body was deferred.
+         * Deferred bodies are parsed once, even when the manifest is shared between threads.
+         * @param expression The class definition expression from this manifest's syntax tree.
+         * @param parsed The callback to call with the body after it is parsed but before it is visible to other threads.
+         * @return Returns true if the body was parsed or false if the body was not deferred.
+         */
+        bool parse_body(ast::class_definition_expression const& expression, parsed_callback const& parsed = nullptr);
+
+        /**
+         * Parses the body of a defined type if parsing of the body was deferred.
+         * Deferred bodies are parsed once, even when the manifest is shared between threads.
+         * @param expression The defined type expression from this manifest's syntax tree.
+         * @param parsed The callback to call with the body after it is parsed but before it is visible to other threads.
+         * @return Returns true if the body was parsed or false if the body was not deferred.
+         */
+        bool parse_body(ast::defined_type_expression const& expression, parsed_callback const& parsed = nullptr);
+
+        /**
+         * Parses the body of a node definition if parsing of the body was deferred.
+         * Deferred bodies are parsed once, even when the manifest is shared between threads.
+         * @param expression The node definition expression from this manifest's syntax tree.
+         * @param parsed The callback to call with the body after it is parsed but before it is visible to other threads.
+         * @return Returns true if the body was parsed or false if the body was not deferred.
+         */
+        bool parse_body(ast::node_definition_expression const& expression, parsed_callback const& parsed = nullptr);
+
+        /**
+         * Gets the bytecode program for a block of expressions, compiling it on first use.
+         * Programs are compiled once and shared by every node compiled from the manifest, even on different threads.
+         * @param body The block of expressions from this manifest's syntax tree to get the program for.
+         * @param top_level True if the block is the top level of the manifest or false if it is the body of a definition.
+         * @return Returns the bytecode program for the block.
+         */
+        runtime::vm::program const& program(std::vector<ast::expression> const& body, bool top_level = false);
+
+        /**
+         * Gets the bytecode program for a lambda, compiling it on first use.
+         * Programs are compiled once and shared by every node compiled from the manifest, even on different threads.
+         * @param lambda The lambda from this manifest's syntax tree to get the program for.
+         * @return Returns the bytecode program for the lambda.
+         */
+        runtime::vm::program const& program(ast::lambda const& lambda);
+
+        /**
+         * Creates a compilation exception for the given position and message.
+         * @param position The position of the error.
+         * @param message The error message.
+         * @return Returns a compilation exception for the given position and message.
+         */
+        compilation_exception create_exception(lexer::position const& position, std::string const& message) const;
+
+     private:
+        template <typename Expression>
+        bool parse_deferred_body(Expression const& expression, parsed_callback const& parsed);
+
+        std::shared_ptr<std::string> _path;
+        std::shared_ptr<lexer::source_buffer const> _source;
+        // The arena must be declared before the tree so that it is destroyed after it
+        ast::arena _arena;
+        ast::syntax_tree _tree;
+        std::shared_ptr<runtime::definitions const> _definitions;
+        std::unordered_map<void const*, std::shared_ptr<runtime::vm::program const>> _programs;
+        std::mutex _mutex;
+    };
+
+}}  // puppet::compiler
@@ -9,9 +9,11 @@
 #include "../runtime/catalog.hpp"
 #include "../runtime/context.hpp"
 #include "../logging/logger.hpp"
+#include "../facts/provider.hpp"
 #include "environment.hpp"
 #include <exception>
 #include <functional>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -26,8 +28,9 @@ namespace puppet { namespace compiler {
          * Constructs a compilation node.
          * @param name The name of the node.
          * @param environment The environment for the node.
+         * @param facts The facts provider for the node.
          */
-        node(std::string const& name, compiler::environment& environment);
+        node(std::string const& name, compiler::environment& environment, std::shared_ptr<facts::provider> facts);
 
         /**
          * Gets the display name of the node.
@@ -41,6 +44,12 @@ namespace puppet { namespace compiler {
          */
         compiler::environment& environment();
 
+        /**
+         * Gets the node's facts provider.
+         * @return Returns the node's facts provider.
+         */
+        std::shared_ptr<facts::provider> const& facts() const;
+
         /**
          * Compiles manifests into a catalog for this node.
          * @param logger The logger to use.
@@ -49,6 +58,15 @@ namespace puppet { namespace compiler {
          */
         runtime::catalog compile(logging::logger& logger, compiler::settings const& settings);
 
+        /**
+         * Loads the manifests to compile and every module manifest into the node's environment without compiling a catalog.
+         * Manifests are parsed in full, even with lazy parsing, so nodes compiled later never need to parse them.
+         * @param logger The logger to use.
+         * @param settings The compiler settings.
+         * @return Returns the number of manifests loaded.
+         */
+        std::size_t preload(logging::logger& logger, compiler::settings const& settings);
+
         /**
          * Calls the given callback for each name associated with the node.
          * @param callback The callback to call for each name.
@@ -56,11 +74,14 @@ namespace puppet { namespace compiler {
         void each_name(std::function<bool(std::string const&)> const& callback) const;
 
      private:
+        std::vector<std::shared_ptr<compiler::context>> parse(logging::logger& logger, compiler::settings const& settings);
+        bool load(logging::logger& logger, compiler::settings const& settings, runtime::catalog& catalog, std::set<std::string>& loaded, std::string const& name);
         static void create_main(runtime::catalog& catalog);
         static void create_settings_scope(runtime::context& context, compiler::settings const& settings);
 
         std::set<std::string> _names;
         compiler::environment& _environment;
+        std::shared_ptr<facts::provider> _facts;
     };
 
 }}  // puppet::compiler
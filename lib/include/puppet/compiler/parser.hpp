@@ -6,8 +6,10 @@
 
 #include "exceptions.hpp"
 #include "grammar.hpp"
+#include "descent_parser.hpp"
 #include "../lexer/static_lexer.hpp"
 #include "../lexer/lexer.hpp"
+#include "../lexer/dfa_lexer.hpp"
 #include <boost/optional.hpp>
 #include <sstream>
 #include <iomanip>
@@ -20,12 +22,32 @@ namespace puppet { namespace compiler {
     struct parser
     {
         /**
-         * Parses the given file into a syntax tree.
-         * @param input The input file to parse.
+         * The lexer type used by the parser.
+         * Define PUPPET_USE_DFA_LEXER to use the hand-written DFA lexer instead of the static lexer.
+         */
+#ifdef PUPPET_USE_DFA_LEXER
+        typedef lexer::string_dfa_lexer lexer_type;
+#else
+        typedef lexer::string_static_lexer lexer_type;
+#endif
+
+        /**
+         * Parses the given source buffer into a syntax tree.
+         * @param input The source buffer to parse.
          * @param interpolation True if parsing for string interpolation or false if not.
+         * @param defer_bodies True to defer parsing the bodies of class, defined type, and node definitions until they are needed.
          * @return Returns the parsed syntax tree.
          */
-        static ast::syntax_tree parse(std::ifstream& input, bool interpolation = false);
+        static ast::syntax_tree parse(lexer::source_buffer const& input, bool interpolation = false, bool defer_bodies = false);
+
+        /**
+         * Parses a definition body whose parsing was deferred.
+         * @param input The source buffer the body was deferred from.
+         * @param body The deferred body to parse.
+         * @return Returns the body expressions.
+         */
+        static boost::optional<std::vector<ast::expression>> parse_body(lexer::source_buffer const& input, ast::deferred_body const& body);
+
         /**
          * Parses the given string into a syntax tree.
          * @param input The input string to parse.
@@ -43,6 +65,15 @@ namespace puppet { namespace compiler {
          */
         static ast::syntax_tree parse(lexer::lexer_string_iterator& begin, lexer::lexer_string_iterator const& end, bool interpolation = false);
 
+        /**
+         * Parses the given string into a syntax tree with the Spirit grammar instead of the recursive descent parser.
+         * Both produce the same syntax tree; the grammar serves as the reference for the recursive descent parser.
+         * @param input The input string to parse.
+         * @param interpolation True if parsing for string interpolation or false if not.
+         * @return Returns the parsed syntax tree.
+         */
+        static ast::syntax_tree parse_with_grammar(std::string const& input, bool interpolation = false);
+
      private:
         struct expectation_info_printer
         {
@@ -78,22 +109,91 @@ namespace puppet { namespace compiler {
             return ss.str();
         }
 
+        template <typename Lexer>
+        static Lexer const& get_lexer()
+        {
+            // Constructing a lexer is expensive, so each thread constructs one and reuses it
+            // The lexer keeps no state between inputs (it lives in the token iterators), so it can be reused even while
+            // a string interpolation is parsed from inside another parse
+            static thread_local Lexer instance;
+            return instance;
+        }
+
+        template <typename Lexer>
+        static compiler::grammar<Lexer> const& get_grammar(bool interpolation)
+        {
+            // Constructing a grammar is also expensive; the grammar's rules are reentrant, so each thread constructs one per mode
+            if (interpolation) {
+                static thread_local compiler::grammar<Lexer> instance(get_lexer<Lexer>(), true);
+                return instance;
+            }
+            static thread_local compiler::grammar<Lexer> instance(get_lexer<Lexer>(), false);
+            return instance;
+        }
+
         template <typename Lexer, typename Input, typename Iterator>
-        static ast::syntax_tree parse(Lexer& lexer, Input& input, Iterator& begin, Iterator const& end, bool interpolation)
+        static ast::syntax_tree parse(Input& input, Iterator& begin, Iterator const& end, bool interpolation, bool defer_bodies = false)
+        {
+            using namespace std;
+            using namespace puppet::lexer;
+
+            typedef descent_parser<Lexer> parser_type;
+
+            try {
+                // Parse the input into a syntax tree
+                parser_type parser(get_lexer<Lexer>(), begin, end, interpolation, defer_bodies);
+                ast::syntax_tree tree;
+                bool parsed = parser.parse(tree);
+
+                // When interpolating, the parser stops at the closing '}' and the rest of the input is not examined
+                auto& token = parser.current();
+                if (parsed && (interpolation || token.id() == boost::lexer::npos)) {
+                    return tree;
+                }
+
+                // If not all tokens were processed and the parser stopped at a valid token, handle unexpected token
+                if (token_is_valid(token)) {
+                    throw parse_exception(get_position(input, token), (boost::format("unexpected %1%.") % static_cast<token_id>(token.id())).str());
+                }
+            } catch (lexer_exception<Iterator> const& ex) {
+                throw parse_exception(ex.location().position(), ex.what());
+            } catch (typename parser_type::expectation_failure const& ex) {
+                throw parse_exception(get_position(input, ex.token()), ex.what());
+            }
+            throw unexpected_input(begin, end);
+        }
+
+        template <typename Lexer, typename Input, typename Iterator>
+        static boost::optional<std::vector<ast::expression>> parse_body(Input& input, Iterator& begin, Iterator const& end)
+        {
+            typedef descent_parser<Lexer> parser_type;
+
+            try {
+                parser_type parser(get_lexer<Lexer>(), begin, end);
+                return parser.parse_body();
+            } catch (lexer::lexer_exception<Iterator> const& ex) {
+                throw parse_exception(ex.location().position(), ex.what());
+            } catch (typename parser_type::expectation_failure const& ex) {
+                throw parse_exception(lexer::get_position(input, ex.token()), ex.what());
+            }
+        }
+
+        template <typename Lexer, typename Input, typename Iterator>
+        static ast::syntax_tree parse_with_grammar(Input& input, Iterator& begin, Iterator const& end, bool interpolation)
         {
             using namespace std;
             using namespace puppet::lexer;
             namespace qi = boost::spirit::qi;
 
             try {
-                // Construct a lexer of the given type with a callback that reports warnings
-                Lexer lexer;
+                // Use this thread's lexer and grammar for the mode
+                auto& lexer = get_lexer<Lexer>();
                 auto token_begin = lexer.begin(begin, end);
                 auto token_end = lexer.end();
 
                 // Parse the input into a syntax tree
                 ast::syntax_tree tree;
-                if (qi::parse(token_begin, token_end, grammar<Lexer>(lexer, interpolation), tree) &&
+                if (qi::parse(token_begin, token_end, get_grammar<Lexer>(interpolation), tree) &&
                     (token_begin == token_end || token_begin->id() == boost::lexer::npos || interpolation)) {
                     return tree;
                 }
@@ -107,6 +207,13 @@ namespace puppet { namespace compiler {
             } catch (qi::expectation_failure<typename Lexer::iterator_type> const& ex) {
                 throw parse_exception(get_position(input, *ex.first), to_string(ex, interpolation));
             }
+            throw unexpected_input(begin, end);
+        }
+
+        template <typename Iterator>
+        static parse_exception unexpected_input(Iterator const& begin, Iterator const& end)
+        {
+            using namespace std;
 
             // Unexpected character in the input
             ostringstream message;
@@ -121,7 +228,7 @@ namespace puppet { namespace compiler {
             } else {
                 message << "unexpected end of input.";
             }
-            throw parse_exception(begin.position(), message.str());
+            return parse_exception(begin.position(), message.str());
         }
     };
 
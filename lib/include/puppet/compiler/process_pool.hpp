@@ -0,0 +1,141 @@
+/**
+ * @file
+ * Declares the compilation process pool.
+ */
+#pragma once
+
+#include "../logging/logger.hpp"
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Runs jobs in a pool of forked worker processes.
+     * Workers are forked after the caller has loaded everything the jobs share (e.g. parsed manifests), so that memory
+     * is shared copy-on-write rather than loaded again by each worker. Each worker takes the next job from a queue in
+     * shared memory until none remain.
+     * Because each worker is a separate process, jobs do not need to be thread-safe with respect to each other.
+     */
+    struct process_pool
+    {
+        /**
+         * The callback type for running a job.
+         * The callback is given the index of the job and the index of the worker running it and returns true if the
+         * job succeeded or false if it failed.
+         */
+        using job_type = std::function<bool(std::size_t job, std::size_t worker)>;
+
+        /**
+         * Represents the result of a job.
+         */
+        struct job_result
+        {
+            /**
+             * Stores whether or not the job completed; a job does not complete if its worker terminates abnormally.
+             */
+            bool completed = false;
+
+            /**
+             * Stores whether or not the job succeeded.
+             */
+            bool succeeded = false;
+
+            /**
+             * Stores the time taken by the job, in seconds.
+             */
+            double seconds = 0;
+        };
+
+        /**
+         * Represents the result of a worker process.
+         */
+        struct worker_result
+        {
+            /**
+             * Stores whether or not the worker exited normally.
+             */
+            bool exited = false;
+
+            /**
+             * Stores the number of jobs the worker completed.
+             */
+            std::size_t jobs = 0;
+
+            /**
+             * Stores the number of jobs that failed.
+             */
+            std::size_t failed = 0;
+
+            /**
+             * Stores the number of warnings the worker logged.
+             */
+            std::size_t warnings = 0;
+
+            /**
+             * Stores the number of errors the worker logged.
+             */
+            std::size_t errors = 0;
+
+            /**
+             * Stores the time the worker spent running jobs, in seconds.
+             */
+            double seconds = 0;
+
+            /**
+             * Stores the worker's peak resident set size, in kilobytes; this includes memory shared with other processes.
+             */
+            std::size_t peak_resident = 0;
+
+            /**
+             * Stores the worker's resident memory that is not shared with other processes, in kilobytes.
+             * This is zero where the platform does not report it.
+             */
+            std::size_t private_resident = 0;
+        };
+
+        /**
+         * Represents the results of running jobs.
+         */
+        struct results
+        {
+            /**
+             * Stores the result of each job, in job order.
+             */
+            std::vector<job_result> jobs;
+
+            /**
+             * Stores the result of each worker.
+             */
+            std::vector<worker_result> workers;
+        };
+
+        /**
+         * Constructs a process pool.
+         * @param workers The number of worker processes to fork.
+         */
+        explicit process_pool(std::size_t workers);
+
+        /**
+         * Gets the number of worker processes.
+         * @return Returns the number of worker processes.
+         */
+        std::size_t workers() const;
+
+        /**
+         * Forks the workers, runs the given number of jobs, and waits for the workers to exit.
+         * This must only be called when no other threads are running, as only the calling thread exists in the workers.
+         * Warnings and errors logged by the workers are added to the given logger's counts.
+         * @param logger The logger to log worker failures to; workers log to their copy of it.
+         * @param count The number of jobs to run.
+         * @param job The callback to call for each job in a worker process.
+         * @return Returns the results of the jobs and workers.
+         */
+        results run(logging::logger& logger, std::size_t count, job_type const& job) const;
+
+     private:
+        std::size_t _workers;
+    };
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,50 @@
+/**
+ * @file
+ * Declares the compilation scheduler.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Runs jobs on a pool of worker threads.
+     * Each worker starts with its own share of the jobs; a worker that runs out of jobs steals from the end of another
+     * worker's share, so uneven jobs (e.g. nodes with very different catalogs) still keep every worker busy.
+     */
+    struct scheduler
+    {
+        /**
+         * The callback type for running a job.
+         * The callback is given the index of the job and the index of the worker running it.
+         */
+        using job_type = std::function<void(std::size_t job, std::size_t worker)>;
+
+        /**
+         * Constructs a scheduler.
+         * @param workers The number of worker threads to use, including the calling thread.
+         */
+        explicit scheduler(std::size_t workers);
+
+        /**
+         * Gets the number of worker threads.
+         * @return Returns the number of worker threads.
+         */
+        std::size_t workers() const;
+
+        /**
+         * Runs the given number of jobs and waits for them to complete.
+         * The calling thread is worker 0. If any job throws an exception, the remaining jobs are still run and the
+         * exception of the lowest numbered job that failed is rethrown.
+         * @param count The number of jobs to run.
+         * @param job The callback to call for each job.
+         */
+        void run(std::size_t count, job_type const& job) const;
+
+     private:
+        std::size_t _workers;
+    };
+
+}}  // namespace puppet::compiler
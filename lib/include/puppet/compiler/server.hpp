@@ -0,0 +1,65 @@
+/**
+ * @file
+ * Declares the compile server.
+ */
+#pragma once
+
+#include "environment.hpp"
+#include "settings.hpp"
+#include "../logging/logger.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Represents a server that compiles catalogs for requests made on a Unix domain socket.
+     * Each request is a JSON object with the node's facts and optionally its name and environment; the response is the
+     * node's catalog as JSON or a JSON object with an error message.
+     * Environments are kept for the life of the server, so manifests are only parsed again when they change on disk.
+     */
+    struct server
+    {
+        /**
+         * Constructs a compile server.
+         * @param logger The logger to log requests and errors to.
+         * @param settings The compiler settings; the server socket, manifests, and jobs are used for every request.
+         */
+        server(logging::logger& logger, compiler::settings const& settings);
+
+        /**
+         * Listens on the server socket and compiles requests until the server is stopped or interrupted.
+         * Requests are compiled in parallel, up to the number of jobs in the settings.
+         * @param interrupted The flag a signal handler sets to interrupt the server; it must be lock-free. Pass nullptr if there is none.
+         */
+        void run(std::atomic<bool> const* interrupted = nullptr);
+
+        /**
+         * Stops the server.
+         * This only sets a flag, so it is safe to call from another thread.
+         */
+        void stop();
+
+        /**
+         * Compiles a request.
+         * @param request The JSON request to compile.
+         * @param logger The logger to use for the compilation.
+         * @return Returns the JSON response for the request.
+         */
+        std::string compile(std::string const& request, logging::logger& logger);
+
+     private:
+        compiler::environment& environment(std::string const& name);
+        void serve(int socket, std::atomic<bool> const* interrupted);
+
+        logging::logger& _logger;
+        compiler::settings const& _settings;
+        std::atomic<bool> _stopped;
+        std::mutex _mutex;
+        std::unordered_map<std::string, std::unique_ptr<compiler::environment>> _environments;
+    };
+
+}}  // namespace puppet::compiler
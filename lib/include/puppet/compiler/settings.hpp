@@ -6,6 +6,7 @@
 
 #include "../facts/provider.hpp"
 #include "../logging/logger.hpp"
+#include "../runtime/engine.hpp"
 #include <string>
 #include <vector>
 #include <memory>
@@ -62,8 +63,58 @@ namespace puppet { namespace compiler {
          */
         std::vector<std::string> const& manifests() const;
 
+        /**
+         * Gets the number of jobs to use when parsing manifests or, in batch and serve modes, compiling nodes.
+         * Defaults to the number of hardware threads.
+         * @return Returns the number of jobs to use.
+         */
+        std::size_t jobs() const;
+
+        /**
+         * Gets the engine to use to evaluate expressions.
+         * Defaults to the tree walking engine.
+         * @return Returns the engine to use to evaluate expressions.
+         */
+        runtime::engine engine() const;
+
+        /**
+         * Gets whether or not the bodies of classes, defined types, and nodes are parsed when they are first evaluated.
+         * Defaults to false.
+         * @return Returns true if definition bodies are parsed lazily or false if they are parsed with the rest of the manifest.
+         */
+        bool lazy_parsing() const;
+
+        /**
+         * Gets the directory to cache parsed manifests in.
+         * Defaults to an empty string, which disables caching.
+         * @return Returns the cache directory.
+         */
+        std::string const& cache_directory() const;
+
+        /**
+         * Gets the directory of YAML facts files to compile catalogs for.
+         * Defaults to an empty string, which disables batch mode.
+         * @return Returns the batch directory.
+         */
+        std::string const& batch_directory() const;
+
+        /**
+         * Gets whether or not batch mode compiles nodes in forked worker processes rather than threads.
+         * Defaults to false.
+         * @return Returns true if nodes are compiled in worker processes or false if they are compiled in threads.
+         */
+        bool fork_workers() const;
+
+        /**
+         * Gets the path of the Unix domain socket to serve compilation requests on.
+         * Defaults to an empty string, which disables the compile server.
+         * @return Returns the server socket path.
+         */
+        std::string const& server_socket() const;
+
         /**
          * Gets the name of the node.
+         * Empty in batch and serve modes, where the name of each node comes from its facts.
          * Defaults to the 'fqdn' fact or calculated from the hostname and domain facts.
          * @return Returns the node name.
          */
@@ -71,13 +122,14 @@ namespace puppet { namespace compiler {
 
         /**
          * Gets the path to the output file.
+         * In batch mode, this is the directory to write each node's catalog to.
          * @return Returns the path to the output file.
          */
         std::string const& output_file() const;
 
         /**
          * Gets the facts provider to use.
-         * Defaults to the facter facts provider.
+         * Defaults to the facter facts provider; nullptr in batch and serve modes.
          * @return Returns the facts provider to use.
          */
         std::shared_ptr<facts::provider> const& facts() const;
@@ -134,6 +186,13 @@ namespace puppet { namespace compiler {
         std::string _environment_directory;
         std::vector<std::string> _module_directories;
         std::vector<std::string> _manifests;
+        std::size_t _jobs;
+        runtime::engine _engine;
+        bool _lazy_parsing;
+        std::string _cache_directory;
+        std::string _batch_directory;
+        bool _fork_workers;
+        std::string _server_socket;
         std::string _node_name;
         std::string _output_file;
         std::shared_ptr<facts::provider> _facts;
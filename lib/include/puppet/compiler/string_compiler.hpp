@@ -0,0 +1,27 @@
+/**
+ * @file
+ * Declares the string compiler.
+ */
+#pragma once
+
+#include "../ast/string.hpp"
+
+namespace puppet { namespace compiler {
+
+    /**
+     * Responsible for compiling AST strings into interpolated strings.
+     * Compilation applies escape sequences and heredoc margins and parses interpolated variables and expressions,
+     * so that evaluating the string only needs to evaluate the interpolations and concatenate the results.
+     */
+    struct string_compiler
+    {
+        /**
+         * Compiles the given string.
+         * Throws parse_exception if an interpolation in the string cannot be parsed.
+         * @param str The string to compile.
+         * @return Returns a copy of the string with the compiled form attached.
+         */
+        static ast::string compile(ast::string const& str);
+    };
+
+}}  // namespace puppet::compiler
@@ -29,6 +29,13 @@ namespace puppet { namespace facts {
          * @param callback The callback to call for each fact.
          */
         virtual void each(bool accessed, std::function<bool(std::string const&, std::shared_ptr<runtime::values::value const> const&)> const& callback) = 0;
+
+        /**
+         * Gets the name of the node the facts are for.
+         * The name is the node's FQDN from the 'networking' fact, the legacy 'fqdn' fact, or the legacy 'hostname' and 'domain' facts.
+         * @return Returns the name of the node or an empty string if the facts do not determine the name.
+         */
+        std::string node_name();
     };
 
 }}  // puppet::facts
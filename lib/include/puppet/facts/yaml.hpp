@@ -77,6 +77,12 @@ namespace puppet { namespace facts {
          */
         yaml(std::string const& path);
 
+        /**
+         * Constructs a YAML fact provider from an already parsed YAML (or JSON) map of facts.
+         * @param facts The map of fact names to fact values.
+         */
+        explicit yaml(YAML::Node const& facts);
+
         /**
          * Looks up a fact value by name.
          * @param name The name of the fact to look up.
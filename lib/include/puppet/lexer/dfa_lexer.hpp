@@ -0,0 +1,927 @@
+/**
+ * @file
+ * Declares the hand-written DFA lexer.
+ * This lexer produces the same tokens as the Spirit.Lex based lexer, but scans the input directly instead of
+ * going through lexertl's tables and semantic actions.
+ */
+#pragma once
+
+#include "lexer.hpp"
+#include <deque>
+#include <memory>
+#include <algorithm>
+#include <cstring>
+#include <boost/iterator/iterator_facade.hpp>
+
+namespace puppet { namespace lexer {
+
+    // Forward declaration of dfa_lexer
+    template <typename Iterator>
+    struct dfa_lexer;
+
+    /**
+     * The token iterator for the DFA lexer.
+     * Tokens are lexed on demand and buffered so the parser can backtrack over them.
+     * Like Spirit's multi_pass iterator, buffered tokens are released when an iterator is incremented and it is the only copy.
+     * @tparam Iterator The input iterator type.
+     */
+    template <typename Iterator>
+    struct dfa_token_iterator : boost::iterator_facade<dfa_token_iterator<Iterator>, lexer_token<Iterator> const, std::forward_iterator_tag>
+    {
+        /**
+         * The input iterator type.
+         */
+        typedef Iterator base_iterator_type;
+
+        /**
+         * The token type produced by the iterator.
+         */
+        typedef lexer_token<Iterator> token_type;
+
+        /**
+         * Constructs an end iterator.
+         */
+        dfa_token_iterator() :
+            _index(0)
+        {
+        }
+
+        /**
+         * Constructs a token iterator for the given input.
+         * @param lexer The lexer to use.
+         * @param first The beginning of the input; this iterator is advanced as tokens are lexed.
+         * @param last The end of the input.
+         */
+        dfa_token_iterator(dfa_lexer<Iterator> const& lexer, Iterator& first, Iterator const& last) :
+            _state(std::make_shared<state>(lexer, first, last)),
+            _index(0)
+        {
+        }
+
+     private:
+        friend class boost::iterator_core_access;
+
+        struct state
+        {
+            state(dfa_lexer<Iterator> const& lexer, Iterator& first, Iterator const& last) :
+                _lexer(lexer),
+                _current(first),
+                _last(last),
+                _offset(0),
+                _force_slash(false),
+                _done(false)
+            {
+            }
+
+            bool fill(std::size_t index)
+            {
+                while (_offset + _tokens.size() <= index) {
+                    if (_done) {
+                        return false;
+                    }
+                    token_type token;
+                    if (!_lexer.next(_current, _last, _force_slash, token)) {
+                        _done = true;
+                        return false;
+                    }
+                    _tokens.emplace_back(rvalue_cast(token));
+                }
+                return true;
+            }
+
+            token_type const& at(std::size_t index) const
+            {
+                return _tokens[index - _offset];
+            }
+
+            void release(std::size_t index)
+            {
+                for (; _offset < index && !_tokens.empty(); ++_offset) {
+                    _tokens.pop_front();
+                }
+            }
+
+         private:
+            dfa_lexer<Iterator> const& _lexer;
+            Iterator& _current;
+            Iterator _last;
+            std::deque<token_type> _tokens;
+            std::size_t _offset;
+            bool _force_slash;
+            bool _done;
+        };
+
+        token_type const& dereference() const
+        {
+            // Like the Spirit.Lex iterators, the end of the token stream dereferences to an end of input token
+            static const token_type eoi;
+            if (is_end()) {
+                return eoi;
+            }
+            return _state->at(_index);
+        }
+
+        void increment()
+        {
+            ++_index;
+
+            // If this is the only iterator, no one can go back to the previous tokens
+            if (_state && _state.use_count() == 1) {
+                _state->release(_index);
+            }
+        }
+
+        bool equal(dfa_token_iterator const& other) const
+        {
+            bool at_end = is_end();
+            bool other_at_end = other.is_end();
+            if (at_end || other_at_end) {
+                return at_end == other_at_end;
+            }
+            return _state == other._state && _index == other._index;
+        }
+
+        bool is_end() const
+        {
+            return !_state || !_state->fill(_index);
+        }
+
+        std::shared_ptr<state> _state;
+        std::size_t _index;
+    };
+
+    /**
+     * Implements a hand-written lexer for the Puppet language.
+     * The lexer is a switch-driven state machine that produces the same token ids, positions, and values as lexer<Base>.
+     * It can be used in place of the static lexer by the parser (see PUPPET_USE_DFA_LEXER).
+     * @tparam Iterator The input iterator type.
+     */
+    template <typename Iterator>
+    struct dfa_lexer
+    {
+        /**
+         * The type of token this lexer produces.
+         */
+        typedef lexer_token<Iterator> token_type;
+
+        /**
+         * The token id type.
+         */
+        typedef typename token_type::id_type id_type;
+
+        /**
+         * The type of iterator for the output token stream.
+         */
+        typedef dfa_token_iterator<Iterator> iterator_type;
+
+        /**
+         * The input stream iterator type.
+         */
+        typedef Iterator input_iterator_type;
+
+        /**
+         * The type of character for the input stream.
+         */
+        typedef char char_type;
+
+        /**
+         * The type of string for the input stream.
+         */
+        typedef std::basic_string<char_type> string_type;
+
+        /**
+         * The string token type.
+         */
+        typedef string_token<input_iterator_type> string_token_type;
+
+        /**
+         * Constructs a new lexer.
+         */
+        dfa_lexer() :
+            // The definitions match lexer<Base> so that parse errors describe the tokens the same way
+            single_quoted_string("'([^\\\\']|\\\\\\\\|\\\\.)*'",        static_cast<id_type>(token_id::single_quoted_string)),
+            double_quoted_string("\\\"([^\\\\\"]|\\\\\\\\|\\\\.)*\\\"", static_cast<id_type>(token_id::double_quoted_string)),
+            heredoc(LEXER_HEREDOC_PATTERN,                              static_cast<id_type>(token_id::heredoc)),
+            number("\\d\\w*(\\.\\d\\w*)?([eE]-?\\w*)?",                 static_cast<id_type>(token_id::number))
+        {
+            // Token definitions only match tokens in the state they were added to; bind them to the initial state
+            token_collector collector;
+            std::string state = "INITIAL";
+            std::string target;
+            single_quoted_string.collect(collector, state, target);
+            double_quoted_string.collect(collector, state, target);
+            heredoc.collect(collector, state, target);
+            number.collect(collector, state, target);
+        }
+
+        /**
+         * Gets the beginning token iterator for the given input.
+         * @param first The beginning of the input; this iterator is advanced as tokens are lexed.
+         * @param last The end of the input.
+         * @return Returns the beginning token iterator.
+         */
+        iterator_type begin(input_iterator_type& first, input_iterator_type const& last) const
+        {
+            return iterator_type(*this, first, last);
+        }
+
+        /**
+         * Gets the ending token iterator.
+         * @return Returns the ending token iterator.
+         */
+        iterator_type end() const
+        {
+            return iterator_type();
+        }
+
+        /**
+         * The token representing single quoted strings.
+         */
+        boost::spirit::lex::token_def<string_token_type> single_quoted_string;
+
+        /**
+         * The token representing double quoted strings.
+         */
+        boost::spirit::lex::token_def<string_token_type> double_quoted_string;
+
+        /**
+         * The token representing heredocs.
+         */
+        boost::spirit::lex::token_def<string_token_type> heredoc;
+
+        /**
+         * The token representing numbers.
+         */
+        boost::spirit::lex::token_def<number_token> number;
+
+     private:
+        friend struct dfa_token_iterator<Iterator>;
+
+        struct token_collector
+        {
+            std::size_t add_state(char const* state)
+            {
+                return 0;
+            }
+
+            id_type get_next_id()
+            {
+                return 0;
+            }
+
+            std::size_t add_token(char const* state, string_type const& definition, std::size_t id, char const* target)
+            {
+                return id;
+            }
+
+            std::size_t add_token(char const* state, char_type definition, std::size_t id, char const* target)
+            {
+                return id;
+            }
+        };
+
+        struct keyword
+        {
+            char const* text;
+            token_id id;
+        };
+
+        static bool is_space(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+        }
+
+        static bool is_digit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        static bool is_lower(char c)
+        {
+            return c >= 'a' && c <= 'z';
+        }
+
+        static bool is_upper(char c)
+        {
+            return c >= 'A' && c <= 'Z';
+        }
+
+        static bool is_word(char c)
+        {
+            return is_lower(c) || is_upper(c) || is_digit(c) || c == '_';
+        }
+
+        static bool peek(input_iterator_type const& it, input_iterator_type const& last, char c)
+        {
+            return it != last && *it == c;
+        }
+
+        static bool peek_next(input_iterator_type const& it, input_iterator_type const& last, char c)
+        {
+            if (it == last) {
+                return false;
+            }
+            auto next = it;
+            ++next;
+            return next != last && *next == c;
+        }
+
+        static std::size_t offset(input_iterator_type const& it)
+        {
+            return it.position().offset();
+        }
+
+        static token_id find_keyword(input_iterator_type const& begin, input_iterator_type const& end)
+        {
+            // Sorted by text for binary search
+            static const keyword keywords[] = {
+                { "and",      token_id::keyword_and },
+                { "attr",     token_id::keyword_attr },
+                { "case",     token_id::keyword_case },
+                { "class",    token_id::keyword_class },
+                { "contain",  token_id::statement_call },
+                { "debug",    token_id::statement_call },
+                { "default",  token_id::keyword_default },
+                { "define",   token_id::keyword_define },
+                { "else",     token_id::keyword_else },
+                { "elsif",    token_id::keyword_elsif },
+                { "err",      token_id::statement_call },
+                { "fail",     token_id::statement_call },
+                { "false",    token_id::keyword_false },
+                { "function", token_id::keyword_function },
+                { "if",       token_id::keyword_if },
+                { "import",   token_id::statement_call },
+                { "in",       token_id::keyword_in },
+                { "include",  token_id::statement_call },
+                { "info",     token_id::statement_call },
+                { "inherits", token_id::keyword_inherits },
+                { "node",     token_id::keyword_node },
+                { "notice",   token_id::statement_call },
+                { "or",       token_id::keyword_or },
+                { "private",  token_id::keyword_private },
+                { "realize",  token_id::statement_call },
+                { "require",  token_id::statement_call },
+                { "tag",      token_id::statement_call },
+                { "true",     token_id::keyword_true },
+                { "type",     token_id::keyword_type },
+                { "undef",    token_id::keyword_undef },
+                { "unless",   token_id::keyword_unless },
+                { "warning",  token_id::statement_call },
+            };
+
+            // The longest keyword is 8 characters
+            char buffer[9];
+            std::size_t length = 0;
+            for (auto it = begin; it != end; ++it) {
+                if (length == sizeof(buffer) - 1) {
+                    return token_id::name;
+                }
+                buffer[length++] = *it;
+            }
+            buffer[length] = '\0';
+
+            auto it = std::lower_bound(std::begin(keywords), std::end(keywords), buffer, [](keyword const& entry, char const* text) {
+                return std::strcmp(entry.text, text) < 0;
+            });
+            if (it == std::end(keywords) || std::strcmp(it->text, buffer) != 0) {
+                return token_id::name;
+            }
+            return it->id;
+        }
+
+        static bool scan_comment(input_iterator_type& it, input_iterator_type const& last)
+        {
+            // Matches /* ... */
+            if (!peek(it, last, '/') || !peek_next(it, last, '*')) {
+                return false;
+            }
+            auto current = it;
+            ++current;
+            ++current;
+            for (; current != last; ++current) {
+                if (*current == '*' && peek_next(current, last, '/')) {
+                    ++current;
+                    ++current;
+                    it = current;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static bool scan_slash(input_iterator_type& it, input_iterator_type const& last, input_iterator_type& slash)
+        {
+            // Matches the longest \s*(/*...*/\s*)*/ (see SLASH_CHECK_PATTERN in lexer<Base>)
+            bool found = false;
+            auto current = it;
+            while (true) {
+                for (; current != last && is_space(*current); ++current);
+                if (!peek(current, last, '/')) {
+                    break;
+                }
+
+                // A '/' here completes a match; a comment starting here may allow for a longer one
+                slash = current;
+                it = current;
+                ++it;
+                found = true;
+
+                if (!scan_comment(current, last)) {
+                    break;
+                }
+            }
+            return found;
+        }
+
+        static bool is_slash_next(input_iterator_type const& it, input_iterator_type const& last)
+        {
+            auto current = it;
+            input_iterator_type slash;
+            return scan_slash(current, last, slash);
+        }
+
+        static bool scan_regex(input_iterator_type& it, input_iterator_type const& last)
+        {
+            // Matches the longest (//)|(/[^*][^/\n]*/)
+            auto current = it;
+            ++current;
+            if (current == last || *current == '*') {
+                return false;
+            }
+
+            bool found = false;
+            if (*current == '/') {
+                it = current;
+                ++it;
+                found = true;
+            }
+
+            for (++current; current != last && *current != '/' && *current != '\n'; ++current);
+            if (current != last && *current == '/') {
+                it = ++current;
+                found = true;
+            }
+            return found;
+        }
+
+        static bool scan_string(input_iterator_type& it, input_iterator_type const& last, input_iterator_type& closing)
+        {
+            // Matches Q([^\\Q]|\\\\|\\.)*Q where Q is the quote character
+            auto quote = *it;
+            auto current = it;
+            for (++current; current != last; ++current) {
+                if (*current == '\\') {
+                    ++current;
+                    if (current == last) {
+                        return false;
+                    }
+                    continue;
+                }
+                if (*current == quote) {
+                    closing = current;
+                    it = ++current;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static bool scan_variable(input_iterator_type& it, input_iterator_type const& last)
+        {
+            // Matches \$(::)?(\w+::)*\w+
+            auto current = it;
+            ++current;
+            if (peek(current, last, ':') && peek_next(current, last, ':')) {
+                ++current;
+                ++current;
+            }
+            if (current == last || !is_word(*current)) {
+                return false;
+            }
+            while (true) {
+                for (; current != last && is_word(*current); ++current);
+                it = current;
+
+                // Continue only if the separator is followed by another word
+                if (!peek(current, last, ':') || !peek_next(current, last, ':')) {
+                    break;
+                }
+                ++current;
+                ++current;
+                if (current == last || !is_word(*current)) {
+                    break;
+                }
+            }
+            return true;
+        }
+
+        static bool scan_type(input_iterator_type& it, input_iterator_type const& last)
+        {
+            // Matches ((::)?[A-Z]\w*)+
+            bool found = false;
+            auto current = it;
+            while (true) {
+                if (peek(current, last, ':') && peek_next(current, last, ':')) {
+                    ++current;
+                    ++current;
+                }
+                if (current == last || !is_upper(*current)) {
+                    break;
+                }
+                for (++current; current != last && is_word(*current); ++current);
+                it = current;
+                found = true;
+            }
+            return found;
+        }
+
+        static bool scan_name(input_iterator_type& it, input_iterator_type const& last)
+        {
+            // Matches ((::)?[a-z]\w*)(::[a-z]\w*)*
+            bool found = false;
+            auto current = it;
+            if (peek(current, last, ':') && peek_next(current, last, ':')) {
+                ++current;
+                ++current;
+            }
+            while (current != last && is_lower(*current)) {
+                for (++current; current != last && is_word(*current); ++current);
+                it = current;
+                found = true;
+
+                if (!peek(current, last, ':') || !peek_next(current, last, ':')) {
+                    break;
+                }
+                ++current;
+                ++current;
+            }
+            return found;
+        }
+
+        static bool scan_bare_word(input_iterator_type& it, input_iterator_type const& last)
+        {
+            // Matches [a-z_]([\w\-]*[\w])?
+            auto current = it;
+            if (current == last || !(is_lower(*current) || *current == '_')) {
+                return false;
+            }
+            ++current;
+            it = current;
+            for (; current != last && (is_word(*current) || *current == '-'); ++current) {
+                if (*current != '-') {
+                    it = current;
+                    ++it;
+                }
+            }
+            return true;
+        }
+
+        static bool scan_number(input_iterator_type& it, input_iterator_type const& last)
+        {
+            // Matches the longest \d\w*(\.\d\w*)?([eE]-?\w*)?
+            auto current = it;
+            if (current == last || !is_digit(*current)) {
+                return false;
+            }
+
+            // A '-' can only follow an exponent character at the end of a word run
+            auto scan_word = [&](input_iterator_type& position) {
+                char previous = *position;
+                for (++position; position != last && is_word(*position); ++position) {
+                    previous = *position;
+                }
+                if ((previous == 'e' || previous == 'E') && peek(position, last, '-')) {
+                    for (++position; position != last && is_word(*position); ++position);
+                    return true;
+                }
+                return false;
+            };
+
+            // The exponent must be last, so stop if one was consumed
+            bool exponent = scan_word(current);
+            if (!exponent && peek(current, last, '.')) {
+                auto next = current;
+                ++next;
+                if (next != last && is_digit(*next)) {
+                    scan_word(next);
+                    current = next;
+                }
+            }
+            it = current;
+            return true;
+        }
+
+        static bool scan_heredoc(input_iterator_type& it, input_iterator_type const& last)
+        {
+            static const std::regex pattern(LEXER_HEREDOC_PATTERN);
+
+            // A heredoc can't contain ')' before the closing one, so only the first ')' can end a match
+            if (!peek_next(it, last, '(')) {
+                return false;
+            }
+            auto current = it;
+            for (; current != last && *current != ')'; ++current);
+            if (current == last) {
+                return false;
+            }
+            ++current;
+
+            if (!std::regex_match(string_type(it, current), pattern)) {
+                return false;
+            }
+            it = current;
+            return true;
+        }
+
+        void emit(token_type& token, id_type id, input_iterator_type const& start, input_iterator_type const& end) const
+        {
+            token = token_type(id, 0, start, end);
+        }
+
+        void emit(token_type& token, token_id id, input_iterator_type const& start, input_iterator_type const& end) const
+        {
+            emit(token, static_cast<id_type>(id), start, end);
+        }
+
+        bool next(input_iterator_type& current, input_iterator_type const& last, bool& force_slash, token_type& token) const
+        {
+            while (current != last) {
+                auto start = current;
+
+                // The previous token can't be followed by a regex, so the next '/' is a division operator
+                if (force_slash) {
+                    force_slash = false;
+
+                    input_iterator_type slash;
+                    if (scan_slash(current, last, slash)) {
+                        emit(token, '/', slash, current);
+                        return true;
+                    }
+                }
+
+                bool no_regex = false;
+                char c = *current;
+                switch (c) {
+                    case ' ':
+                    case '\t':
+                    case '\n':
+                    case '\r':
+                    case '\f':
+                    case '\v':
+                        for (++current; current != last && is_space(*current); ++current);
+
+                        // Whitespace followed by '[' starts an array rather than an access expression
+                        if (peek(current, last, '[')) {
+                            start = current;
+                            emit(token, token_id::array_start, start, ++current);
+                            return true;
+                        }
+                        continue;
+
+                    case '#':
+                        for (++current; current != last && *current != '\n'; ++current);
+                        continue;
+
+                    case '/':
+                        if (scan_comment(current, last)) {
+                            continue;
+                        }
+                        if (scan_regex(current, last)) {
+                            emit(token, token_id::regex, start, current);
+                            no_regex = true;
+                            break;
+                        }
+                        emit(token, '/', start, ++current);
+                        break;
+
+                    case '\'':
+                    case '"': {
+                        input_iterator_type closing;
+                        if (!scan_string(current, last, closing)) {
+                            emit(token, token_id::unclosed_quote, start, ++current);
+                            break;
+                        }
+                        auto begin = start;
+                        ++begin;
+                        if (c == '\'') {
+                            emit(token, token_id::single_quoted_string, start, current);
+                            token.value() = string_token_type(start.position(), rvalue_cast(begin), rvalue_cast(closing), "\\'", '\'', false);
+                        } else {
+                            emit(token, token_id::double_quoted_string, start, current);
+                            token.value() = string_token_type(start.position(), rvalue_cast(begin), rvalue_cast(closing), "\\\"'nrtsu$", '"');
+                        }
+                        no_regex = true;
+                        break;
+                    }
+
+                    case '@':
+                        if (scan_heredoc(current, last)) {
+                            // The slash check is done before the heredoc lines are skipped
+                            force_slash = is_slash_next(current, last);
+                            emit(token, token_id::heredoc, start, current);
+                            token.value() = make_heredoc_token(start, current, last);
+                            return true;
+                        }
+                        if (peek_next(current, last, '@')) {
+                            ++current;
+                            emit(token, token_id::atat, start, ++current);
+                            break;
+                        }
+                        emit(token, '@', start, ++current);
+                        break;
+
+                    case '$':
+                        if (scan_variable(current, last)) {
+                            emit(token, token_id::variable, start, current);
+                            break;
+                        }
+                        emit(token, token_id::unknown, start, ++current);
+                        break;
+
+                    case ':':
+                        if (scan_type(current, last)) {
+                            emit(token, token_id::type, start, current);
+                            no_regex = true;
+                            break;
+                        }
+                        if (scan_name(current, last)) {
+                            emit(token, token_id::name, start, current);
+                            no_regex = true;
+                            break;
+                        }
+                        emit(token, ':', start, ++current);
+                        break;
+
+                    case '[':
+                    case '{':
+                    case '}':
+                    case '(':
+                    case '*':
+                    case '%':
+                    case '.':
+                    case ',':
+                    case ';':
+                    case '?':
+                        emit(token, static_cast<id_type>(c), start, ++current);
+                        break;
+
+                    case ']':
+                    case ')':
+                        emit(token, static_cast<id_type>(c), start, ++current);
+                        no_regex = true;
+                        break;
+
+                    case '<':
+                        ++current;
+                        if (peek(current, last, '<')) {
+                            ++current;
+                            if (peek(current, last, '|')) {
+                                emit(token, token_id::left_double_collect, start, ++current);
+                            } else {
+                                emit(token, token_id::left_shift, start, current);
+                            }
+                        } else if (peek(current, last, '=')) {
+                            emit(token, token_id::less_equals, start, ++current);
+                        } else if (peek(current, last, '|')) {
+                            emit(token, token_id::left_collect, start, ++current);
+                        } else if (peek(current, last, '-')) {
+                            emit(token, token_id::out_edge, start, ++current);
+                        } else if (peek(current, last, '~')) {
+                            emit(token, token_id::out_edge_sub, start, ++current);
+                        } else {
+                            emit(token, '<', start, current);
+                        }
+                        break;
+
+                    case '|':
+                        ++current;
+                        if (peek(current, last, '>')) {
+                            ++current;
+                            if (peek(current, last, '>')) {
+                                emit(token, token_id::right_double_collect, start, ++current);
+                            } else {
+                                emit(token, token_id::right_collect, start, current);
+                            }
+                            no_regex = true;
+                        } else {
+                            emit(token, '|', start, current);
+                        }
+                        break;
+
+                    case '>':
+                        ++current;
+                        if (peek(current, last, '=')) {
+                            emit(token, token_id::greater_equals, start, ++current);
+                        } else if (peek(current, last, '>')) {
+                            emit(token, token_id::right_shift, start, ++current);
+                        } else {
+                            emit(token, '>', start, current);
+                        }
+                        break;
+
+                    case '=':
+                        ++current;
+                        if (peek(current, last, '=')) {
+                            emit(token, token_id::equals, start, ++current);
+                        } else if (peek(current, last, '~')) {
+                            emit(token, token_id::match, start, ++current);
+                        } else if (peek(current, last, '>')) {
+                            emit(token, token_id::fat_arrow, start, ++current);
+                        } else {
+                            emit(token, '=', start, current);
+                        }
+                        break;
+
+                    case '!':
+                        ++current;
+                        if (peek(current, last, '=')) {
+                            emit(token, token_id::not_equals, start, ++current);
+                        } else if (peek(current, last, '~')) {
+                            emit(token, token_id::not_match, start, ++current);
+                        } else {
+                            emit(token, '!', start, current);
+                        }
+                        break;
+
+                    case '+':
+                        ++current;
+                        if (peek(current, last, '=')) {
+                            emit(token, token_id::append, start, ++current);
+                        } else if (peek(current, last, '>')) {
+                            emit(token, token_id::plus_arrow, start, ++current);
+                        } else {
+                            emit(token, '+', start, current);
+                        }
+                        break;
+
+                    case '-':
+                        ++current;
+                        if (peek(current, last, '=')) {
+                            emit(token, token_id::remove, start, ++current);
+                        } else if (peek(current, last, '>')) {
+                            emit(token, token_id::in_edge, start, ++current);
+                        } else {
+                            emit(token, '-', start, current);
+                        }
+                        break;
+
+                    case '~':
+                        ++current;
+                        if (peek(current, last, '>')) {
+                            emit(token, token_id::in_edge_sub, start, ++current);
+                        } else {
+                            emit(token, '~', start, current);
+                        }
+                        break;
+
+                    default:
+                        if (is_digit(c)) {
+                            scan_number(current, last);
+                            emit(token, token_id::number, start, current);
+                            token.value() = make_number_token(start, current);
+                            no_regex = true;
+                            break;
+                        }
+                        if (is_upper(c)) {
+                            scan_type(current, last);
+                            emit(token, token_id::type, start, current);
+                            no_regex = true;
+                            break;
+                        }
+                        if (is_lower(c) || c == '_') {
+                            // Longest match wins; on a tie, keywords win over names and names win over bare words
+                            auto name_end = current;
+                            bool name = scan_name(name_end, last);
+                            auto word_end = current;
+                            scan_bare_word(word_end, last);
+                            if (name && offset(name_end) >= offset(word_end)) {
+                                current = name_end;
+                                auto id = find_keyword(start, current);
+                                emit(token, id, start, current);
+                                no_regex = id == token_id::name || id == token_id::keyword_true || id == token_id::keyword_false;
+                                break;
+                            }
+                            current = word_end;
+                            emit(token, token_id::bare_word, start, current);
+                            no_regex = true;
+                            break;
+                        }
+                        emit(token, token_id::unknown, start, ++current);
+                        break;
+                }
+
+                if (no_regex) {
+                    force_slash = is_slash_next(current, last);
+                }
+                return true;
+            }
+            return false;
+        }
+    };
+
+    /**
+     * The DFA lexer to use for strings and source buffers.
+     */
+    typedef dfa_lexer<lexer_string_iterator> string_dfa_lexer;
+
+}}  // namespace puppet::lexer
@@ -9,6 +9,7 @@
 #include "token_id.hpp"
 #include "string_token.hpp"
 #include "number_token.hpp"
+#include "source_buffer.hpp"
 #include "../cast.hpp"
 #include <string>
 #include <locale>
@@ -20,6 +21,7 @@
 #include <tuple>
 #include <regex>
 #include <limits>
+#include <algorithm>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/spirit/include/lex_lexer.hpp>
 #include <boost/spirit/include/lex_lexertl.hpp>
@@ -37,6 +39,16 @@ namespace puppet { namespace lexer {
      */
     constexpr const int LEXER_TAB_WIDTH = 4;
 
+    /**
+     * The pattern for heredoc tokens (the "@(...)" part of the heredoc).
+     */
+    constexpr char const* const LEXER_HEREDOC_PATTERN = "@\\(\\s*([^):/\\r\\n]+)\\s*(:\\s*([a-z][a-zA-Z0-9_+]+))?\\s*(\\/\\s*([\\w|$]*)\\s*)?\\)";
+
+    /**
+     * The escapes allowed in a heredoc.
+     */
+    constexpr char const* const LEXER_HEREDOC_ESCAPES = "trnsuL$";
+
     /**
      * Exception for lexer errors.
      * @tparam Iterator The location iterator type.
@@ -68,6 +80,10 @@ namespace puppet { namespace lexer {
         Iterator _location;
     };
 
+    // Forward declaration of make_heredoc_token
+    template <typename Iterator>
+    string_token<Iterator> make_heredoc_token(Iterator const& start, Iterator& end, Iterator const& eoi);
+
     /**
      * Lexer iterator type used to support heredoc parsing.
      * Heredocs require a more complicated iterator type due to the fact heredoc lines are parsed out-of-order.
@@ -117,6 +133,7 @@ namespace puppet { namespace lexer {
     private:
         friend class boost::iterator_core_access;
         template <typename Base> friend struct lexer;
+        template <typename Input> friend string_token<Input> make_heredoc_token(Input const&, Input&, Input const&);
 
         void set_next(lexer_iterator<Iterator> const& next)
         {
@@ -163,6 +180,229 @@ namespace puppet { namespace lexer {
         lexer::position _next_position;
     };
 
+    /**
+     * Makes the string token for a heredoc.
+     * The lines of the heredoc are skipped by the iterator once the end of the heredoc's line is reached.
+     * @tparam Iterator The lexer iterator type.
+     * @param start The start of the heredoc token (the "@(...)" part).
+     * @param end The end of the heredoc token; this is updated to skip over the heredoc's lines.
+     * @param eoi The end of the input.
+     * @return Returns the string token for the heredoc.
+     */
+    template <typename Iterator>
+    string_token<Iterator> make_heredoc_token(Iterator const& start, Iterator& end, Iterator const& eoi)
+    {
+        using namespace std;
+
+        typedef basic_string<typename Iterator::value_type> string_type;
+
+        static const regex pattern(LEXER_HEREDOC_PATTERN);
+
+        // Helper functions
+        static auto is_space = [](char c) { return c == ' ' || c == '\t'; };
+        static auto throw_not_found = [](Iterator const& location, std::string const& tag) {
+            throw lexer_exception<Iterator>(location, (boost::format("unexpected end of input while looking for heredoc end tag '%1%'.") % tag).str());
+        };
+        static auto move_next_line = [](Iterator& begin, Iterator const& end) -> bool {
+            for (; begin != end && *begin != '\n'; ++begin);
+            if (begin == end) {
+                return false;
+            }
+
+            // Move past the newline
+            ++begin;
+            return true;
+        };
+
+        // regex needs bi-directional iterators, so we need to copy the token range (just the @(...) part)
+        string_type token(start, end);
+
+        // Extract the tag, format, and escapes from the token
+        match_results<typename string_type::const_iterator> match;
+        if (!regex_match(token, match, pattern) || match.size() != 6) {
+            throw lexer_exception<Iterator>(start, "unexpected heredoc format.");
+        }
+
+        // Trim the tag
+        string_type tag(match[1].first, match[1].second);
+        boost::trim(tag);
+
+        // Check for interpolation
+        bool interpolated = false;
+        if (boost::starts_with(tag, "\"") && boost::ends_with(tag, "\"")) {
+            interpolated = true;
+            boost::trim_if(tag, boost::is_any_of("\""));
+        }
+
+        // Check for optional format
+        string_type format;
+        if (match[2].first != match[2].second) {
+            format.assign(match[3].first, match[3].second);
+        }
+
+        // Check for optional escapes
+        string_type escapes;
+        if (match[4].first != match[4].second) {
+            escapes.assign(match[5].first, match[5].second);
+            if (escapes.empty()) {
+                // Enable all heredoc escapes
+                escapes = LEXER_HEREDOC_ESCAPES;
+            } else {
+                // Verify the escapes
+                if (!boost::all(escapes, boost::is_any_of(LEXER_HEREDOC_ESCAPES))) {
+                    throw lexer_exception<Iterator>(start, (boost::format("invalid heredoc escapes '%1%': only t, r, n, s, u, L, and $ are allowed.") % escapes).str());
+                }
+                // TODO: verify uniqueness of each character (i.e. is this really important)?
+            }
+
+            // Treat L as "escaping newlines"
+            boost::replace_all(escapes, "L", "\n");
+
+            // Escaping automatically adds '\' to the list
+            escapes += "\\";
+        }
+
+        // Move to the next line to process, skipping over any previous heredoc on the token's line
+        Iterator doc_begin;
+        if (!start.get_next(doc_begin)) {
+            doc_begin = end;
+            if (!move_next_line(doc_begin, eoi)) {
+                throw_not_found(start, tag);
+            }
+        }
+
+        bool remove_break = false;
+        int margin = 0;
+        auto doc_end = doc_begin;
+
+        // Search for the end tag
+        while (doc_end != eoi) {
+            auto line_end = doc_end;
+            for (; line_end != end && is_space(*line_end); ++line_end) {
+                margin += (*line_end == ' ') ? 1 : LEXER_TAB_WIDTH;
+            }
+            if (line_end == eoi) {
+                throw_not_found(start, tag);
+            }
+            if (*line_end == '|') {
+                for (++line_end; line_end != end && is_space(*line_end); ++line_end);
+            }
+            if (line_end == eoi) {
+                throw_not_found(start, tag);
+            }
+            if (*line_end == '-') {
+                remove_break = true;
+                for (++line_end; line_end != end && is_space(*line_end); ++line_end);
+            }
+            if (line_end == eoi) {
+                throw_not_found(start, tag);
+            }
+
+            // Look for the end tag
+            auto search_it = tag.begin();
+            for (; line_end != eoi && search_it != tag.end() && *search_it == *line_end; ++search_it, ++line_end);
+            if (search_it == tag.end()) {
+                // Possibly found the tag; ensure the remainder of the line is whitespace
+                for (; line_end != eoi && is_space(*line_end); ++line_end);
+                if (line_end != eoi && *line_end == '\r') {
+                    ++line_end;
+                }
+                if (line_end == eoi || *line_end == '\n') {
+                    break;
+                }
+
+                // Not found
+            }
+
+            // Move to the next line
+            move_next_line(line_end, eoi);
+            doc_end = line_end;
+            margin = 0;
+        }
+
+        if (doc_end == eoi) {
+            throw_not_found(start, tag);
+        }
+
+        auto next = doc_end;
+        move_next_line(next, eoi);
+        end.set_next(next);
+        return string_token<Iterator>(doc_begin.position(), doc_begin, rvalue_cast(doc_end), rvalue_cast(escapes), 0, interpolated, rvalue_cast(format), margin, remove_break);
+    }
+
+    /**
+     * Makes the number token for the given range.
+     * @tparam Iterator The lexer iterator type.
+     * @param start The start of the number token.
+     * @param end The end of the number token.
+     * @return Returns the number token.
+     */
+    template <typename Iterator>
+    number_token make_number_token(Iterator const& start, Iterator const& end)
+    {
+        using namespace std;
+
+        typedef basic_string<typename Iterator::value_type> string_type;
+
+        static const regex hex_pattern("0[xX][0-9A-Fa-f]+");
+        static const regex octal_pattern("0\\d+");
+        static const regex valid_octal_pattern("0[0-7]+");
+        static const regex decimal_pattern("0|([1-9]\\d*)");
+        static const regex double_pattern("[0-9]\\d*(\\.\\d+)?([eE]-?\\d+)?");
+
+        // regex needs bi-directional iterators, so we need to copy the token range
+        string_type token(start, end);
+
+        // Short decimal integers are the most common numbers and cannot overflow, so skip the regexes for them
+        if (token.size() < static_cast<size_t>(numeric_limits<int64_t>::digits10) && (token[0] != '0' || token.size() == 1) && all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            return number_token(start.position(), stoll(token), numeric_base::decimal);
+        }
+
+        // Match integral numbers
+        int base = 0;
+        if (regex_match(token, hex_pattern)) {
+            base = 16;
+        } else if (regex_match(token, octal_pattern)) {
+            // Make sure the number is valid for an octal
+            if (!regex_match(token, valid_octal_pattern)) {
+                throw lexer_exception<Iterator>(start, (boost::format("'%1%' is not a valid number.") % token).str());
+            }
+            base = 8;
+        } else if (regex_match(token, decimal_pattern)) {
+            base = 10;
+        }
+
+        if (base != 0) {
+            try {
+                return number_token(start.position(), stoll(token, 0, base), base == 16 ? numeric_base::hexadecimal : (base == 8 ? numeric_base::octal : numeric_base::decimal));
+            } catch (out_of_range const& ex) {
+                throw lexer_exception<Iterator>(start,
+                    (boost::format("'%1%' is not in the range of %2% to %3%.") %
+                        token %
+                        numeric_limits<int64_t>::min() %
+                        numeric_limits<int64_t>::max()
+                    ).str());
+            }
+        }
+
+        // Match double
+        if (regex_match(token, double_pattern)) {
+            try {
+                return number_token(start.position(), stold(token, 0));
+            } catch (out_of_range const& ex) {
+                throw lexer_exception<Iterator>(start,
+                    (boost::format("'%1%' is not in the range of %2% to %3%.") %
+                        token %
+                        numeric_limits<long double>::min() %
+                        numeric_limits<long double>::max()
+                    ).str());
+            }
+        }
+
+        // Not a valid number
+        throw lexer_exception<Iterator>(start, (boost::format("'%1%' is not a valid number.") % token).str());
+    }
+
     /**
      * Implements the lexer for the Puppet language.
      * The lexer is responsible for producing a stream of tokens for parsing.
@@ -217,7 +457,7 @@ namespace puppet { namespace lexer {
         lexer() :
             single_quoted_string("'([^\\\\']|\\\\\\\\|\\\\.)*'",        static_cast<id_type>(token_id::single_quoted_string)),
             double_quoted_string("\\\"([^\\\\\"]|\\\\\\\\|\\\\.)*\\\"", static_cast<id_type>(token_id::double_quoted_string)),
-            heredoc(HEREDOC_PATTERN,                                    static_cast<id_type>(token_id::heredoc)),
+            heredoc(LEXER_HEREDOC_PATTERN,                              static_cast<id_type>(token_id::heredoc)),
             number("\\d\\w*(\\.\\d\\w*)?([eE]-?\\w*)?",                 static_cast<id_type>(token_id::number))
         {
             namespace lex = boost::spirit::lex;
@@ -374,145 +614,10 @@ namespace puppet { namespace lexer {
 
         void parse_heredoc(input_iterator_type const& start, input_iterator_type& end, boost::spirit::lex::pass_flags& matched, id_type& id, context_type& context)
         {
-            using namespace std;
-
-            static const regex pattern(HEREDOC_PATTERN);
-
             // Force any following '/' to be interpreted as a '/' token
             force_slash(context);
 
-            // Helper functions
-            static auto is_space = [](char c) { return c == ' ' || c == '\t'; };
-            static auto throw_not_found = [](input_iterator_type const& location, std::string const& tag) {
-                throw lexer_exception<input_iterator_type>(location, (boost::format("unexpected end of input while looking for heredoc end tag '%1%'.") % tag).str());
-            };
-            static auto move_next_line = [](input_iterator_type& begin, input_iterator_type const& end) -> bool {
-                for (; begin != end && *begin != '\n'; ++begin);
-                if (begin == end) {
-                    return false;
-                }
-
-                // Move past the newline
-                ++begin;
-                return true;
-            };
-
-            // regex needs bi-directional iterators, so we need to copy the token range (just the @(...) part)
-            string_type token(start, end);
-
-            // Extract the tag, format, and escapes from the token
-            match_results<typename string_type::const_iterator> match;
-            if (!regex_match(token, match, pattern) || match.size() != 6) {
-                throw lexer_exception<input_iterator_type>(start, "unexpected heredoc format.");
-            }
-
-            // Trim the tag
-            string_type tag(match[1].first, match[1].second);
-            boost::trim(tag);
-
-            // Check for interpolation
-            bool interpolated = false;
-            if (boost::starts_with(tag, "\"") && boost::ends_with(tag, "\"")) {
-                interpolated = true;
-                boost::trim_if(tag, boost::is_any_of("\""));
-            }
-
-            // Check for optional format
-            string_type format;
-            if (match[2].first != match[2].second) {
-                format.assign(match[3].first, match[3].second);
-            }
-
-            // Check for optional escapes
-            string_type escapes;
-            if (match[4].first != match[4].second) {
-                escapes.assign(match[5].first, match[5].second);
-                if (escapes.empty()) {
-                    // Enable all heredoc escapes
-                    escapes = HEREDOC_ESCAPES;
-                } else {
-                    // Verify the escapes
-                    if (!boost::all(escapes, boost::is_any_of(HEREDOC_ESCAPES))) {
-                        throw lexer_exception<input_iterator_type>(start, (boost::format("invalid heredoc escapes '%1%': only t, r, n, s, u, L, and $ are allowed.") % escapes).str());
-                    }
-                    // TODO: verify uniqueness of each character (i.e. is this really important)?
-                }
-
-                // Treat L as "escaping newlines"
-                boost::replace_all(escapes, "L", "\n");
-
-                // Escaping automatically adds '\' to the list
-                escapes += "\\";
-            }
-
-            auto& eoi = context.get_eoi();
-
-            // Move to the next line to process, skipping over any previous heredoc on the token's line
-            input_iterator_type doc_begin;
-            if (!start.get_next(doc_begin)) {
-                doc_begin = end;
-                if (!move_next_line(doc_begin, eoi)) {
-                    throw_not_found(start, tag);
-                }
-            }
-
-            bool remove_break = false;
-            int margin = 0;
-            auto doc_end = doc_begin;
-
-            // Search for the end tag
-            while (doc_end != eoi) {
-                auto line_end = doc_end;
-                for (; line_end != end && is_space(*line_end); ++line_end) {
-                    margin += (*line_end == ' ') ? 1 : LEXER_TAB_WIDTH;
-                }
-                if (line_end == eoi) {
-                    throw_not_found(start, tag);
-                }
-                if (*line_end == '|') {
-                    for (++line_end; line_end != end && is_space(*line_end); ++line_end);
-                }
-                if (line_end == eoi) {
-                    throw_not_found(start, tag);
-                }
-                if (*line_end == '-') {
-                    remove_break = true;
-                    for (++line_end; line_end != end && is_space(*line_end); ++line_end);
-                }
-                if (line_end == eoi) {
-                    throw_not_found(start, tag);
-                }
-
-                // Look for the end tag
-                auto search_it = tag.begin();
-                for (; line_end != eoi && search_it != tag.end() && *search_it == *line_end; ++search_it, ++line_end);
-                if (search_it == tag.end()) {
-                    // Possibly found the tag; ensure the remainder of the line is whitespace
-                    for (; line_end != eoi && is_space(*line_end); ++line_end);
-                    if (line_end != eoi && *line_end == '\r') {
-                        ++line_end;
-                    }
-                    if (line_end == eoi || *line_end == '\n') {
-                        break;
-                    }
-
-                    // Not found
-                }
-
-                // Move to the next line
-                move_next_line(line_end, eoi);
-                doc_end = line_end;
-                margin = 0;
-            }
-
-            if (doc_end == eoi) {
-                throw_not_found(start, tag);
-            }
-
-            auto next = doc_end;
-            move_next_line(next, eoi);
-            end.set_next(next);
-            context.set_value(string_token_type(doc_begin.position(), doc_begin, rvalue_cast(doc_end), rvalue_cast(escapes), 0, interpolated, rvalue_cast(format), margin, remove_break));
+            context.set_value(make_heredoc_token(start, end, context.get_eoi()));
         }
 
         void parse_single_quoted_string(input_iterator_type start, input_iterator_type const& end, boost::spirit::lex::pass_flags& matched, id_type& id, context_type& context)
@@ -547,65 +652,10 @@ namespace puppet { namespace lexer {
 
         static void parse_number(input_iterator_type const& start, input_iterator_type const& end, boost::spirit::lex::pass_flags& matched, id_type& id, context_type& context)
         {
-            using namespace std;
-
-            static const regex hex_pattern("0[xX][0-9A-Fa-f]+");
-            static const regex octal_pattern("0\\d+");
-            static const regex valid_octal_pattern("0[0-7]+");
-            static const regex decimal_pattern("0|([1-9]\\d*)");
-            static const regex double_pattern("[0-9]\\d*(\\.\\d+)?([eE]-?\\d+)?");
-
             // Force any following '/' to be interpreted as a '/' token
             force_slash(context);
 
-            // regex needs bi-directional iterators, so we need to copy the token range
-            string_type token(start, end);
-
-            // Match integral numbers
-            int base = 0;
-            if (regex_match(token, hex_pattern)) {
-                base = 16;
-            } else if (regex_match(token, octal_pattern)) {
-                // Make sure the number is valid for an octal
-                if (!regex_match(token, valid_octal_pattern)) {
-                    throw lexer_exception<input_iterator_type>(start, (boost::format("'%1%' is not a valid number.") % token).str());
-                }
-                base = 8;
-            } else if (regex_match(token, decimal_pattern)) {
-                base = 10;
-            }
-
-            if (base != 0) {
-                try {
-                    context.set_value(number_token(start.position(), stoll(token, 0, base), base == 16 ? numeric_base::hexadecimal : (base == 8 ? numeric_base::octal : numeric_base::decimal)));
-                } catch (out_of_range const& ex) {
-                    throw lexer_exception<input_iterator_type>(start,
-                        (boost::format("'%1%' is not in the range of %2% to %3%.") %
-                            token %
-                            numeric_limits<int64_t>::min() %
-                            numeric_limits<int64_t>::max()
-                        ).str());
-                }
-                return;
-            }
-
-            // Match double
-            if (regex_match(token, double_pattern)) {
-                try {
-                    context.set_value(number_token(start.position(), stold(token, 0)));
-                } catch (out_of_range const& ex) {
-                    throw lexer_exception<input_iterator_type>(start,
-                        (boost::format("'%1%' is not in the range of %2% to %3%.") %
-                            token %
-                            numeric_limits<long double>::min() %
-                            numeric_limits<long double>::max()
-                        ).str());
-                }
-                return;
-            }
-
-            // Not a valid number
-            throw lexer_exception<input_iterator_type>(start, (boost::format("'%1%' is not a valid number.") % token).str());
+            context.set_value(make_number_token(start, end));
         }
 
         static void no_regex(input_iterator_type const& start, input_iterator_type const& end, boost::spirit::lex::pass_flags& matched, id_type& id, context_type& context)
@@ -634,17 +684,11 @@ namespace puppet { namespace lexer {
             start = last;
         }
 
-        static const char* const HEREDOC_PATTERN;
-        static const char* const HEREDOC_ESCAPES;
         static const char* const FORCE_SLASH_STATE;
         static const char* const SLASH_CHECK_STATE;
         static const char* const SLASH_CHECK_PATTERN;
     };
 
-    template<typename Base>
-    char const* const lexer<Base>::HEREDOC_PATTERN = "@\\(\\s*([^):/\\r\\n]+)\\s*(:\\s*([a-z][a-zA-Z0-9_+]+))?\\s*(\\/\\s*([\\w|$]*)\\s*)?\\)";
-    template<typename Base>
-    char const* const lexer<Base>::HEREDOC_ESCAPES = "trnsuL$";
     template<typename Base>
     char const* const lexer<Base>::FORCE_SLASH_STATE = "FS";
     template<typename Base>
@@ -657,9 +701,9 @@ namespace puppet { namespace lexer {
      */
     typedef lexer_iterator<boost::spirit::multi_pass<std::istreambuf_iterator<char>>> lexer_istreambuf_iterator;
     /**
-     * The input iterator for strings.
+     * The input iterator for strings and source buffers.
      */
-    typedef lexer_iterator<typename std::string::const_iterator> lexer_string_iterator;
+    typedef lexer_iterator<char const*> lexer_string_iterator;
 
     /**
      * The token type for the lexer.
@@ -715,6 +759,20 @@ namespace puppet { namespace lexer {
      */
     lexer_string_iterator lex_end(std::string const& str);
 
+    /**
+     * Gets the lexer's beginning iterator for the given source buffer.
+     * @param buffer The source buffer to lex.
+     * @return Returns the beginning input iterator for the lexer.
+     */
+    lexer_string_iterator lex_begin(source_buffer const& buffer);
+
+    /**
+     * Gets the lexer's ending iterator for the given source buffer.
+     * @param buffer The source buffer to lex.
+     * @return Returns the ending input iterator for the lexer.
+     */
+    lexer_string_iterator lex_end(source_buffer const& buffer);
+
     /**
      * Gets the lexer's beginning iterator for the given iterator range.
      * @param range The iterator range to parse.
@@ -747,6 +805,15 @@ namespace puppet { namespace lexer {
      */
     std::tuple<std::string, std::size_t> get_text_and_column(std::string const& input, std::size_t position, std::size_t tab_width = LEXER_TAB_WIDTH);
 
+    /**
+     * Gets the text and column for the given position in a source buffer.
+     * @param buffer The source buffer to get the line and position in.
+     * @param position The position inside the source buffer.
+     * @param tab_width Specifies the width of a tab character for column calculations.
+     * @return Returns a tuple of the line's text and the column of the position.
+     */
+    std::tuple<std::string, std::size_t> get_text_and_column(source_buffer const& buffer, std::size_t position, std::size_t tab_width = LEXER_TAB_WIDTH);
+
     /**
      * Gets the last position for the given file stream.
      * @param input The input file stream.
@@ -761,6 +828,13 @@ namespace puppet { namespace lexer {
      */
     position get_last_position(std::string const& input);
 
+    /**
+     * Gets the last position for the given source buffer.
+     * @param buffer The source buffer.
+     * @return Returns the last position in the source buffer.
+     */
+    position get_last_position(source_buffer const& buffer);
+
     /**
      * Gets the last position for the given input string iterator range.
      * @param input The input string iterator range.
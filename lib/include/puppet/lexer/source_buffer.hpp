@@ -0,0 +1,95 @@
+/**
+ * @file
+ * Declares the source buffer used to lex files.
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <stdexcept>
+
+namespace puppet { namespace lexer {
+
+    /**
+     * Exception for source buffer errors.
+     */
+    struct source_exception : std::runtime_error
+    {
+        /**
+         * Constructs a source exception.
+         * @param message The exception message.
+         */
+        explicit source_exception(std::string const& message);
+    };
+
+    /**
+     * Represents the contents of a source file mapped or copied into memory.
+     * By default the file is mapped once and lexed directly from the mapping; the file handle is closed as soon as the mapping exists.
+     * A mapping shows later changes to the file and faults if the file is truncated, so buffers that are read long after
+     * they are created should copy the file instead.
+     * The offsets of the start of each line are indexed when the buffer is created so that line lookups do not rescan the file.
+     */
+    struct source_buffer
+    {
+        /**
+         * Constructs a source buffer by mapping or copying the given file into memory.
+         * @param path The path to the file to map or copy.
+         * @param copy True to copy the file into memory so that later changes to the file do not affect the buffer or false to map it.
+         */
+        explicit source_buffer(std::string const& path, bool copy = false);
+
+        /**
+         * Destructs the source buffer and unmaps the file if it was mapped.
+         */
+        ~source_buffer();
+
+        /**
+         * Prevents the source buffer from being copied.
+         */
+        source_buffer(source_buffer const&) = delete;
+
+        /**
+         * Prevents the source buffer from being copied.
+         * @return Returns this source buffer.
+         */
+        source_buffer& operator=(source_buffer const&) = delete;
+
+        /**
+         * Gets the data of the source buffer.
+         * @return Returns the data of the source buffer or nullptr if the buffer is empty.
+         */
+        char const* data() const;
+
+        /**
+         * Gets the size of the source buffer, in bytes.
+         * @return Returns the size of the source buffer.
+         */
+        std::size_t size() const;
+
+        /**
+         * Gets the number of lines in the source buffer.
+         * @return Returns the number of lines in the source buffer.
+         */
+        std::size_t lines() const;
+
+        /**
+         * Gets the bounds of the line containing the given offset.
+         * Lookups are O(log n) in the number of lines.
+         * @param offset The offset into the buffer.
+         * @return Returns the offsets of the first character of the line and the line's terminating newline (or the end of the buffer).
+         */
+        std::pair<std::size_t, std::size_t> line_bounds(std::size_t offset) const;
+
+     private:
+        void index_lines();
+
+        char const* _data;
+        std::size_t _size;
+        std::unique_ptr<char[]> _copy;
+        std::vector<std::size_t> _line_starts;
+    };
+
+}}  // namespace puppet::lexer
@@ -0,0 +1,2214 @@
+// Copyright (c) 2008-2009 Ben Hanson
+// Copyright (c) 2008-2011 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file licence_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Auto-generated by boost::lexer, do not edit
+
+#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_OCT_16_2026_12_07_07)
+#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_OCT_16_2026_12_07_07
+
+#include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+
+////////////////////////////////////////////////////////////////////////////////
+// the generated table of state names and the tokenizer have to be
+// defined in the boost::spirit::lex::lexertl::static_ namespace
+namespace boost { namespace spirit { namespace lex { namespace lexertl { namespace static_ {
+
+////////////////////////////////////////////////////////////////////////////////
+// this table defines the names of the lexer states
+char const* const lexer_state_names[3] = 
+{
+    "INITIAL",
+    "SC",
+    "FS"
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// this variable defines the number of lexer states
+std::size_t const lexer_state_count = 3;
+
+////////////////////////////////////////////////////////////////////////////////
+// this function returns the next matched token
+template<typename Iterator>
+std::size_t next_token (std::size_t& start_state_, bool& /*bol_*/, 
+    Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
+{
+    enum {end_state_index, id_index, unique_id_index, state_index, bol_index,
+        eol_index, dead_state_index, dfa_offset};
+
+    static std::size_t const npos = static_cast<std::size_t>(~0);
+    static std::size_t const lookup0_[256] = {
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 9, 7, 9, 9, 8, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        9, 10, 11, 13, 14, 19, 66, 12,
+        20, 21, 22, 23, 24, 25, 26, 27,
+        28, 28, 28, 28, 28, 28, 28, 28,
+        28, 28, 29, 30, 31, 32, 33, 34,
+        35, 36, 36, 36, 36, 37, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 38, 39, 40, 66, 16,
+        66, 41, 42, 43, 44, 18, 45, 46,
+        47, 48, 17, 17, 49, 50, 51, 52,
+        53, 54, 55, 56, 57, 58, 59, 60,
+        17, 61, 62, 63, 15, 64, 65, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66 };
+    static const std::size_t dfa0_[15611] = {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 38, 38, 38, 7, 43, 42,
+        45, 46, 3, 41, 40, 28, 19, 15,
+        16, 18, 4, 22, 5, 20, 17, 44,
+        21, 23, 2, 6, 8, 24, 9, 39,
+        39, 11, 47, 12, 30, 40, 25, 26,
+        33, 40, 40, 27, 40, 40, 29, 31,
+        35, 40, 36, 40, 34, 32, 40, 37,
+        40, 40, 13, 14, 10, 47, 1, 60,
+        31, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 50, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 51,
+        0, 0, 0, 0, 0, 48, 49, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 52,
+        0, 1, 124, 39, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 53, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 43, 32, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 54, 55, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1,
+        45, 33, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 56,
+        57, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 61, 29, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 58, 60, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 59, 0, 1, 33, 37,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 61, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 62, 0,
+        1, 62, 30, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        63, 64, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 64, 40, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 66,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 65, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 126,
+        45, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 67,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 91, 23, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 93, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1,
+        123, 25, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 125, 26, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 40, 27,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 41, 28, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 47, 34, 0, 0,
+        0, 0, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 70, 69, 69, 69, 69, 68, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 1, 42,
+        35, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 37, 36, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 46, 38, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1,
+        58, 41, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 71, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 44, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 59, 43,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 63, 44, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 72, 40, 40, 40,
+        40, 40, 40, 40, 73, 40, 40, 74,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        77, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 78, 40,
+        40, 40, 40, 80, 79, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 81, 40, 40,
+        40, 40, 40, 82, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 83, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 84, 40, 40,
+        40, 40, 40, 85, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65586, 80,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 86, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 87, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 89, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 88, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 92,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 91, 40, 40,
+        40, 40, 40, 90, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        93, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 94, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        95, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65592, 88, 0, 0, 0,
+        0, 38, 38, 38, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        96, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 65585, 79,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 39, 39, 39,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 39, 97, 0, 0, 0, 0, 0,
+        0, 98, 98, 0, 0, 0, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65583, 81, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 41, 41, 41, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 41,
+        0, 0, 0, 0, 0, 0, 0, 41,
+        41, 0, 0, 0, 41, 41, 41, 41,
+        41, 41, 41, 41, 41, 41, 41, 41,
+        41, 41, 41, 41, 41, 41, 41, 41,
+        41, 41, 0, 0, 0, 0, 1, 65593,
+        90, 0, 0, 0, 0, 99, 99, 99,
+        99, 99, 101, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 100, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 1, 65593, 90, 0, 0, 0, 0,
+        102, 102, 102, 102, 104, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        103, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 1, 65589, 86, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 44, 44, 106, 0,
+        0, 0, 0, 0, 0, 0, 105, 0,
+        44, 0, 0, 0, 0, 0, 0, 0,
+        44, 106, 0, 0, 0, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 0, 0, 0, 0, 1,
+        65591, 87, 0, 0, 0, 0, 0, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 1, 65536, 91, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 108, 108, 108, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 108, 107,
+        0, 0, 0, 0, 0, 0, 108, 108,
+        0, 0, 0, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108,
+        108, 0, 0, 0, 0, 1, 65536, 91,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 65547, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 109,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 65544, 11, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 65549,
+        15, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 65556, 20, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 65557, 21, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1,
+        65552, 22, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        110, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 65537, 4, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 65546, 13,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 65538, 5, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 65554, 18, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 65539,
+        6, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 65541, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 65545, 12, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1,
+        65540, 7, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 65542, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 65543, 10,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 65550, 16, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 65553, 17, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 66, 66, 111,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 0, 112, 112, 112, 112,
+        112, 0, 112, 0, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 1, 65555, 19, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 65587, 82, 0,
+        0, 0, 0, 0, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 113,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 0,
+        0, 0, 0, 0, 0, 0, 0, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 113, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 0, 0, 0, 0, 0, 0,
+        0, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 70, 70,
+        114, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 115, 115,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 39, 39, 0, 0, 0, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        116, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 117, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 118, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 119, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 41, 41, 41, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        41, 0, 0, 0, 0, 0, 0, 0,
+        41, 41, 0, 0, 0, 41, 41, 41,
+        41, 41, 41, 41, 41, 41, 41, 41,
+        41, 41, 41, 41, 41, 41, 41, 41,
+        41, 41, 41, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 121, 40, 40, 120, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65563, 50, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65573, 58,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        123, 40, 124, 40, 122, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 125, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 126, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 127, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 128, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 129, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        130, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        131, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65569, 56, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65586, 80,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 132, 40, 40, 40, 40, 133, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 134, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 136, 135, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 137, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 138, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 139, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 140,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 142, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        141, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65586, 80,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 143, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65590, 78, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        144, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 65585,
+        79, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 98, 98,
+        98, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 98, 97, 0, 0, 0, 0,
+        0, 0, 98, 98, 0, 0, 0, 98,
+        98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        99, 99, 99, 99, 99, 101, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        100, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 0, 0, 0, 0,
+        0, 0, 0, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 1,
+        65581, 83, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 102, 102, 102, 102, 104, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 103, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 0, 0, 0,
+        0, 0, 0, 0, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102,
+        1, 65582, 84, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 145,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 65589,
+        86, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 146, 146,
+        106, 0, 0, 0, 0, 0, 0, 147,
+        105, 0, 146, 0, 0, 0, 0, 0,
+        0, 0, 146, 106, 0, 0, 0, 146,
+        146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 148, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 65584, 89, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 108, 108, 108, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        108, 107, 0, 0, 0, 0, 0, 0,
+        108, 108, 0, 0, 0, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 0, 0, 0, 0, 1,
+        65548, 2, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 65551, 3, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 111, 111, 111, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 151, 112, 112, 112, 112, 112,
+        150, 112, 149, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        0, 0, 0, 0, 0, 0, 0, 152,
+        152, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 151, 112, 112,
+        112, 112, 112, 150, 112, 149, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 1, 65587, 82, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 114, 153, 153, 153,
+        153, 154, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 115, 115, 115, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 115, 75, 0,
+        0, 0, 0, 0, 0, 115, 115, 0,
+        0, 0, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 155, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 156,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 157, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 158, 158,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 158, 158,
+        158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 159, 40, 40, 40, 40, 40, 40,
+        160, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 161, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        162, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 163, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        164, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 165, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 167, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 166, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65580, 75,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 168, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 169, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65568,
+        55, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        170, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 171, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 172, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 173, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65586, 80,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 174, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 175, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 176, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        177, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65580, 70, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 178,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 179, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 180, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65586, 80,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        181, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 182, 182, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 65589, 86, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 145, 145, 183, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 145,
+        0, 0, 0, 0, 0, 0, 0, 145,
+        183, 0, 0, 0, 145, 145, 145, 145,
+        145, 145, 145, 145, 145, 145, 145, 145,
+        145, 145, 145, 145, 145, 145, 145, 145,
+        145, 145, 0, 0, 0, 0, 1, 65589,
+        86, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 146, 146,
+        106, 0, 0, 0, 0, 0, 0, 0,
+        105, 0, 146, 0, 0, 0, 0, 0,
+        0, 0, 146, 106, 0, 0, 0, 146,
+        146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 0, 0, 0,
+        0, 1, 65589, 86, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 147, 147, 147, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 147, 0, 0,
+        0, 0, 0, 0, 0, 147, 147, 0,
+        0, 0, 147, 147, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 147, 147,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 108, 108, 108, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        108, 0, 0, 0, 0, 0, 0, 0,
+        108, 108, 0, 0, 0, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 149, 149,
+        149, 0, 0, 0, 0, 0, 0, 0,
+        184, 184, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        184, 184, 184, 184, 184, 184, 184, 184,
+        184, 184, 184, 184, 184, 184, 184, 184,
+        184, 184, 184, 184, 184, 184, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 150, 150, 150, 0, 0, 0, 0,
+        185, 185, 185, 185, 185, 0, 0, 151,
+        0, 0, 0, 0, 0, 0, 185, 0,
+        0, 0, 0, 0, 0, 0, 185, 185,
+        0, 0, 0, 185, 185, 185, 185, 185,
+        185, 185, 185, 185, 185, 185, 185, 185,
+        185, 185, 185, 185, 185, 185, 185, 185,
+        185, 0, 0, 0, 0, 1, 65588, 85,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 152,
+        152, 152, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 151, 0, 0,
+        0, 0, 0, 150, 0, 149, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 186, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 1, 65591,
+        87, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 65559, 46, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 187, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        188, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 158, 158, 158, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 158, 75,
+        0, 0, 0, 0, 0, 0, 158, 158,
+        0, 0, 0, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 158, 158, 158, 158,
+        158, 0, 0, 0, 0, 1, 65586, 80,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 189,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 190, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 191, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 192, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 193, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65580, 72, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 194, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 195,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65565, 52,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65567, 54, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 196, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65577,
+        62, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 197, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 198, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        199, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 200, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65580, 76,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65576, 61, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65572, 64, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 201,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 202, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 203, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 204,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65585, 79, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 182, 182, 182, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 182, 97,
+        0, 0, 0, 0, 0, 0, 182, 182,
+        0, 0, 0, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        182, 0, 0, 0, 0, 1, 65589, 86,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 205, 205, 183,
+        0, 0, 0, 0, 0, 0, 147, 0,
+        0, 205, 0, 0, 0, 0, 0, 0,
+        0, 205, 183, 0, 0, 0, 205, 205,
+        205, 205, 205, 205, 205, 205, 205, 205,
+        205, 205, 205, 205, 205, 205, 205, 205,
+        205, 205, 205, 205, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        206, 206, 206, 0, 0, 0, 0, 206,
+        0, 0, 0, 0, 206, 0, 0, 0,
+        0, 0, 0, 0, 206, 206, 0, 0,
+        0, 206, 206, 206, 206, 206, 206, 206,
+        206, 206, 206, 206, 206, 206, 206, 206,
+        206, 206, 206, 206, 206, 206, 206, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 207, 207, 207, 0, 0, 0,
+        0, 185, 185, 185, 185, 185, 0, 0,
+        151, 0, 0, 0, 0, 0, 0, 185,
+        0, 0, 0, 0, 0, 0, 0, 185,
+        185, 0, 0, 0, 185, 185, 185, 185,
+        185, 185, 185, 185, 185, 185, 185, 185,
+        185, 185, 185, 185, 185, 185, 185, 185,
+        185, 185, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 186, 153, 153, 153,
+        153, 154, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153,
+        153, 1, 65560, 47, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 208, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65586, 80, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        209, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 210, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65580, 71,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        211, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 212,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 213,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65564, 51, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 214, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65570, 57, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65586, 80, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 215, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65586, 80,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 216, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65571, 65, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 217, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 218, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 219,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 220,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65589, 86, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 205,
+        205, 183, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 205, 0, 0, 0, 0,
+        0, 0, 0, 205, 183, 0, 0, 0,
+        205, 205, 205, 205, 205, 205, 205, 205,
+        205, 205, 205, 205, 205, 205, 205, 205,
+        205, 205, 205, 205, 205, 205, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 221, 221, 221, 0, 0, 0, 0,
+        0, 0, 206, 206, 206, 0, 0, 151,
+        0, 206, 0, 0, 0, 150, 206, 0,
+        0, 0, 0, 0, 0, 0, 206, 206,
+        0, 0, 0, 206, 206, 206, 206, 206,
+        206, 206, 206, 206, 206, 206, 206, 206,
+        206, 206, 206, 206, 206, 206, 206, 206,
+        206, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 207, 207, 207, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 151, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 222, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 223, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65562,
+        49, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 224, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 225, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65580, 77, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65580, 73, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65574, 59,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 226, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65586, 80, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 227, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        228, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65586, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 229, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65586, 80, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 230, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 221, 221,
+        221, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 151, 0, 0, 0,
+        0, 0, 150, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 65580, 69, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65561, 48,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65586, 80, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        231, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0, 1, 65580, 68, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 40, 40, 40, 0, 0,
+        0, 0, 0, 0, 76, 0, 0, 40,
+        75, 0, 0, 0, 0, 0, 0, 40,
+        40, 0, 0, 0, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 0, 0, 0, 1, 65586,
+        80, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        40, 0, 0, 0, 0, 0, 0, 76,
+        0, 0, 40, 75, 0, 0, 0, 0,
+        0, 0, 40, 40, 0, 0, 0, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 232, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 0, 0, 0,
+        0, 1, 65578, 63, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 40, 40, 40, 0, 0, 0, 0,
+        0, 0, 76, 0, 0, 40, 75, 0,
+        0, 0, 0, 0, 0, 40, 40, 0,
+        0, 0, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        0, 0, 0, 0, 1, 65580, 66, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 40, 40, 40, 0,
+        0, 0, 0, 0, 0, 76, 0, 0,
+        40, 75, 0, 0, 0, 0, 0, 0,
+        40, 40, 0, 0, 0, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 0, 0, 0, 0, 1,
+        65580, 67, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 40,
+        40, 40, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 40, 75, 0, 0, 0,
+        0, 0, 0, 40, 40, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 0, 0,
+        0, 0, 1, 65580, 74, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 40, 40, 40, 0, 0, 0,
+        0, 0, 0, 76, 0, 0, 40, 75,
+        0, 0, 0, 0, 0, 0, 40, 40,
+        0, 0, 0, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 0, 0, 0, 0, 1, 65566, 53,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 40, 40, 40,
+        0, 0, 0, 0, 0, 0, 76, 0,
+        0, 40, 75, 0, 0, 0, 0, 0,
+        0, 40, 40, 0, 0, 0, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 0, 0, 0, 0,
+        1, 65575, 60, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 0, 0, 0, 0, 0,
+        0, 76, 0, 0, 40, 75, 0, 0,
+        0, 0, 0, 0, 40, 40, 0, 0,
+        0, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 0,
+        0, 0, 0 };
+    static std::size_t const lookup1_[256] = {
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 7, 7, 7, 7, 7, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        7, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 8, 10, 10, 10, 10, 9,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10 };
+    static const std::size_t dfa1_[88] = {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 2, 0, 1, 47,
+        0, 1, 0, 0, 0, 0, 3, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        3, 4, 3, 3, 0, 0, 0, 0,
+        0, 0, 0, 5, 4, 6, 5, 0,
+        0, 0, 0, 0, 0, 0, 5, 7,
+        5, 5, 0, 0, 0, 0, 0, 0,
+        0, 6, 0, 2, 0, 0, 0, 0,
+        0, 0, 0, 0, 5, 7, 6, 5 };
+    static std::size_t const lookup2_[256] = {
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 7, 7, 7, 7, 7, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        7, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 8, 10, 10, 10, 10, 9,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10 };
+    static const std::size_t dfa2_[88] = {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 2, 0, 1, 47,
+        1, 0, 0, 0, 0, 0, 3, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        3, 4, 3, 3, 0, 0, 0, 0,
+        0, 0, 0, 5, 4, 6, 5, 0,
+        0, 0, 0, 0, 0, 0, 5, 7,
+        5, 5, 0, 0, 0, 0, 0, 0,
+        0, 6, 0, 2, 0, 0, 0, 0,
+        0, 0, 0, 0, 5, 7, 6, 5 };
+    static std::size_t const* lookup_arr_[3] = { lookup0_, lookup1_, lookup2_ };
+    static std::size_t const dfa_alphabet_arr_[3] = { 67, 11, 11 };
+    static std::size_t const* dfa_arr_[3] = { dfa0_, dfa1_, dfa2_ };
+
+    if (start_token_ == end_)
+    {
+        unique_id_ = npos;
+        return 0;
+    }
+
+again:
+    std::size_t const* lookup_ = lookup_arr_[start_state_];
+    std::size_t dfa_alphabet_ = dfa_alphabet_arr_[start_state_];
+    std::size_t const*dfa_ = dfa_arr_[start_state_];
+    std::size_t const* ptr_ = dfa_ + dfa_alphabet_;
+    Iterator curr_ = start_token_;
+    bool end_state_ = *ptr_ != 0;
+    std::size_t id_ = *(ptr_ + id_index);
+    std::size_t uid_ = *(ptr_ + unique_id_index);
+    std::size_t end_start_state_ = start_state_;
+    Iterator end_token_ = start_token_;
+
+    while (curr_ != end_)
+    {
+        std::size_t const state_ =
+            ptr_[lookup_[static_cast<unsigned char>(*curr_++)]];
+
+        if (state_ == 0) break;
+
+        ptr_ = &dfa_[state_ * dfa_alphabet_];
+
+        if (*ptr_)
+        {
+            end_state_ = true;
+            id_ = *(ptr_ + id_index);
+            uid_ = *(ptr_ + unique_id_index);
+            end_start_state_ = *(ptr_ + state_index);
+            end_token_ = curr_;
+        }
+    }
+
+    if (end_state_)
+    {
+        // return longest match
+        start_token_ = end_token_;
+        start_state_ = end_start_state_;
+        if (id_ == 0)
+        {
+            goto again;
+        }
+    }
+    else
+    {
+        id_ = npos;
+        uid_ = npos;
+    }
+
+    unique_id_ = uid_;
+    return id_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// this defines a generic accessors for the information above
+struct lexer
+{
+    // version number and feature-set of compatible static lexer engine
+    enum
+    {
+        static_version = 65536,
+        supports_bol = false,
+        supports_eol = false
+    };
+
+    // return the number of lexer states
+    static std::size_t state_count()
+    {
+        return lexer_state_count; 
+    }
+
+    // return the name of the lexer state as given by 'idx'
+    static char const* state_name(std::size_t idx)
+    {
+        return lexer_state_names[idx]; 
+    }
+
+    // return the next matched token
+    template<typename Iterator>
+    static std::size_t next(std::size_t &start_state_, bool& bol_
+      , Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
+    {
+        return next_token(start_state_, bol_, start_token_, end_, unique_id_);
+    }
+};
+
+}}}}}  // namespace boost::spirit::lex::lexertl::static_
+
+#endif
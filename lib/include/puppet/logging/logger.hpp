@@ -8,6 +8,8 @@
 #include <string>
 #include <iostream>
 #include <functional>
+#include <mutex>
+#include <vector>
 
 namespace puppet { namespace logging {
 
@@ -155,6 +157,13 @@ namespace puppet { namespace logging {
          */
         size_t errors() const;
 
+        /**
+         * Adds warnings and errors that were logged elsewhere (e.g. by a worker process) to the counts.
+         * @param warnings The number of warnings to add.
+         * @param errors The number of errors to add.
+         */
+        void add(size_t warnings, size_t errors);
+
         /**
          * Gets the current logging level.
          * @return Returns the current logging level.
@@ -201,6 +210,7 @@ namespace puppet { namespace logging {
             log(level, line, column, text, path, message, std::forward<TArgs>(args)...);
         }
 
+        std::mutex _mutex;
         size_t _warnings;
         size_t _errors;
         logging::level _level;
@@ -280,4 +290,51 @@ namespace puppet { namespace logging {
         bool _colorize_stderr;
     };
 
+    /**
+     * Implements a logger that buffers messages until they are flushed to another logger.
+     * This keeps the messages of a task together when many tasks are logging at once.
+     */
+    struct buffered_logger : logger
+    {
+     public:
+        /**
+         * Constructs a buffered logger.
+         * The logger uses the log level of the target logger.
+         * @param target The logger to flush messages to.
+         */
+        explicit buffered_logger(logger& target);
+
+        /**
+         * Logs the buffered messages to the target logger and clears the buffer.
+         * Messages from buffers flushed at the same time are not interleaved.
+         */
+        void flush();
+
+     protected:
+        /**
+         * Logs a message.
+         * @param level The log level.
+         * @param line The line of the source context.
+         * @param column The column of the source context.
+         * @param text The context text.
+         * @param path The path of the source file.
+         * @param message The message to log.
+         */
+        virtual void log_message(logging::level level, size_t line, size_t column, std::string const& text, std::string const& path, std::string const& message) override;
+
+     private:
+        struct entry
+        {
+            logging::level level;
+            size_t line;
+            size_t column;
+            std::string text;
+            std::string path;
+            std::string message;
+        };
+
+        logger& _target;
+        std::vector<entry> _entries;
+    };
+
 }}  // namespace puppet::logger
\ No newline at end of file
@@ -6,14 +6,18 @@
 
 #include "../lexer/position.hpp"
 #include "../ast/syntax_tree.hpp"
+#include "../symbol.hpp"
 #include "values/value.hpp"
 #include <boost/optional.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <deque>
 #include <string>
 #include <vector>
 #include <functional>
 #include <unordered_map>
+#include <unordered_set>
 #include <exception>
+#include <ostream>
 
 namespace puppet { namespace compiler {
 
@@ -38,6 +42,7 @@ namespace puppet { namespace runtime {
 
     /**
      * Represents a collection of resource attributes.
+     * Attributes are stored inline in a vector sorted by their interned names, as most resources only have a few.
      */
     struct attributes
     {
@@ -49,18 +54,20 @@ namespace puppet { namespace runtime {
 
         /**
          * Gets an attribute.
+         * Values are stored inline, so the returned pointer is only valid until this collection or one of its parents is
+         * next set, appended to, or flattened; copy the value if it is needed after that.
          * @param name The name of the attribute to get.
          * @param check_parent True if the parent should be checked for the attribute or false if not.
          * @return Returns the value if the attribute exists or nullptr if the attribute does not exist.
          */
-        std::shared_ptr<values::value const> get(std::string const& name, bool check_parent = true) const;
+        values::value const* get(symbol const& name, bool check_parent = true) const;
 
         /**
          * Sets an attribute.
          * @param name The name of the attribute to set.
          * @param value The value to set.
          */
-        void set(std::string const& name, values::value value);
+        void set(symbol const& name, values::value value);
 
         /**
          * Appends a value to an existing attribute.
@@ -70,17 +77,29 @@ namespace puppet { namespace runtime {
          * @param append_duplicates True if duplicate values in the resulting array are appended or false if they are not.
          * @return Returns true if the value was appended or false if the attribute already exists and is not an array.
          */
-        bool append(std::string const& name, values::value value, bool append_duplicates = true);
+        bool append(symbol const& name, values::value value, bool append_duplicates = true);
 
         /**
          * Enumerates each stored attribute.
+         * The callback must not set, append to, or flatten the attributes, as that may move the values being enumerated.
          * @param callback The callback to call for each stored attribute.
          */
-        void each(std::function<bool(std::string const& name, std::shared_ptr<values::value const> const& value)> const& callback) const;
+        void each(std::function<bool(symbol const& name, values::value const& value)> const& callback) const;
+
+        /**
+         * Copies the attributes inherited from the parent into this collection and releases the parent.
+         * Afterwards, getting an attribute no longer walks the parent chain.
+         */
+        void flatten();
 
      private:
+        using value_type = std::pair<symbol, values::value>;
+
+        std::vector<value_type>::iterator find(symbol const& name);
+        std::vector<value_type>::const_iterator find(symbol const& name) const;
+
         std::shared_ptr<attributes const> _parent;
-        std::unordered_map<std::string, std::shared_ptr<values::value>> _values;
+        std::vector<value_type> _values;
     };
 
     /**
@@ -179,6 +198,21 @@ namespace puppet { namespace runtime {
          */
         void make_attributes_unique();
 
+        /**
+         * Adds a relationship from this resource to the given target resource.
+         * Each relationship to a target is only stored once.
+         * @param relationship The relationship to add.
+         * @param target The target resource of the relationship.
+         * @return Returns true if the relationship was added or false if it already exists.
+         */
+        bool relate(runtime::relationship relationship, resource const& target);
+
+        /**
+         * Enumerates the resource's relationships in the order they were added.
+         * @param callback The callback to call for each relationship.
+         */
+        void each_relationship(std::function<bool(runtime::relationship relationship, resource const& target)> const& callback) const;
+
         /**
          * Determines if the given name is a metaparameter name.
          * @param name The name to check.
@@ -197,6 +231,8 @@ namespace puppet { namespace runtime {
         std::shared_ptr<std::string> _path;
         size_t _line;
         std::shared_ptr<runtime::attributes> _attributes;
+        std::vector<std::pair<runtime::relationship, resource const*>> _relationships;
+        std::unordered_set<size_t> _related;
         size_t _vertex_id;
         bool _exported;
     };
@@ -334,6 +370,25 @@ namespace puppet { namespace runtime {
      */
     struct catalog
     {
+        /**
+         * The callback type for loading classes and defined types that have not been defined.
+         * The callback is given the catalog and the name to load and returns true if it defined anything in the catalog.
+         */
+        using loader_type = std::function<bool(catalog&, std::string const&)>;
+
+        /**
+         * Sets the callback used to load classes and defined types that have not been defined.
+         * @param loader The loader callback or nullptr to not load definitions.
+         */
+        void loader(loader_type loader);
+
+        /**
+         * Loads the definition of a class or defined type that has not been defined.
+         * @param name The name of the class or defined type to load.
+         * @return Returns true if the loader defined anything in the catalog or false if nothing was loaded.
+         */
+        bool load(std::string const& name);
+
         /**
          * Gets the catalog's dependency graph.
          * The dependency graph is only populated after a call to catalog::finalize().
@@ -457,13 +512,33 @@ namespace puppet { namespace runtime {
          */
         void finalize();
 
+        /**
+         * Writes the catalog as JSON.
+         * Resources are written in declaration order and their parameters are sorted by name.
+         * @param out The output stream to write the catalog to.
+         * @param node The name of the node the catalog was compiled for.
+         * @param environment The name of the environment the catalog was compiled for.
+         */
+        void write(std::ostream& out, std::string const& node, std::string const& environment) const;
+
      private:
+        // A slot in the resource index; the vertex is also the resource's index in the resource list
+        struct resource_slot
+        {
+            std::size_t hash = 0;
+            std::size_t vertex = static_cast<std::size_t>(-1);
+        };
+
+        std::size_t find_slot(types::resource const& type, std::size_t hash) const;
+        void grow_index();
         void populate_graph();
-        void process_relationship_parameter(resource const& source, std::string const& name, runtime::relationship relationship);
+        void relate_metaparameter(resource& source, symbol const& name, runtime::relationship relationship);
         void add_relationship(runtime::relationship relationship, runtime::resource const& source, runtime::resource const& target);
         void detect_cycles();
 
-        std::unordered_map<std::string, std::unordered_map<std::string, resource>> _resources;
+        loader_type _loader;
+        std::deque<resource> _resources;
+        std::vector<resource_slot> _resource_index;
         std::unordered_map<types::klass, std::vector<class_definition>, boost::hash<types::klass>> _classes;
         std::unordered_map<std::string, defined_type> _defined_types;
         std::vector<node_definition> _nodes;
@@ -471,6 +546,7 @@ namespace puppet { namespace runtime {
         std::vector<std::pair<values::regex, size_t>> _regex_nodes;
         boost::optional<size_t> _default_node_index;
         dependency_graph _graph;
+        std::unordered_set<std::size_t> _edges;
     };
 
 }}  // puppet::runtime
@@ -0,0 +1,49 @@
+/**
+ * @file
+ * Declares the runtime constant folder.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace puppet { namespace ast {
+
+    // Forward declaration of expression.
+    struct expression;
+
+}}  // namespace puppet::ast
+
+namespace puppet { namespace compiler {
+
+    // Forward declaration of compiler context.
+    struct context;
+
+}}  // namespace puppet::compiler
+
+namespace puppet { namespace runtime {
+
+    /**
+     * Represents the runtime constant folder.
+     * This type is responsible for evaluating the constant expressions of a syntax tree once, after parsing.
+     * The values are cached on the syntax tree so that evaluation does not recreate them.
+     */
+    struct constant_folder
+    {
+        /**
+         * Folds the constant expressions of the given compilation context's syntax tree.
+         * Expressions that fail to evaluate are not folded; the failure is reported if the expression is evaluated.
+         * @param context The compilation context to fold.
+         */
+        static void fold(std::shared_ptr<compiler::context> const& context);
+
+        /**
+         * Folds the constant expressions of the given expressions from a compilation context's syntax tree.
+         * This is used to fold definition bodies that were parsed after the syntax tree was folded.
+         * @param context The compilation context the expressions belong to.
+         * @param expressions The expressions to fold.
+         */
+        static void fold(std::shared_ptr<compiler::context> const& context, std::vector<ast::expression> const& expressions);
+    };
+
+}}  // puppet::runtime
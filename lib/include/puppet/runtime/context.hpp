@@ -8,10 +8,36 @@
 #include "../facts/provider.hpp"
 #include "scope.hpp"
 #include "catalog.hpp"
+#include "engine.hpp"
 #include <string>
 #include <memory>
 #include <unordered_map>
 #include <regex>
+#include <vector>
+
+namespace puppet { namespace ast {
+
+    // Forward declaration of expression.
+    struct expression;
+
+    // Forward declaration of lambda.
+    struct lambda;
+
+}}  // namespace puppet::ast
+
+namespace puppet { namespace compiler {
+
+    // Forward declaration of manifest.
+    struct manifest;
+
+}}  // namespace puppet::compiler
+
+namespace puppet { namespace runtime { namespace vm {
+
+    // Forward declaration of program.
+    struct program;
+
+}}}  // namespace puppet::runtime::vm
 
 namespace puppet { namespace runtime {
 
@@ -92,8 +118,9 @@ namespace puppet { namespace runtime {
          * Constructs an evaluation context.
          * @param facts The facts provider to use for fact lookup.
          * @param catalog The catalog being compiled or nullptr if catalog expressions are not supported.
+         * @param engine The engine to use to evaluate expressions.
          */
-        explicit context(std::shared_ptr<facts::provider> facts = nullptr, runtime::catalog* catalog = nullptr);
+        explicit context(std::shared_ptr<facts::provider> facts = nullptr, runtime::catalog* catalog = nullptr, runtime::engine engine = runtime::engine::tree);
 
         /**
          * Gets the catalog being compiled.
@@ -101,6 +128,31 @@ namespace puppet { namespace runtime {
          */
         runtime::catalog* catalog();
 
+        /**
+         * Gets the engine used to evaluate expressions.
+         * @return Returns the engine used to evaluate expressions.
+         */
+        runtime::engine engine() const;
+
+        /**
+         * Gets the bytecode program for a block of expressions.
+         * Programs are owned by the manifest; the context remembers them so that only the first use takes the manifest's lock.
+         * @param manifest The manifest containing the block.
+         * @param body The block of expressions to get the program for.
+         * @param top_level True if the block is the top level of the manifest or false if it is the body of a definition.
+         * @return Returns the bytecode program for the block.
+         */
+        vm::program const& program(compiler::manifest& manifest, std::vector<ast::expression> const& body, bool top_level = false);
+
+        /**
+         * Gets the bytecode program for a lambda.
+         * Programs are owned by the manifest; the context remembers them so that only the first use takes the manifest's lock.
+         * @param manifest The manifest containing the lambda.
+         * @param lambda The lambda to get the program for.
+         * @return Returns the bytecode program for the lambda.
+         */
+        vm::program const& program(compiler::manifest& manifest, ast::lambda const& lambda);
+
         /**
          * Gets the current scope.
          * @return Returns the current scope and will never return nullptr.
@@ -155,6 +207,16 @@ namespace puppet { namespace runtime {
          */
         std::shared_ptr<values::value const> lookup(std::string const& name, expression_evaluator* evaluator = nullptr, lexer::position const* position = nullptr);
 
+        /**
+         * Looks up a variable's value by interned name.
+         * Unqualified names are looked up without hashing the name.
+         * @param name The interned name of the variable to look up.
+         * @param evaluator The expression evaluator to use to log warnings for scope lookup failures.  Requires a position.
+         * @param position The position where the lookup is taking place or nullptr if not in source.
+         * @return Returns the variable's value or nullptr if the variable was not found.
+         */
+        std::shared_ptr<values::value const> lookup(symbol const& name, expression_evaluator* evaluator = nullptr, lexer::position const* position = nullptr);
+
         /**
          * Looks up a match variable value by index.
          * @param index The index of the match variable.
@@ -181,6 +243,8 @@ namespace puppet { namespace runtime {
         friend struct node_scope;
 
         runtime::catalog* _catalog;
+        runtime::engine _engine;
+        std::unordered_map<void const*, vm::program const*> _programs;
         std::unordered_map<std::string, std::shared_ptr<runtime::scope>> _scopes;
         std::vector<std::shared_ptr<runtime::scope>> _scope_stack;
         std::shared_ptr<runtime::scope> _node_scope;
@@ -4,7 +4,11 @@
  */
 #pragma once
 
+#include "../ast/syntax_tree.hpp"
+#include <boost/variant.hpp>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace puppet { namespace compiler {
 
@@ -18,6 +22,43 @@ namespace puppet { namespace runtime {
     // Forward declaration of catalog.
     struct catalog;
 
+    /**
+     * Represents the class, defined type, and node definitions found in a syntax tree.
+     * Definitions are found once per manifest and can then be added to the catalog of every node compiling the manifest.
+     */
+    struct definitions
+    {
+        /**
+         * The type of a definition expression.
+         */
+        using expression_type = boost::variant<
+            ast::class_definition_expression const*,
+            ast::defined_type_expression const*,
+            ast::node_definition_expression const*
+        >;
+
+        /**
+         * The type of a definition: the qualified name (empty for nodes) and the definition expression.
+         */
+        using value_type = std::pair<std::string, expression_type>;
+
+        /**
+         * Adds a definition.
+         * @param name The qualified name of the class or defined type; empty for node definitions.
+         * @param expression The definition expression.
+         */
+        void add(std::string name, expression_type expression);
+
+        /**
+         * Gets the definitions in the order they were found.
+         * @return Returns the definitions in the order they were found.
+         */
+        std::vector<value_type> const& values() const;
+
+     private:
+        std::vector<value_type> _values;
+    };
+
     /**
      * Represents the runtime definition scanner.
      * This type is responsible for scanning a syntax tree for catalog-related definitions.
@@ -32,10 +73,27 @@ namespace puppet { namespace runtime {
 
         /**
          * Scans the given compilation context's syntax tree for definitions.
+         * If the context's manifest has already been scanned, its definitions are added without scanning it again.
          * @param context The compilation context to scan.
          */
         void scan(std::shared_ptr<compiler::context> const& context);
 
+        /**
+         * Finds the definitions in the given compilation context's syntax tree.
+         * Definitions that are invalid regardless of the catalog (e.g. reserved parameter names) are reported here.
+         * @param context The compilation context to find definitions in.
+         * @return Returns the definitions found in the syntax tree.
+         */
+        static runtime::definitions find(std::shared_ptr<compiler::context> const& context);
+
+        /**
+         * Adds definitions found in the given compilation context to the catalog.
+         * Definitions that conflict with existing definitions in the catalog are reported here.
+         * @param context The compilation context the definitions were found in.
+         * @param definitions The definitions to add.
+         */
+        void define(std::shared_ptr<compiler::context> const& context, runtime::definitions const& definitions);
+
      private:
         runtime::catalog& _catalog;
     };
@@ -0,0 +1,24 @@
+/**
+ * @file
+ * Declares the expression evaluation engines.
+ */
+#pragma once
+
+namespace puppet { namespace runtime {
+
+    /**
+     * Represents the engine used to evaluate expressions.
+     */
+    enum class engine
+    {
+        /**
+         * Evaluates expressions by walking the syntax tree.
+         */
+        tree,
+        /**
+         * Compiles manifests, class bodies and lambdas to bytecode that is executed by a stack machine.
+         */
+        vm
+    };
+
+}}  // namespace puppet::runtime
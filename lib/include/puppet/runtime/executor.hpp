@@ -91,8 +91,9 @@ namespace puppet { namespace runtime {
          * @param position The default position of the expression being executed.
          * @param parameters The parameters of the expression.
          * @param body The body of the expression.
+         * @param lambda The lambda being executed or nullptr if the expression is not a lambda.
          */
-        executor(expression_evaluator& evaluator, lexer::position const& position, boost::optional<std::vector<ast::parameter>> const& parameters, boost::optional<std::vector<ast::expression>> const& body);
+        executor(expression_evaluator& evaluator, lexer::position const& position, boost::optional<std::vector<ast::parameter>> const& parameters, boost::optional<std::vector<ast::expression>> const& body, ast::lambda const* lambda = nullptr);
 
         /**
          * Gets the default position of the expression being executed.
@@ -138,12 +139,15 @@ namespace puppet { namespace runtime {
 
      private:
         void validate_type(ast::parameter const& parameter, values::value const& value, std::function<void(std::string)> const& type_error) const;
-        values::value evaluate_body() const;
+        vm::program const* program() const;
+        values::value evaluate_body(vm::program const* program) const;
 
         expression_evaluator& _evaluator;
         lexer::position const& _position;
         boost::optional<std::vector<ast::parameter>> const& _parameters;
         boost::optional<std::vector<ast::expression>> const& _body;
+        ast::lambda const* _lambda;
+        mutable vm::program const* _program;
     };
 
 }}  // puppet::runtime
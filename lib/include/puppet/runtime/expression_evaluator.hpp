@@ -11,9 +11,17 @@
 #include <cstdint>
 #include <vector>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 
+namespace puppet { namespace runtime { namespace operators {
+
+    // Forward declaration of binary_context.
+    struct binary_context;
+
+}}}  // namespace puppet::runtime::operators
+
 namespace puppet { namespace runtime {
 
     /**
@@ -139,16 +147,34 @@ namespace puppet { namespace runtime {
          */
         bool is_match(values::value& actual, lexer::position const& actual_position, values::value& expected, lexer::position const& expected_position);
 
-     private:
+        /**
+         * Determines if an expression is productive (i.e. has a side effect).
+         * @param expr The expression to check.
+         * @return Returns true if the expression is productive or false if not.
+         */
         static bool is_productive(ast::expression const& expr);
+
+        /**
+         * Determines if a primary expression is productive (i.e. has a side effect).
+         * @param expr The primary expression to check.
+         * @return Returns true if the expression is productive or false if not.
+         */
         static bool is_productive(ast::primary_expression const& expr);
 
-        void climb_expression(
+        /**
+         * Finds the function implementing a binary operator.
+         * @param op The binary operator to find.
+         * @return Returns the function implementing the operator or nullptr if the operator is not supported.
+         */
+        static std::function<values::value(operators::binary_context&)> const* find_binary_operator(ast::binary_operator op);
+
+     private:
+        void evaluate(
             values::value& left,
             lexer::position const& left_position,
-            std::uint8_t min_precedence,
-            std::vector<ast::binary_expression>::const_iterator& begin,
-            std::vector<ast::binary_expression>::const_iterator const& end);
+            ast::expression const& expr,
+            std::size_t begin,
+            std::size_t end);
 
         void evaluate(
             values::value& left,
@@ -157,9 +183,6 @@ namespace puppet { namespace runtime {
             values::value& right,
             lexer::position& right_position);
 
-        static uint8_t get_precedence(ast::binary_operator op);
-        static bool is_right_associative(ast::binary_operator op);
-
         std::shared_ptr<compiler::context> _compilation_context;
         runtime::context& _evaluation_context;
     };
@@ -6,9 +6,11 @@
 
 #include "values/value.hpp"
 #include "../facts/provider.hpp"
+#include "../symbol.hpp"
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
 #include <cstdint>
 
 namespace puppet { namespace runtime {
@@ -65,6 +67,14 @@ namespace puppet { namespace runtime {
          */
         explicit scope(std::shared_ptr<scope> parent, runtime::resource* resource = nullptr);
 
+        /**
+         * Constructs a local scope with variables bound to slots.
+         * Slots start unassigned; variables in slots can still be set and looked up by name.
+         * @param parent The parent scope.
+         * @param slots The names of the variables bound to slots; the vector must outlive the scope.
+         */
+        scope(std::shared_ptr<scope> parent, std::vector<symbol> const& slots);
+
         /**
          * Constructs the top scope.
          * @param facts The facts provider to use for the top scope.
@@ -94,26 +104,48 @@ namespace puppet { namespace runtime {
 
         /**
          * Sets a variable in the scope.
-         * @param name The name of the variable.
+         * @param name The interned name of the variable.
          * @param value The value of the variable.
          * @param path The path of the file where the variable is being assigned or nullptr if unknown.
          * @param line The line number where the variable is being assigned or 0 if unknown.
          * @return Returns nullptr if the set was successful or a pointer to the previously assigned variable if there is already a variable of the same name.
          */
-        assigned_variable const* set(std::string name, std::shared_ptr<values::value const> value, std::shared_ptr<std::string> path = nullptr, size_t line = 0);
+        assigned_variable const* set(symbol const& name, std::shared_ptr<values::value const> value, std::shared_ptr<std::string> path = nullptr, size_t line = 0);
 
         /**
          * Gets a variable in the scope.
-         * @param name The name of the variable to get.
+         * @param name The interned name of the variable to get.
          * @return Returns the assigned variable or nullptr if the variable does not exist in the scope.
          */
-        assigned_variable const* get(std::string const& name);
+        assigned_variable const* get(symbol const& name);
+
+        /**
+         * Sets a variable bound to a slot.
+         * @param slot The slot of the variable.
+         * @param value The value of the variable.
+         * @param path The path of the file where the variable is being assigned or nullptr if unknown.
+         * @param line The line number where the variable is being assigned or 0 if unknown.
+         * @return Returns nullptr if the set was successful or a pointer to the previously assigned variable if the slot is already assigned.
+         */
+        assigned_variable const* set(size_t slot, std::shared_ptr<values::value const> value, std::shared_ptr<std::string> path = nullptr, size_t line = 0);
+
+        /**
+         * Gets a variable bound to a slot.
+         * If the slot has not been assigned, the variable is looked up by name in the parent scopes.
+         * @param slot The slot of the variable to get.
+         * @return Returns the assigned variable or nullptr if the variable does not exist.
+         */
+        assigned_variable const* get(size_t slot);
 
      private:
+        assigned_variable* find_slot(symbol const& name);
+
         std::shared_ptr<facts::provider> _facts;
         std::shared_ptr<scope> _parent;
         runtime::resource* _resource;
-        std::unordered_map<std::string, assigned_variable> _variables;
+        std::unordered_map<symbol, assigned_variable> _variables;
+        std::vector<symbol> const* _slot_names;
+        std::vector<assigned_variable> _slots;
     };
 
     /**
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../../cast.hpp"
+#include "../../symbol.hpp"
 #include <boost/functional/hash.hpp>
 #include <boost/variant.hpp>
 #include <boost/algorithm/string.hpp>
@@ -28,21 +29,22 @@ namespace puppet { namespace runtime { namespace types {
          * @param title The title of the resource (e.g. '/foo').  If empty, represents all instances of the resource type.
          */
         explicit basic_resource(std::string type_name = {}, std::string title = {}) :
-            _type_name(rvalue_cast(type_name)),
             _title(rvalue_cast(title))
         {
             // Make the type name lowercase
-            boost::to_lower(_type_name);
+            boost::to_lower(type_name);
 
             // Now uppercase every start of a type name
             boost::split_iterator<std::string::iterator> end;
-            for (auto it = boost::make_split_iterator(_type_name, boost::first_finder("::", boost::is_equal())); it != end; ++it) {
+            for (auto it = boost::make_split_iterator(type_name, boost::first_finder("::", boost::is_equal())); it != end; ++it) {
                 if (!*it) {
                     continue;
                 }
                 auto range = boost::make_iterator_range(it->begin(), it->begin() + 1);
                 boost::to_upper(range);
             }
+
+            _type_name = symbol(type_name);
         }
 
         /**
@@ -50,6 +52,15 @@ namespace puppet { namespace runtime { namespace types {
          * @return Returns the type of the resource.
          */
         std::string const& type_name() const
+        {
+            return _type_name.str();
+        }
+
+        /**
+         * Gets the interned type name of the resource.
+         * @return Returns the interned type name of the resource.
+         */
+        symbol const& type_symbol() const
         {
             return _type_name;
         }
@@ -78,7 +89,8 @@ namespace puppet { namespace runtime { namespace types {
          */
         bool is_class() const
         {
-            return _type_name == "Class";
+            static const symbol class_symbol("Class");
+            return _type_name == class_symbol;
         }
 
         /**
@@ -114,7 +126,7 @@ namespace puppet { namespace runtime { namespace types {
                 return true;
             }
             // Check type name
-            if (_type_name != resource_ptr->type_name()) {
+            if (_type_name != resource_ptr->type_symbol()) {
                 return false;
             }
             return _title.empty() || _title == resource_ptr->title();
@@ -138,7 +150,7 @@ namespace puppet { namespace runtime { namespace types {
                 return !resource->type_name().empty();
             }
             // Otherwise, the types need to be the same
-            if (_type_name != resource->type_name()) {
+            if (_type_name != resource->type_symbol()) {
                 return false;
             }
             // Otherwise, the other one is a specialization if this does not have a title but the other one does
@@ -154,7 +166,7 @@ namespace puppet { namespace runtime { namespace types {
         {
             using namespace std;
 
-            static regex resource_regex("^((?:(?:::)?[A-Z]\\w*)+)\\[([^\\]]+)\\]$");
+            static regex const resource_regex("^((?:(?:::)?[A-Z]\\w*)+)\\[([^\\]]+)\\]$");
 
             smatch matches;
             if (!regex_match(str, matches, resource_regex) || matches.size() != 3) {
@@ -174,7 +186,7 @@ namespace puppet { namespace runtime { namespace types {
         }
 
      private:
-        std::string _type_name;
+        symbol _type_name;
         std::string _title;
     };
 
@@ -210,7 +222,7 @@ namespace puppet { namespace runtime { namespace types {
     template <typename Type>
     bool operator==(basic_resource<Type> const& left, basic_resource<Type> const& right)
     {
-        return left.type_name() == right.type_name() && left.title() == right.title();
+        return left.type_symbol() == right.type_symbol() && left.title() == right.title();
     }
 
 }}}  // puppet::runtime::types
@@ -232,7 +244,7 @@ namespace boost {
         {
             size_t seed = 0;
             hash_combine(seed, puppet::runtime::types::basic_resource<Type>::name());
-            hash_combine(seed, type.type_name());
+            hash_combine(seed, type.type_symbol());
             hash_combine(seed, type.title());
             return seed;
         }
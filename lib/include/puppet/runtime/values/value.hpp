@@ -190,6 +190,14 @@ namespace puppet { namespace runtime { namespace values {
      */
     void join(std::ostream& os, array const& arr, std::string const& separator = " ");
 
+    /**
+     * Writes the value as JSON.
+     * Regexes and types are written as strings in their Puppet representation and hash keys are converted to strings.
+     * @param os The output stream to write to.
+     * @param val The value to write.
+     */
+    void write_json(std::ostream& os, value const& val);
+
     /**
      * Declaration of operator== for values.
      * This exists to intentionally cause an ambiguity if == is used on a value.
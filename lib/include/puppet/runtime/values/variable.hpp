@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../../cast.hpp"
+#include "../../symbol.hpp"
 #include <boost/functional/hash.hpp>
 #include <ostream>
 #include <memory>
@@ -25,11 +26,11 @@ namespace puppet { namespace runtime { namespace values {
 
         /**
          * Constructs a variable reference.
-         * @param name The name of the variable.
+         * @param name The interned name of the variable.
          * @param value The variable's value.
          */
-        basic_variable(std::string name, std::shared_ptr<value_type const> value) :
-            _name(rvalue_cast(name)),
+        basic_variable(puppet::symbol name, std::shared_ptr<value_type const> value) :
+            _name(name),
             _value(rvalue_cast(value))
         {
         }
@@ -39,6 +40,15 @@ namespace puppet { namespace runtime { namespace values {
          * @return Returns the name of the variable.
          */
         std::string const& name() const
+        {
+            return _name.str();
+        }
+
+        /**
+         * Gets the interned name of the variable.
+         * @return Returns the interned name of the variable.
+         */
+        puppet::symbol const& symbol() const
         {
             return _name;
         }
@@ -49,7 +59,8 @@ namespace puppet { namespace runtime { namespace values {
          */
         value_type const& value() const
         {
-            static value_type undefined;
+            // Shared by every thread, so it must never be modified
+            static value_type const undefined;
             return _value ? *_value : undefined;
         }
 
@@ -72,7 +83,7 @@ namespace puppet { namespace runtime { namespace values {
         }
 
     private:
-        std::string _name;
+        puppet::symbol _name;
         std::shared_ptr<value_type const> _value;
     };
 
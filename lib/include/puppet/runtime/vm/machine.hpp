@@ -0,0 +1,39 @@
+/**
+ * @file
+ * Declares the stack machine.
+ */
+#pragma once
+
+#include "program.hpp"
+#include "../expression_evaluator.hpp"
+
+namespace puppet { namespace runtime { namespace vm {
+
+    /**
+     * Represents the stack machine that executes bytecode programs.
+     */
+    struct machine
+    {
+        /**
+         * Constructs a stack machine.
+         * @param evaluator The expression evaluator to use for operators and unsupported expressions.
+         */
+        explicit machine(expression_evaluator& evaluator);
+
+        /**
+         * Executes a program in the current scope.
+         * If the program binds variables to slots, the current scope must have been created with the program's slots.
+         * @param program The program to execute.
+         * @return Returns the value of the program's last expression.
+         */
+        values::value execute(vm::program const& program);
+
+     private:
+        values::value load(ast::variable const& variable);
+        values::value load(ast::variable const& variable, runtime::scope& frame, std::size_t slot);
+        values::value assign(ast::variable const& variable, runtime::scope& frame, std::size_t slot, values::value& value);
+
+        expression_evaluator& _evaluator;
+    };
+
+}}}  // namespace puppet::runtime::vm
@@ -0,0 +1,275 @@
+/**
+ * @file
+ * Declares the bytecode program.
+ */
+#pragma once
+
+#include "../../ast/syntax_tree.hpp"
+#include "../operators/binary_context.hpp"
+#include "../values/value.hpp"
+#include "../../symbol.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace puppet { namespace runtime { namespace vm {
+
+    /**
+     * Represents the operation codes of the stack machine.
+     */
+    enum class opcode : std::uint8_t
+    {
+        /**
+         * Pushes a constant; the operand is the index of the constant.
+         */
+        push,
+        /**
+         * Pushes the value of a variable looked up by name; the operand is the index of the variable.
+         */
+        load,
+        /**
+         * Pushes the value of a variable bound to a slot of the local scope; the operand is the index of the variable.
+         * If the slot has not been assigned, the variable is looked up by name in the parent scopes.
+         */
+        load_slot,
+        /**
+         * Pops a value and assigns it to a variable bound to a slot of the local scope; the operand is the index of the variable.
+         * Pushes the assigned variable.
+         */
+        assign_slot,
+        /**
+         * Pushes the result of evaluating an expression with the tree walker; the operand is the index of the expression.
+         * Used for expressions the bytecode compiler does not support.
+         */
+        evaluate,
+        /**
+         * Discards the top of the stack.
+         */
+        pop,
+        /**
+         * Applies a unary operator to the top of the stack; the operand is the index of the unary operation.
+         */
+        unary,
+        /**
+         * Pops the right operand and applies a binary operator to it and the left operand on the top of the stack.
+         * The operand is the index of the binary operation.
+         */
+        binary,
+        /**
+         * Replaces the top of the stack with false and jumps if the top of the stack is not truthy.
+         * The operand is the index of the instruction to jump to.
+         */
+        branch_and,
+        /**
+         * Replaces the top of the stack with true and jumps if the top of the stack is truthy.
+         * The operand is the index of the instruction to jump to.
+         */
+        branch_or,
+        /**
+         * Pops the top of the stack and jumps if it is not truthy; the operand is the index of the instruction to jump to.
+         */
+        branch_false,
+        /**
+         * Pops the top of the stack and jumps if it is truthy; the operand is the index of the instruction to jump to.
+         */
+        branch_true,
+        /**
+         * Jumps to the instruction at the index given by the operand.
+         */
+        jump,
+        /**
+         * Creates a match scope, as if and unless expressions do.
+         */
+        enter_match_scope,
+        /**
+         * Leaves the most recently created match scope.
+         */
+        leave_match_scope,
+        /**
+         * Raises an error for an unproductive expression that is not the last in its block.
+         * The operand is the index of the position of the expression.
+         */
+        unproductive,
+        /**
+         * Replaces the top elements of the stack with an array of them; the operand is the number of elements.
+         */
+        make_array,
+        /**
+         * Replaces the top key and value pairs of the stack with a hash of them; the operand is the number of pairs.
+         */
+        make_hash,
+        /**
+         * Replaces the top elements of the stack with the concatenation of their string forms; the operand is the number of elements.
+         */
+        concatenate
+    };
+
+    /**
+     * Represents a stack machine instruction.
+     */
+    struct instruction
+    {
+        /**
+         * The operation code of the instruction.
+         */
+        opcode code;
+
+        /**
+         * The operand of the instruction.
+         */
+        std::uint32_t operand;
+    };
+
+    /**
+     * Represents a variable referenced by a load or assign instruction.
+     */
+    struct variable_reference
+    {
+        /**
+         * The variable expression.
+         */
+        ast::variable const* variable;
+
+        /**
+         * The slot of the variable in the local scope; only used by slot instructions.
+         */
+        std::size_t slot;
+    };
+
+    /**
+     * Represents a unary operation referenced by a unary instruction.
+     */
+    struct unary_operation
+    {
+        /**
+         * The unary operator.
+         */
+        ast::unary_operator op;
+
+        /**
+         * The position of the unary expression.
+         */
+        lexer::position position;
+    };
+
+    /**
+     * Represents a binary operation referenced by a binary instruction.
+     */
+    struct binary_operation
+    {
+        /**
+         * The binary operator.
+         */
+        ast::binary_operator op;
+
+        /**
+         * The function implementing the operator, resolved when the program is compiled; nullptr if the operator is not supported.
+         */
+        std::function<values::value(operators::binary_context&)> const* function;
+
+        /**
+         * The position of the left operand.
+         */
+        lexer::position left_position;
+
+        /**
+         * The position of the right operand.
+         */
+        lexer::position right_position;
+    };
+
+    /**
+     * Represents a block of expressions compiled to bytecode.
+     * Programs are compiled for the top level of a manifest, the bodies of classes, defined types and nodes, and lambdas.
+     * Programs refer to the syntax tree they were compiled from, so the syntax tree must outlive the program.
+     */
+    struct program
+    {
+        /**
+         * Compiles a block of expressions into a program.
+         * Variables are looked up and assigned by name, as the block's scope may be shared with other blocks.
+         * @param body The expressions to compile.
+         * @param top_level True if every expression must be productive, as at the top level of a manifest, or false if the last expression may be unproductive.
+         */
+        explicit program(std::vector<ast::expression> const& body, bool top_level = false);
+
+        /**
+         * Compiles the body of a lambda into a program.
+         * The lambda's parameters and the variables assigned in its body are bound to slots of the lambda's local scope.
+         * @param lambda The lambda to compile.
+         */
+        explicit program(ast::lambda const& lambda);
+
+        /**
+         * Gets the instructions of the program.
+         * @return Returns the instructions of the program.
+         */
+        std::vector<instruction> const& instructions() const;
+
+        /**
+         * Gets the constants referenced by push instructions.
+         * @return Returns the constants of the program.
+         */
+        std::vector<values::value> const& constants() const;
+
+        /**
+         * Gets the variables referenced by load and assign instructions.
+         * @return Returns the variables of the program.
+         */
+        std::vector<variable_reference> const& variables() const;
+
+        /**
+         * Gets the expressions referenced by evaluate instructions.
+         * @return Returns the expressions of the program.
+         */
+        std::vector<ast::primary_expression const*> const& expressions() const;
+
+        /**
+         * Gets the unary operations referenced by unary instructions.
+         * @return Returns the unary operations of the program.
+         */
+        std::vector<unary_operation> const& unary_operations() const;
+
+        /**
+         * Gets the binary operations referenced by binary instructions.
+         * @return Returns the binary operations of the program.
+         */
+        std::vector<binary_operation> const& binary_operations() const;
+
+        /**
+         * Gets the positions referenced by unproductive instructions.
+         * @return Returns the positions of the program.
+         */
+        std::vector<lexer::position> const& positions() const;
+
+        /**
+         * Gets the names of the variables bound to slots of the local scope.
+         * This is empty unless the program was compiled from a lambda.
+         * @return Returns the names of the variables bound to slots, in slot order.
+         */
+        std::vector<symbol> const& slots() const;
+
+        /**
+         * Gets the maximum depth of the stack when executing the program.
+         * @return Returns the maximum depth of the stack.
+         */
+        std::size_t stack_size() const;
+
+     private:
+        friend struct program_compiler;
+
+        std::size_t emit(opcode code, std::size_t operand = 0, int effect = 0);
+
+        std::vector<instruction> _instructions;
+        std::vector<values::value> _constants;
+        std::vector<variable_reference> _variables;
+        std::vector<ast::primary_expression const*> _expressions;
+        std::vector<unary_operation> _unary_operations;
+        std::vector<binary_operation> _binary_operations;
+        std::vector<lexer::position> _positions;
+        std::vector<symbol> _slots;
+        std::size_t _depth;
+        std::size_t _stack_size;
+    };
+
+}}}  // namespace puppet::runtime::vm
@@ -0,0 +1,139 @@
+/**
+ * @file
+ * Declares the interned symbol.
+ */
+#pragma once
+
+#include <boost/functional/hash.hpp>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace puppet {
+
+    /**
+     * Represents an interned string such as an identifier, variable name, or type name.
+     * Every symbol with the same name shares a single copy of the string in a global symbol table.
+     * Copying, hashing, and comparing symbols for equality do not touch the string.
+     */
+    struct symbol
+    {
+        /**
+         * Constructs the empty symbol.
+         */
+        symbol();
+
+        /**
+         * Constructs a symbol for the given name, adding the name to the symbol table if needed.
+         * @param name The name of the symbol.
+         */
+        explicit symbol(std::string const& name);
+
+        /**
+         * Gets the name of the symbol.
+         * The returned reference remains valid for the lifetime of the program.
+         * @return Returns the name of the symbol.
+         */
+        std::string const& str() const;
+
+        /**
+         * Determines if the symbol is the empty symbol.
+         * @return Returns true if the symbol's name is empty or false if not.
+         */
+        bool empty() const;
+
+        /**
+         * Gets the hash of the symbol.
+         * The hash is based on the symbol's identity rather than its name.
+         * @return Returns the hash of the symbol.
+         */
+        std::size_t hash() const;
+
+     private:
+        friend bool operator==(symbol const& left, symbol const& right);
+
+        std::string const* _name;
+    };
+
+    /**
+     * Equality operator for symbol.
+     * @param left The left operand.
+     * @param right The right operand.
+     * @return Returns true if the two symbols are the same symbol or false if not.
+     */
+    inline bool operator==(symbol const& left, symbol const& right)
+    {
+        return left._name == right._name;
+    }
+
+    /**
+     * Inequality operator for symbol.
+     * @param left The left operand.
+     * @param right The right operand.
+     * @return Returns true if the two symbols are different symbols or false if not.
+     */
+    inline bool operator!=(symbol const& left, symbol const& right)
+    {
+        return !(left == right);
+    }
+
+    /**
+     * Less than operator for symbol.
+     * Symbols are ordered by name so that ordering is deterministic.
+     * @param left The left operand.
+     * @param right The right operand.
+     * @return Returns true if the left symbol's name is less than the right symbol's name or false if not.
+     */
+    inline bool operator<(symbol const& left, symbol const& right)
+    {
+        return left != right && left.str() < right.str();
+    }
+
+    /**
+     * Hashes the given symbol.
+     * @param sym The symbol to hash.
+     * @return Returns the hash of the symbol.
+     */
+    inline std::size_t hash_value(symbol const& sym)
+    {
+        return sym.hash();
+    }
+
+    /**
+     * Stream insertion operator for symbol.
+     * @param os The output stream to write the symbol to.
+     * @param sym The symbol to write.
+     * @return Returns the given output stream.
+     */
+    std::ostream& operator<<(std::ostream& os, symbol const& sym);
+
+}  // puppet
+
+namespace std
+{
+    /**
+     * Responsible for hashing symbols.
+     */
+    template<>
+    struct hash<puppet::symbol>
+    {
+        /**
+         * The argument type.
+         */
+        typedef puppet::symbol argument_type;
+        /**
+         * The result type of the hash.
+         */
+        typedef std::size_t result_type;
+
+        /**
+         * Responsible for hashing the argument.
+         * @param arg The argument to hash.
+         * @return Returns the hash value.
+         */
+        result_type operator()(argument_type const& arg) const
+        {
+            return arg.hash();
+        }
+    };
+}
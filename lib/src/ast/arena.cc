@@ -0,0 +1,107 @@
+#include <puppet/ast/arena.hpp>
+#include <new>
+
+using namespace std;
+
+namespace puppet { namespace ast {
+
+    // The size of each block of arena storage
+    static size_t const block_size = 32 * 1024;
+
+    // The alignment of every allocation; node storage is preceded by a header of this size
+    static size_t const alignment = alignof(max_align_t);
+
+    // The arena AST nodes are allocated from on this thread
+    static thread_local arena* current_arena = nullptr;
+
+    static size_t align(size_t size)
+    {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    arena::arena() :
+        _next(nullptr),
+        _end(nullptr),
+        _allocations(0),
+        _bytes(0)
+    {
+    }
+
+    arena::~arena()
+    {
+    }
+
+    void* arena::allocate(size_t size)
+    {
+        size = align(size);
+
+        ++_allocations;
+        _bytes += size;
+
+        // Large allocations get a block of their own so the current block is not wasted
+        if (size > block_size / 4) {
+            _blocks.emplace_back(new char[size]);
+            return _blocks.back().get();
+        }
+
+        if (static_cast<size_t>(_end - _next) < size) {
+            _blocks.emplace_back(new char[block_size]);
+            _next = _blocks.back().get();
+            _end = _next + block_size;
+        }
+
+        auto ptr = _next;
+        _next += size;
+        return ptr;
+    }
+
+    size_t arena::allocations() const
+    {
+        return _allocations;
+    }
+
+    size_t arena::bytes() const
+    {
+        return _bytes;
+    }
+
+    arena* arena::current()
+    {
+        return current_arena;
+    }
+
+    arena_scope::arena_scope(ast::arena& arena) :
+        _previous(current_arena)
+    {
+        current_arena = &arena;
+    }
+
+    arena_scope::~arena_scope()
+    {
+        current_arena = _previous;
+    }
+
+    void* arena_allocated::operator new(size_t size)
+    {
+        // Each node is preceded by a header recording the arena that owns it (or nullptr for the heap)
+        auto total = align(sizeof(arena*)) + size;
+        auto owner = current_arena;
+        auto ptr = static_cast<char*>(owner ? owner->allocate(total) : ::operator new(total));
+        *reinterpret_cast<arena**>(ptr) = owner;
+        return ptr + align(sizeof(arena*));
+    }
+
+    void arena_allocated::operator delete(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+
+        // Arena storage is released with the arena
+        auto header = static_cast<char*>(ptr) - align(sizeof(arena*));
+        if (!*reinterpret_cast<arena**>(header)) {
+            ::operator delete(header);
+        }
+    }
+
+}}  // namespace puppet::ast
@@ -1,9 +1,16 @@
 #include <puppet/ast/bare_word.hpp>
+#include <puppet/cast.hpp>
 
 using namespace std;
 
 namespace puppet { namespace ast {
 
+    bare_word::bare_word(lexer::position position, string value) :
+        _position(rvalue_cast(position)),
+        _value(rvalue_cast(value))
+    {
+    }
+
     string const& bare_word::value() const
     {
         return _value;
@@ -21,6 +21,16 @@ namespace puppet { namespace ast {
     {
     }
 
+    class_definition_expression::class_definition_expression(lexer::position position, ast::name name, optional<vector<parameter>> parameters, optional<ast::name> parent, ast::deferred_body body) :
+        _position(position),
+        _name(rvalue_cast(name)),
+        _parameters(rvalue_cast(parameters)),
+        _parent(rvalue_cast(parent)),
+        _deferred_body(rvalue_cast(body)),
+        _parsed(false)
+    {
+    }
+
     ast::name const& class_definition_expression::name() const
     {
         return _name;
@@ -41,6 +51,23 @@ namespace puppet { namespace ast {
         return _body;
     }
 
+    void class_definition_expression::body(optional<vector<expression>> body) const
+    {
+        _body = rvalue_cast(body);
+        _deferred_body = boost::none;
+        _parsed.set();
+    }
+
+    optional<ast::deferred_body> const& class_definition_expression::deferred_body() const
+    {
+        return _deferred_body;
+    }
+
+    bool class_definition_expression::body_parsed() const
+    {
+        return _parsed.get();
+    }
+
     lexer::position const& class_definition_expression::position() const
     {
         return _position;
@@ -62,7 +89,11 @@ namespace puppet { namespace ast {
             os << " inherits " << *expr.parent();
         }
         os << " { ";
-        pretty_print(os, expr.body(), "; ");
+        if (expr.deferred_body()) {
+            os << *expr.deferred_body();
+        } else {
+            pretty_print(os, expr.body(), "; ");
+        }
         os << " }";
         return os;
     }
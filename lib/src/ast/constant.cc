@@ -0,0 +1,18 @@
+#include <puppet/ast/constant.hpp>
+#include <puppet/cast.hpp>
+
+using namespace std;
+
+namespace puppet { namespace ast {
+
+    constant::constant(runtime::values::value value) :
+        _value(rvalue_cast(value))
+    {
+    }
+
+    runtime::values::value const& constant::value() const
+    {
+        return _value;
+    }
+
+}}  // namespace puppet::ast
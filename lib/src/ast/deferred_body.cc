@@ -0,0 +1,57 @@
+#include <puppet/ast/deferred_body.hpp>
+#include <puppet/cast.hpp>
+
+using namespace std;
+using namespace puppet::lexer;
+
+namespace puppet { namespace ast {
+
+    deferred_body::deferred_body(lexer::position begin, lexer::position end) :
+        _begin(rvalue_cast(begin)),
+        _end(rvalue_cast(end))
+    {
+    }
+
+    lexer::position const& deferred_body::begin() const
+    {
+        return _begin;
+    }
+
+    lexer::position const& deferred_body::end() const
+    {
+        return _end;
+    }
+
+    parsed_flag::parsed_flag(bool parsed) :
+        _parsed(parsed)
+    {
+    }
+
+    parsed_flag::parsed_flag(parsed_flag const& other) :
+        _parsed(other.get())
+    {
+    }
+
+    parsed_flag& parsed_flag::operator=(parsed_flag const& other)
+    {
+        _parsed.store(other.get(), memory_order_release);
+        return *this;
+    }
+
+    bool parsed_flag::get() const
+    {
+        return _parsed.load(memory_order_acquire);
+    }
+
+    void parsed_flag::set()
+    {
+        _parsed.store(true, memory_order_release);
+    }
+
+    ostream& operator<<(ostream& os, deferred_body const&)
+    {
+        os << "...";
+        return os;
+    }
+
+}}  // namespace puppet::ast
@@ -20,6 +20,15 @@ namespace puppet { namespace ast {
     {
     }
 
+    defined_type_expression::defined_type_expression(lexer::position position, ast::name name, optional<vector<parameter>> parameters, ast::deferred_body body) :
+        _position(rvalue_cast(position)),
+        _name(rvalue_cast(name)),
+        _parameters(rvalue_cast(parameters)),
+        _deferred_body(rvalue_cast(body)),
+        _parsed(false)
+    {
+    }
+
     ast::name const& defined_type_expression::name() const
     {
         return _name;
@@ -35,6 +44,23 @@ namespace puppet { namespace ast {
         return _body;
     }
 
+    void defined_type_expression::body(optional<vector<expression>> body) const
+    {
+        _body = rvalue_cast(body);
+        _deferred_body = boost::none;
+        _parsed.set();
+    }
+
+    optional<ast::deferred_body> const& defined_type_expression::deferred_body() const
+    {
+        return _deferred_body;
+    }
+
+    bool defined_type_expression::body_parsed() const
+    {
+        return _parsed.get();
+    }
+
     lexer::position const& defined_type_expression::position() const
     {
         return _position;
@@ -52,7 +78,11 @@ namespace puppet { namespace ast {
             os << ")";
         }
         os << " { ";
-        pretty_print(os, expr.body(), "; ");
+        if (expr.deferred_body()) {
+            os << *expr.deferred_body();
+        } else {
+            pretty_print(os, expr.body(), "; ");
+        }
         os << " }";
         return os;
     }
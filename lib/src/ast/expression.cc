@@ -192,6 +192,67 @@ namespace puppet { namespace ast {
         return os;
     }
 
+    uint8_t get_precedence(binary_operator op)
+    {
+        // Return the precedence (low to high)
+        switch (op) {
+            case binary_operator::in_edge:
+            case binary_operator::in_edge_subscribe:
+            case binary_operator::out_edge:
+            case binary_operator::out_edge_subscribe:
+                return 1;
+
+            case binary_operator::assignment:
+                return 2;
+
+            case binary_operator::logical_or:
+                return 3;
+
+            case binary_operator::logical_and:
+                return 4;
+
+            case binary_operator::greater_than:
+            case binary_operator::greater_equals:
+            case binary_operator::less_than:
+            case binary_operator::less_equals:
+                return 5;
+
+            case binary_operator::equals:
+            case binary_operator::not_equals:
+                return 6;
+
+            case binary_operator::left_shift:
+            case binary_operator::right_shift:
+                return 7;
+
+            case binary_operator::plus:
+            case binary_operator::minus:
+                return 8;
+
+            case binary_operator::multiply:
+            case binary_operator::divide:
+            case binary_operator::modulo:
+                return 9;
+
+            case binary_operator::match:
+            case binary_operator::not_match:
+                return 10;
+
+            case binary_operator::in:
+                return 11;
+
+            default:
+                break;
+        }
+
+        throw runtime_error("invalid binary operator.");
+    }
+
+    bool is_right_associative(binary_operator op)
+    {
+        return op == binary_operator::assignment;
+    }
+
     binary_expression::binary_expression() :
         _op(binary_operator::none)
     {
@@ -213,6 +274,16 @@ namespace puppet { namespace ast {
         return _operand;
     }
 
+    shared_ptr<ast::constant const> const& binary_expression::constant() const
+    {
+        return _constant;
+    }
+
+    void binary_expression::fold(shared_ptr<ast::constant const> constant) const
+    {
+        _constant = rvalue_cast(constant);
+    }
+
     lexer::position const& binary_expression::position() const
     {
         return get_position(_operand);
@@ -235,6 +306,18 @@ namespace puppet { namespace ast {
         _primary(rvalue_cast(primary)),
         _binary(rvalue_cast(binary))
     {
+        // Resolve precedence once: the right-hand operand of a binary expression extends over every following
+        // binary expression that binds at least as tightly as the operator (more tightly if left associative)
+        _operand_ends.resize(_binary.size());
+        for (size_t i = 0; i < _binary.size(); ++i) {
+            auto op = _binary[i].op();
+            auto min_precedence = get_precedence(op) + (is_right_associative(op) ? 0 : 1);
+            auto end = i + 1;
+            while (end < _binary.size() && get_precedence(_binary[end].op()) >= min_precedence) {
+                ++end;
+            }
+            _operand_ends[i] = end;
+        }
     }
 
     primary_expression const& expression::primary() const
@@ -247,6 +330,21 @@ namespace puppet { namespace ast {
         return _binary;
     }
 
+    size_t expression::operand_end(size_t index) const
+    {
+        return _operand_ends[index];
+    }
+
+    shared_ptr<ast::constant const> const& expression::constant() const
+    {
+        return _constant;
+    }
+
+    void expression::fold(shared_ptr<ast::constant const> constant) const
+    {
+        _constant = rvalue_cast(constant);
+    }
+
     lexer::position const& expression::position() const
     {
         return get_position(_primary);
@@ -24,6 +24,11 @@ namespace puppet { namespace ast {
         return _body;
     }
 
+    lexer::position const& else_expression::position() const
+    {
+        return _position;
+    }
+
     ostream& operator<<(ostream& os, else_expression const& expr)
     {
         os << "else { ";
@@ -0,0 +1,29 @@
+#include <puppet/ast/interpolated_string.hpp>
+#include <puppet/ast/expression_def.hpp>
+#include <puppet/cast.hpp>
+
+using namespace std;
+
+namespace puppet { namespace ast {
+
+    interpolated_string::interpolated_string()
+    {
+    }
+
+    interpolated_string::interpolated_string(vector<segment> segments, vector<warning> warnings) :
+        _segments(rvalue_cast(segments)),
+        _warnings(rvalue_cast(warnings))
+    {
+    }
+
+    vector<interpolated_string::segment> const& interpolated_string::segments() const
+    {
+        return _segments;
+    }
+
+    vector<interpolated_string::warning> const& interpolated_string::warnings() const
+    {
+        return _warnings;
+    }
+
+}}  // namespace puppet::ast
@@ -11,11 +11,16 @@ namespace puppet { namespace ast {
 
     name::name(lexer::position position, string value) :
         _position(rvalue_cast(position)),
-        _value(rvalue_cast(value))
+        _value(value)
     {
     }
 
     string const& name::value() const
+    {
+        return _value.str();
+    }
+
+    puppet::symbol const& name::symbol() const
     {
         return _value;
     }
@@ -27,7 +32,7 @@ namespace puppet { namespace ast {
 
     bool operator==(name const& left, name const& right)
     {
-        return left.value() == right.value();
+        return left.symbol() == right.symbol();
     }
 
     ostream& operator<<(ostream& os, name const& name)
@@ -78,6 +78,13 @@ namespace puppet { namespace ast {
     {
     }
 
+    hostname::hostname(lexer::position position, std::string value, bool regex) :
+        _position(rvalue_cast(position)),
+        _value(rvalue_cast(value)),
+        _regex(regex)
+    {
+    }
+
     std::string const& hostname::value() const
     {
         return _value;
@@ -121,6 +128,14 @@ namespace puppet { namespace ast {
     {
     }
 
+    node_definition_expression::node_definition_expression(lexer::position position, vector<hostname> names, ast::deferred_body body) :
+        _position(rvalue_cast(position)),
+        _names(rvalue_cast(names)),
+        _deferred_body(rvalue_cast(body)),
+        _parsed(false)
+    {
+    }
+
     vector<hostname> const& node_definition_expression::names() const
     {
         return _names;
@@ -131,6 +146,23 @@ namespace puppet { namespace ast {
         return _body;
     }
 
+    void node_definition_expression::body(optional<vector<expression>> body) const
+    {
+        _body = rvalue_cast(body);
+        _deferred_body = boost::none;
+        _parsed.set();
+    }
+
+    optional<ast::deferred_body> const& node_definition_expression::deferred_body() const
+    {
+        return _deferred_body;
+    }
+
+    bool node_definition_expression::body_parsed() const
+    {
+        return _parsed.get();
+    }
+
     lexer::position const& node_definition_expression::position() const
     {
         return _position;
@@ -145,7 +177,11 @@ namespace puppet { namespace ast {
         os << "node ";
         pretty_print(os, stmt.names(), ", ");
         os << " { ";
-        pretty_print(os, stmt.body(), "; ");
+        if (stmt.deferred_body()) {
+            os << *stmt.deferred_body();
+        } else {
+            pretty_print(os, stmt.body(), "; ");
+        }
         os << " }";
         return os;
     }
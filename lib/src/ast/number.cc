@@ -1,4 +1,5 @@
 #include <puppet/ast/number.hpp>
+#include <puppet/cast.hpp>
 
 using namespace std;
 using namespace puppet::lexer;
@@ -15,6 +16,12 @@ namespace puppet { namespace ast {
     {
     }
 
+    number::number(lexer::position position, value_type value) :
+        _position(rvalue_cast(position)),
+        _value(rvalue_cast(value))
+    {
+    }
+
     number::value_type const& number::value() const
     {
         return _value;
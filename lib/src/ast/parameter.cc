@@ -23,7 +23,7 @@ namespace puppet { namespace ast {
         _default_value(rvalue_cast(default_value))
     {
         static char const* valid_name_pattern = "[a-z_]\\w*";
-        static std::regex valid_name_regex(valid_name_pattern);
+        static std::regex const valid_name_regex(valid_name_pattern);
 
         if (!regex_match(_variable.name(), valid_name_regex)) {
             throw puppet::compiler::parse_exception(position(), (boost::format("parameter $%1% has an unacceptable name: the name must conform to /%2%/.") % _variable.name() % valid_name_pattern).str());
@@ -1,4 +1,5 @@
 #include <puppet/ast/regex.hpp>
+#include <puppet/cast.hpp>
 
 using namespace std;
 using namespace puppet::lexer;
@@ -9,6 +10,12 @@ namespace puppet { namespace ast {
     {
     }
 
+    regex::regex(lexer::position position, string value) :
+        _position(rvalue_cast(position)),
+        _value(rvalue_cast(value))
+    {
+    }
+
     string const& regex::value() const
     {
         return _value;
@@ -0,0 +1,1147 @@
+#include <puppet/ast/serialization.hpp>
+#include <puppet/ast/expression_def.hpp>
+#include <puppet/ast/interpolated_string.hpp>
+#include <puppet/cast.hpp>
+#include <boost/format.hpp>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+using namespace std;
+using namespace puppet::lexer;
+
+namespace puppet { namespace ast {
+
+    // The magic bytes at the start of every serialized syntax tree
+    static char const serialization_magic[] = { 'P', 'A', 'S', 'T' };
+
+    serialization_exception::serialization_exception(std::string const& message) :
+        runtime_error(message)
+    {
+    }
+
+    struct syntax_tree_writer : boost::static_visitor<>
+    {
+        explicit syntax_tree_writer(ostream& os) :
+            _os(os)
+        {
+        }
+
+        void write_byte(uint8_t value)
+        {
+            _os.put(static_cast<char>(value));
+        }
+
+        void write_size(uint64_t value)
+        {
+            // Sizes, offsets, and lines are written as unsigned LEB128
+            do {
+                uint8_t byte = value & 0x7F;
+                value >>= 7;
+                if (value) {
+                    byte |= 0x80;
+                }
+                write_byte(byte);
+            } while (value);
+        }
+
+        void write_integer(int64_t value)
+        {
+            // Signed integers are zigzag encoded so small negative values stay small
+            write_size((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        void write_bool(bool value)
+        {
+            write_byte(value ? 1 : 0);
+        }
+
+        void write_string(std::string const& value)
+        {
+            write_size(value.size());
+            _os.write(value.data(), value.size());
+        }
+
+        void write_position(lexer::position const& position)
+        {
+            write_size(position.offset());
+            write_size(position.line());
+        }
+
+        template <typename T>
+        void write(T const& value)
+        {
+            (*this)(value);
+        }
+
+        template <typename T>
+        void write(boost::optional<T> const& value)
+        {
+            write_bool(static_cast<bool>(value));
+            if (value) {
+                write(*value);
+            }
+        }
+
+        template <typename T>
+        void write(vector<T> const& values)
+        {
+            write_size(values.size());
+            for (auto const& value : values) {
+                write(value);
+            }
+        }
+
+        template <typename Variant>
+        void write_variant(Variant const& value)
+        {
+            write_byte(static_cast<uint8_t>(value.which()));
+            boost::apply_visitor(*this, value);
+        }
+
+        void operator()(boost::blank const&)
+        {
+        }
+
+        void operator()(int64_t value)
+        {
+            write_integer(value);
+        }
+
+        void operator()(long double value)
+        {
+            // Write floating point values as text with enough digits to round-trip exactly
+            ostringstream ss;
+            ss << setprecision(numeric_limits<long double>::max_digits10) << value;
+            write_string(ss.str());
+        }
+
+        void operator()(undef const& value)
+        {
+            write_position(value.position());
+        }
+
+        void operator()(defaulted const& value)
+        {
+            write_position(value.position());
+        }
+
+        void operator()(boolean const& value)
+        {
+            write_position(value.position());
+            write_bool(value.value());
+        }
+
+        void operator()(number const& value)
+        {
+            write_position(value.position());
+            write_variant(value.value());
+        }
+
+        void operator()(ast::string const& value)
+        {
+            write_position(value.position());
+            write_string(value.value());
+            write_string(value.escapes());
+            write_byte(static_cast<uint8_t>(value.quote()));
+            write_bool(value.interpolated());
+            write_string(value.format());
+            write_integer(value.margin());
+            write_bool(value.remove_break());
+            auto const& compiled = value.compiled();
+            write_bool(static_cast<bool>(compiled));
+            if (compiled) {
+                write(*compiled);
+            }
+        }
+
+        void operator()(interpolated_string const& value)
+        {
+            write(value.segments());
+            write_size(value.warnings().size());
+            for (auto const& warning : value.warnings()) {
+                write_position(warning.first);
+                write_string(warning.second);
+            }
+        }
+
+        void operator()(interpolated_string::segment const& value)
+        {
+            write_variant(value);
+        }
+
+        void operator()(std::string const& value)
+        {
+            write_string(value);
+        }
+
+        void operator()(vector<expression> const& value)
+        {
+            write(value);
+        }
+
+        void operator()(regex const& value)
+        {
+            write_position(value.position());
+            write_string(value.value());
+        }
+
+        void operator()(variable const& value)
+        {
+            write_position(value.position());
+            write_string(value.name());
+        }
+
+        void operator()(name const& value)
+        {
+            write_position(value.position());
+            write_string(value.value());
+        }
+
+        void operator()(bare_word const& value)
+        {
+            write_position(value.position());
+            write_string(value.value());
+        }
+
+        void operator()(ast::type const& value)
+        {
+            write_position(value.position());
+            write_string(value.name());
+        }
+
+        void operator()(array const& value)
+        {
+            write_position(value.position());
+            write(value.elements());
+        }
+
+        void operator()(hash_pair const& value)
+        {
+            (*this)(value.first);
+            (*this)(value.second);
+        }
+
+        void operator()(hash const& value)
+        {
+            write_position(value.position());
+            write(value.elements());
+        }
+
+        void operator()(selector_case_expression const& value)
+        {
+            (*this)(value.selector());
+            (*this)(value.result());
+        }
+
+        void operator()(selector_expression const& value)
+        {
+            write_position(value.position());
+            write(value.cases());
+        }
+
+        void operator()(case_proposition const& value)
+        {
+            write(value.options());
+            write(value.body());
+        }
+
+        void operator()(case_expression const& value)
+        {
+            write_position(value.position());
+            (*this)(value.expression());
+            write(value.propositions());
+        }
+
+        void operator()(else_expression const& value)
+        {
+            write_position(value.position());
+            write(value.body());
+        }
+
+        void operator()(elsif_expression const& value)
+        {
+            write_position(value.position());
+            (*this)(value.conditional());
+            write(value.body());
+        }
+
+        void operator()(if_expression const& value)
+        {
+            write_position(value.position());
+            (*this)(value.conditional());
+            write(value.body());
+            write(value.elsifs());
+            write(value.else_());
+        }
+
+        void operator()(unless_expression const& value)
+        {
+            write_position(value.position());
+            (*this)(value.conditional());
+            write(value.body());
+            write(value.else_());
+        }
+
+        void operator()(access_expression const& value)
+        {
+            write_position(value.position());
+            write(value.arguments());
+        }
+
+        void operator()(parameter const& value)
+        {
+            write(value.type());
+            write_bool(value.captures());
+            (*this)(value.variable());
+            write(value.default_value());
+        }
+
+        void operator()(lambda const& value)
+        {
+            write_position(value.position());
+            write(value.parameters());
+            write(value.body());
+        }
+
+        void operator()(method_call_expression const& value)
+        {
+            (*this)(value.method());
+            write(value.arguments());
+            write(value.lambda());
+        }
+
+        void operator()(function_call_expression const& value)
+        {
+            (*this)(value.function());
+            write(value.arguments());
+            write(value.lambda());
+        }
+
+        void operator()(attribute_expression const& value)
+        {
+            (*this)(value.name());
+            write_byte(static_cast<uint8_t>(value.op()));
+            (*this)(value.value());
+        }
+
+        void operator()(resource_body const& value)
+        {
+            (*this)(value.title());
+            write(value.attributes());
+        }
+
+        void operator()(resource_expression const& value)
+        {
+            (*this)(value.type());
+            write(value.bodies());
+            write_byte(static_cast<uint8_t>(value.status()));
+        }
+
+        void operator()(resource_defaults_expression const& value)
+        {
+            (*this)(value.type());
+            write(value.attributes());
+        }
+
+        void operator()(resource_override_expression const& value)
+        {
+            (*this)(value.reference());
+            write(value.attributes());
+        }
+
+        void operator()(deferred_body const& value)
+        {
+            write_position(value.begin());
+            write_position(value.end());
+        }
+
+        void operator()(class_definition_expression const& value)
+        {
+            write_position(value.position());
+            (*this)(value.name());
+            write(value.parameters());
+            write(value.parent());
+            write(value.body());
+            write(value.deferred_body());
+        }
+
+        void operator()(defined_type_expression const& value)
+        {
+            write_position(value.position());
+            (*this)(value.name());
+            write(value.parameters());
+            write(value.body());
+            write(value.deferred_body());
+        }
+
+        void operator()(hostname const& value)
+        {
+            write_position(value.position());
+            write_string(value.value());
+            write_bool(value.regex());
+        }
+
+        void operator()(node_definition_expression const& value)
+        {
+            write_position(value.position());
+            write(value.names());
+            write(value.body());
+            write(value.deferred_body());
+        }
+
+        void operator()(query const& value)
+        {
+            (*this)(value.attribute());
+            write_byte(static_cast<uint8_t>(value.op()));
+            (*this)(value.value());
+        }
+
+        void operator()(binary_query_expression const& value)
+        {
+            write_byte(static_cast<uint8_t>(value.op()));
+            (*this)(value.operand());
+        }
+
+        void operator()(collection_expression const& value)
+        {
+            write_byte(static_cast<uint8_t>(value.kind()));
+            (*this)(value.type());
+            write(value.first());
+            write(value.remainder());
+        }
+
+        void operator()(unary_expression const& value)
+        {
+            write_position(value.position());
+            write_byte(static_cast<uint8_t>(value.op()));
+            (*this)(value.operand());
+        }
+
+        void operator()(binary_expression const& value)
+        {
+            write_byte(static_cast<uint8_t>(value.op()));
+            (*this)(value.operand());
+        }
+
+        void operator()(postfix_expression const& value)
+        {
+            (*this)(value.primary());
+            write(value.subexpressions());
+        }
+
+        void operator()(expression const& value)
+        {
+            (*this)(value.primary());
+            write(value.binary());
+        }
+
+        void operator()(basic_expression const& value)
+        {
+            write_variant(value);
+        }
+
+        void operator()(control_flow_expression const& value)
+        {
+            write_variant(value);
+        }
+
+        void operator()(catalog_expression const& value)
+        {
+            write_variant(value);
+        }
+
+        void operator()(primary_expression const& value)
+        {
+            write_variant(value);
+        }
+
+        void operator()(postfix_subexpression const& value)
+        {
+            write_variant(value);
+        }
+
+     private:
+        ostream& _os;
+    };
+
+    struct syntax_tree_reader
+    {
+        explicit syntax_tree_reader(istream& is) :
+            _is(is)
+        {
+        }
+
+        uint8_t read_byte()
+        {
+            auto value = _is.get();
+            if (value == istream::traits_type::eof()) {
+                throw serialization_exception("unexpected end of serialized syntax tree.");
+            }
+            return static_cast<uint8_t>(value);
+        }
+
+        uint64_t read_size()
+        {
+            uint64_t value = 0;
+            for (unsigned int shift = 0;; shift += 7) {
+                if (shift > 63) {
+                    throw serialization_exception("serialized syntax tree contains an invalid size.");
+                }
+                auto byte = read_byte();
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) {
+                    return value;
+                }
+            }
+        }
+
+        int64_t read_integer()
+        {
+            auto value = read_size();
+            return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+        bool read_bool()
+        {
+            auto value = read_byte();
+            if (value > 1) {
+                throw serialization_exception("serialized syntax tree contains an invalid boolean.");
+            }
+            return value == 1;
+        }
+
+        std::string read_string()
+        {
+            auto size = read_size();
+
+            // Read in chunks so a corrupt size fails at the end of input rather than allocating up front
+            std::string value;
+            char buffer[4096];
+            while (size > 0) {
+                auto count = static_cast<size_t>(min<uint64_t>(size, sizeof(buffer)));
+                if (!_is.read(buffer, count)) {
+                    throw serialization_exception("unexpected end of serialized syntax tree.");
+                }
+                value.append(buffer, count);
+                size -= count;
+            }
+            return value;
+        }
+
+        lexer::position read_position()
+        {
+            auto offset = read_size();
+            auto line = read_size();
+            return lexer::position(offset, line);
+        }
+
+        template <typename Enum>
+        Enum read_enum(Enum last)
+        {
+            auto value = read_byte();
+            if (value > static_cast<uint8_t>(last)) {
+                throw serialization_exception("serialized syntax tree contains an invalid operator.");
+            }
+            return static_cast<Enum>(value);
+        }
+
+        template <typename T>
+        void read(boost::optional<T>& value)
+        {
+            if (!read_bool()) {
+                value = boost::none;
+                return;
+            }
+            T element;
+            read(element);
+            value = rvalue_cast(element);
+        }
+
+        template <typename T>
+        void read(vector<T>& values)
+        {
+            // Every element consumes at least one byte, so a corrupt size fails at the end of input
+            auto size = read_size();
+            values.clear();
+            for (uint64_t i = 0; i < size; ++i) {
+                values.emplace_back();
+                read(values.back());
+            }
+        }
+
+        template <typename T, typename Variant>
+        void read_as(Variant& value)
+        {
+            T element;
+            read(element);
+            value = rvalue_cast(element);
+        }
+
+        void read(number::value_type& value)
+        {
+            switch (read_byte()) {
+                case 0:
+                    value = read_integer();
+                    break;
+
+                case 1: {
+                    long double floating;
+                    istringstream ss(read_string());
+                    if (!(ss >> floating)) {
+                        throw serialization_exception("serialized syntax tree contains an invalid floating point number.");
+                    }
+                    value = floating;
+                    break;
+                }
+
+                default:
+                    throw serialization_exception("serialized syntax tree contains an invalid number.");
+            }
+        }
+
+        void read(undef& value)
+        {
+            value = undef(read_position());
+        }
+
+        void read(defaulted& value)
+        {
+            value = defaulted(read_position());
+        }
+
+        void read(boolean& value)
+        {
+            auto position = read_position();
+            value = boolean(rvalue_cast(position), read_bool());
+        }
+
+        void read(number& value)
+        {
+            auto position = read_position();
+            number::value_type number_value;
+            read(number_value);
+            value = number(rvalue_cast(position), rvalue_cast(number_value));
+        }
+
+        void read(ast::string& value)
+        {
+            auto position = read_position();
+            auto text = read_string();
+            auto escapes = read_string();
+            auto quote = static_cast<char>(read_byte());
+            auto interpolated = read_bool();
+            auto format = read_string();
+            auto margin = read_integer();
+            auto remove_break = read_bool();
+            shared_ptr<interpolated_string const> compiled;
+            if (read_bool()) {
+                vector<interpolated_string::segment> segments;
+                read(segments);
+                vector<interpolated_string::warning> warnings;
+                auto size = read_size();
+                for (uint64_t i = 0; i < size; ++i) {
+                    auto warning_position = read_position();
+                    warnings.emplace_back(rvalue_cast(warning_position), read_string());
+                }
+                compiled = make_shared<interpolated_string const>(rvalue_cast(segments), rvalue_cast(warnings));
+            }
+            value = ast::string(rvalue_cast(position), rvalue_cast(text), rvalue_cast(escapes), quote, interpolated, rvalue_cast(format), static_cast<int>(margin), remove_break, rvalue_cast(compiled));
+        }
+
+        void read(interpolated_string::segment& value)
+        {
+            switch (read_byte()) {
+                case 0:
+                    value = read_string();
+                    break;
+
+                case 1:
+                    read_as<vector<expression>>(value);
+                    break;
+
+                default:
+                    throw serialization_exception("serialized syntax tree contains an invalid string segment.");
+            }
+        }
+
+        void read(regex& value)
+        {
+            auto position = read_position();
+            value = regex(rvalue_cast(position), read_string());
+        }
+
+        void read(variable& value)
+        {
+            auto position = read_position();
+            value = variable(rvalue_cast(position), read_string());
+        }
+
+        void read(name& value)
+        {
+            auto position = read_position();
+            value = name(rvalue_cast(position), read_string());
+        }
+
+        void read(bare_word& value)
+        {
+            auto position = read_position();
+            value = bare_word(rvalue_cast(position), read_string());
+        }
+
+        void read(ast::type& value)
+        {
+            auto position = read_position();
+            value = ast::type(rvalue_cast(position), read_string());
+        }
+
+        void read(array& value)
+        {
+            auto position = read_position();
+            boost::optional<vector<expression>> elements;
+            read(elements);
+            value = array(rvalue_cast(position), rvalue_cast(elements));
+        }
+
+        void read(hash_pair& value)
+        {
+            read(value.first);
+            read(value.second);
+        }
+
+        void read(hash& value)
+        {
+            auto position = read_position();
+            boost::optional<vector<hash_pair>> elements;
+            read(elements);
+            value = hash(rvalue_cast(position), rvalue_cast(elements));
+        }
+
+        void read(selector_case_expression& value)
+        {
+            expression selector;
+            read(selector);
+            expression result;
+            read(result);
+            value = selector_case_expression(rvalue_cast(selector), rvalue_cast(result));
+        }
+
+        void read(selector_expression& value)
+        {
+            auto position = read_position();
+            vector<selector_case_expression> cases;
+            read(cases);
+            value = selector_expression(rvalue_cast(position), rvalue_cast(cases));
+        }
+
+        void read(case_proposition& value)
+        {
+            vector<expression> options;
+            read(options);
+            boost::optional<vector<expression>> body;
+            read(body);
+            value = case_proposition(rvalue_cast(options), rvalue_cast(body));
+        }
+
+        void read(case_expression& value)
+        {
+            auto position = read_position();
+            expression conditional;
+            read(conditional);
+            vector<case_proposition> propositions;
+            read(propositions);
+            value = case_expression(rvalue_cast(position), rvalue_cast(conditional), rvalue_cast(propositions));
+        }
+
+        void read(else_expression& value)
+        {
+            auto position = read_position();
+            boost::optional<vector<expression>> body;
+            read(body);
+            value = else_expression(rvalue_cast(position), rvalue_cast(body));
+        }
+
+        void read(elsif_expression& value)
+        {
+            auto position = read_position();
+            expression conditional;
+            read(conditional);
+            boost::optional<vector<expression>> body;
+            read(body);
+            value = elsif_expression(rvalue_cast(position), rvalue_cast(conditional), rvalue_cast(body));
+        }
+
+        void read(if_expression& value)
+        {
+            auto position = read_position();
+            expression conditional;
+            read(conditional);
+            boost::optional<vector<expression>> body;
+            read(body);
+            boost::optional<vector<elsif_expression>> elsifs;
+            read(elsifs);
+            boost::optional<else_expression> else_;
+            read(else_);
+            value = if_expression(rvalue_cast(position), rvalue_cast(conditional), rvalue_cast(body), rvalue_cast(elsifs), rvalue_cast(else_));
+        }
+
+        void read(unless_expression& value)
+        {
+            auto position = read_position();
+            expression conditional;
+            read(conditional);
+            boost::optional<vector<expression>> body;
+            read(body);
+            boost::optional<else_expression> else_;
+            read(else_);
+            value = unless_expression(rvalue_cast(position), rvalue_cast(conditional), rvalue_cast(body), rvalue_cast(else_));
+        }
+
+        void read(access_expression& value)
+        {
+            auto position = read_position();
+            vector<expression> arguments;
+            read(arguments);
+            value = access_expression(rvalue_cast(position), rvalue_cast(arguments));
+        }
+
+        void read(parameter& value)
+        {
+            boost::optional<primary_expression> type;
+            read(type);
+            auto captures = read_bool();
+            ast::variable variable;
+            read(variable);
+            boost::optional<expression> default_value;
+            read(default_value);
+            value = parameter(rvalue_cast(type), captures, rvalue_cast(variable), rvalue_cast(default_value));
+        }
+
+        void read(lambda& value)
+        {
+            auto position = read_position();
+            boost::optional<vector<parameter>> parameters;
+            read(parameters);
+            boost::optional<vector<expression>> body;
+            read(body);
+            value = lambda(rvalue_cast(position), rvalue_cast(parameters), rvalue_cast(body));
+        }
+
+        void read(method_call_expression& value)
+        {
+            name method;
+            read(method);
+            boost::optional<vector<expression>> arguments;
+            read(arguments);
+            boost::optional<ast::lambda> lambda;
+            read(lambda);
+            value = method_call_expression(rvalue_cast(method), rvalue_cast(arguments), rvalue_cast(lambda));
+        }
+
+        void read(function_call_expression& value)
+        {
+            name function;
+            read(function);
+            boost::optional<vector<expression>> arguments;
+            read(arguments);
+            boost::optional<ast::lambda> lambda;
+            read(lambda);
+            value = function_call_expression(rvalue_cast(function), rvalue_cast(arguments), rvalue_cast(lambda));
+        }
+
+        void read(attribute_expression& value)
+        {
+            name attribute_name;
+            read(attribute_name);
+            auto op = read_enum(attribute_operator::append);
+            expression attribute_value;
+            read(attribute_value);
+            value = attribute_expression(rvalue_cast(attribute_name), op, rvalue_cast(attribute_value));
+        }
+
+        void read(resource_body& value)
+        {
+            expression title;
+            read(title);
+            boost::optional<vector<attribute_expression>> attributes;
+            read(attributes);
+            value = resource_body(rvalue_cast(title), rvalue_cast(attributes));
+        }
+
+        void read(resource_expression& value)
+        {
+            primary_expression type;
+            read(type);
+            vector<resource_body> bodies;
+            read(bodies);
+            auto status = read_enum(resource_status::exported);
+            value = resource_expression(rvalue_cast(type), rvalue_cast(bodies), status);
+        }
+
+        void read(resource_defaults_expression& value)
+        {
+            ast::type type;
+            read(type);
+            boost::optional<vector<attribute_expression>> attributes;
+            read(attributes);
+            value = resource_defaults_expression(rvalue_cast(type), rvalue_cast(attributes));
+        }
+
+        void read(resource_override_expression& value)
+        {
+            primary_expression reference;
+            read(reference);
+            boost::optional<vector<attribute_expression>> attributes;
+            read(attributes);
+            value = resource_override_expression(rvalue_cast(reference), rvalue_cast(attributes));
+        }
+
+        void read(deferred_body& value)
+        {
+            auto begin = read_position();
+            auto end = read_position();
+            value = deferred_body(rvalue_cast(begin), rvalue_cast(end));
+        }
+
+        void read(class_definition_expression& value)
+        {
+            auto position = read_position();
+            name class_name;
+            read(class_name);
+            boost::optional<vector<parameter>> parameters;
+            read(parameters);
+            boost::optional<name> parent;
+            read(parent);
+            boost::optional<vector<expression>> body;
+            read(body);
+            boost::optional<deferred_body> deferred;
+            read(deferred);
+            if (deferred) {
+                value = class_definition_expression(rvalue_cast(position), rvalue_cast(class_name), rvalue_cast(parameters), rvalue_cast(parent), rvalue_cast(*deferred));
+                return;
+            }
+            value = class_definition_expression(rvalue_cast(position), rvalue_cast(class_name), rvalue_cast(parameters), rvalue_cast(parent), rvalue_cast(body));
+        }
+
+        void read(defined_type_expression& value)
+        {
+            auto position = read_position();
+            name type_name;
+            read(type_name);
+            boost::optional<vector<parameter>> parameters;
+            read(parameters);
+            boost::optional<vector<expression>> body;
+            read(body);
+            boost::optional<deferred_body> deferred;
+            read(deferred);
+            if (deferred) {
+                value = defined_type_expression(rvalue_cast(position), rvalue_cast(type_name), rvalue_cast(parameters), rvalue_cast(*deferred));
+                return;
+            }
+            value = defined_type_expression(rvalue_cast(position), rvalue_cast(type_name), rvalue_cast(parameters), rvalue_cast(body));
+        }
+
+        void read(hostname& value)
+        {
+            auto position = read_position();
+            auto text = read_string();
+            auto regex = read_bool();
+            value = hostname(rvalue_cast(position), rvalue_cast(text), regex);
+        }
+
+        void read(node_definition_expression& value)
+        {
+            auto position = read_position();
+            vector<hostname> names;
+            read(names);
+            boost::optional<vector<expression>> body;
+            read(body);
+            boost::optional<deferred_body> deferred;
+            read(deferred);
+            if (deferred) {
+                value = node_definition_expression(rvalue_cast(position), rvalue_cast(names), rvalue_cast(*deferred));
+                return;
+            }
+            value = node_definition_expression(rvalue_cast(position), rvalue_cast(names), rvalue_cast(body));
+        }
+
+        void read(query& value)
+        {
+            name attribute;
+            read(attribute);
+            auto op = read_enum(attribute_query_operator::not_equals);
+            basic_expression query_value;
+            read(query_value);
+            value = query(rvalue_cast(attribute), op, rvalue_cast(query_value));
+        }
+
+        void read(binary_query_expression& value)
+        {
+            auto op = read_enum(binary_query_operator::logical_or);
+            query operand;
+            read(operand);
+            value = binary_query_expression(op, rvalue_cast(operand));
+        }
+
+        void read(collection_expression& value)
+        {
+            auto kind = read_enum(collection_kind::exported);
+            ast::type type;
+            read(type);
+            boost::optional<query> first;
+            read(first);
+            vector<binary_query_expression> remainder;
+            read(remainder);
+            value = collection_expression(kind, rvalue_cast(type), rvalue_cast(first), rvalue_cast(remainder));
+        }
+
+        void read(unary_expression& value)
+        {
+            auto position = read_position();
+            auto op = read_enum(unary_operator::splat);
+            primary_expression operand;
+            read(operand);
+            value = unary_expression(rvalue_cast(position), op, rvalue_cast(operand));
+        }
+
+        void read(binary_expression& value)
+        {
+            auto op = read_enum(binary_operator::out_edge_subscribe);
+            primary_expression operand;
+            read(operand);
+            value = binary_expression(op, rvalue_cast(operand));
+        }
+
+        void read(postfix_expression& value)
+        {
+            primary_expression primary;
+            read(primary);
+            vector<postfix_subexpression> subexpressions;
+            read(subexpressions);
+            value = postfix_expression(rvalue_cast(primary), rvalue_cast(subexpressions));
+        }
+
+        void read(expression& value)
+        {
+            primary_expression primary;
+            read(primary);
+            vector<binary_expression> binary;
+            read(binary);
+            value = expression(rvalue_cast(primary), rvalue_cast(binary));
+        }
+
+        void read(basic_expression& value)
+        {
+            // The tags are the variant's type indexes; see the basic_expression typedef
+            switch (read_byte()) {
+                case 0: read_as<undef>(value); break;
+                case 1: read_as<defaulted>(value); break;
+                case 2: read_as<boolean>(value); break;
+                case 3: read_as<number>(value); break;
+                case 4: read_as<ast::string>(value); break;
+                case 5: read_as<regex>(value); break;
+                case 6: read_as<variable>(value); break;
+                case 7: read_as<name>(value); break;
+                case 8: read_as<bare_word>(value); break;
+                case 9: read_as<ast::type>(value); break;
+                case 10: read_as<array>(value); break;
+                case 11: read_as<hash>(value); break;
+                default:
+                    throw serialization_exception("serialized syntax tree contains an invalid basic expression.");
+            }
+        }
+
+        void read(control_flow_expression& value)
+        {
+            switch (read_byte()) {
+                case 0: read_as<case_expression>(value); break;
+                case 1: read_as<if_expression>(value); break;
+                case 2: read_as<unless_expression>(value); break;
+                case 3: read_as<function_call_expression>(value); break;
+                default:
+                    throw serialization_exception("serialized syntax tree contains an invalid control flow expression.");
+            }
+        }
+
+        void read(catalog_expression& value)
+        {
+            switch (read_byte()) {
+                case 0: read_as<resource_expression>(value); break;
+                case 1: read_as<resource_defaults_expression>(value); break;
+                case 2: read_as<resource_override_expression>(value); break;
+                case 3: read_as<class_definition_expression>(value); break;
+                case 4: read_as<defined_type_expression>(value); break;
+                case 5: read_as<node_definition_expression>(value); break;
+                case 6: read_as<collection_expression>(value); break;
+                default:
+                    throw serialization_exception("serialized syntax tree contains an invalid catalog expression.");
+            }
+        }
+
+        void read(primary_expression& value)
+        {
+            switch (read_byte()) {
+                case 0: value = boost::blank(); break;
+                case 1: read_as<basic_expression>(value); break;
+                case 2: read_as<control_flow_expression>(value); break;
+                case 3: read_as<catalog_expression>(value); break;
+                case 4: read_as<unary_expression>(value); break;
+                case 5: read_as<postfix_expression>(value); break;
+                case 6: read_as<expression>(value); break;
+                default:
+                    throw serialization_exception("serialized syntax tree contains an invalid primary expression.");
+            }
+        }
+
+        void read(postfix_subexpression& value)
+        {
+            switch (read_byte()) {
+                case 0: read_as<selector_expression>(value); break;
+                case 1: read_as<access_expression>(value); break;
+                case 2: read_as<method_call_expression>(value); break;
+                default:
+                    throw serialization_exception("serialized syntax tree contains an invalid postfix expression.");
+            }
+        }
+
+     private:
+        istream& _is;
+    };
+
+    void serialize(ostream& os, syntax_tree const& tree)
+    {
+        syntax_tree_writer writer(os);
+        os.write(serialization_magic, sizeof(serialization_magic));
+        writer.write_size(SERIALIZATION_FORMAT_VERSION);
+        writer.write(tree.body());
+        writer.write_position(tree.end());
+
+        if (!os) {
+            throw serialization_exception("failed to write serialized syntax tree.");
+        }
+    }
+
+    syntax_tree deserialize(istream& is)
+    {
+        char magic[sizeof(serialization_magic)];
+        if (!is.read(magic, sizeof(magic)) || !equal(begin(magic), end(magic), begin(serialization_magic))) {
+            throw serialization_exception("input is not a serialized syntax tree.");
+        }
+
+        syntax_tree_reader reader(is);
+        auto version = reader.read_size();
+        if (version != SERIALIZATION_FORMAT_VERSION) {
+            throw serialization_exception((boost::format("unsupported serialized syntax tree version %1%: expected version %2%.") % version % SERIALIZATION_FORMAT_VERSION).str());
+        }
+
+        boost::optional<vector<expression>> body;
+        reader.read(body);
+        auto end = reader.read_position();
+
+        if (is.peek() != istream::traits_type::eof()) {
+            throw serialization_exception("unexpected data at the end of serialized syntax tree.");
+        }
+        return syntax_tree(rvalue_cast(body), rvalue_cast(end));
+    }
+
+}}  // namespace puppet::ast
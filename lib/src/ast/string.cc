@@ -1,4 +1,5 @@
 #include <puppet/ast/string.hpp>
+#include <puppet/cast.hpp>
 
 using namespace std;
 
@@ -12,6 +13,19 @@ namespace puppet { namespace ast {
     {
     }
 
+    string::string(lexer::position position, std::string value, std::string escapes, char quote, bool interpolated, std::string format, int margin, bool remove_break, shared_ptr<interpolated_string const> compiled) :
+        _position(rvalue_cast(position)),
+        _value(rvalue_cast(value)),
+        _escapes(rvalue_cast(escapes)),
+        _quote(quote),
+        _interpolated(interpolated),
+        _format(rvalue_cast(format)),
+        _margin(margin),
+        _remove_break(remove_break),
+        _compiled(rvalue_cast(compiled))
+    {
+    }
+
     std::string const& string::value() const
     {
         return _value;
@@ -52,6 +66,11 @@ namespace puppet { namespace ast {
         return _position;
     }
 
+    shared_ptr<interpolated_string const> const& string::compiled() const
+    {
+        return _compiled;
+    }
+
     ostream& operator<<(ostream& os, string const& str)
     {
         os << (str.interpolated() ? '"' : '\'') << str.value() << (str.interpolated() ? '"' : '\'');
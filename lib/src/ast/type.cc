@@ -1,4 +1,5 @@
 #include <puppet/ast/type.hpp>
+#include <puppet/cast.hpp>
 
 using namespace std;
 
@@ -8,7 +9,18 @@ namespace puppet { namespace ast {
     {
     }
 
+    type::type(lexer::position position, string name) :
+        _position(rvalue_cast(position)),
+        _name(name)
+    {
+    }
+
     string const& type::name() const
+    {
+        return _name.str();
+    }
+
+    puppet::symbol const& type::symbol() const
     {
         return _name;
     }
@@ -15,12 +15,17 @@ namespace puppet { namespace ast {
 
     variable::variable(lexer::position position, string name) :
         _position(rvalue_cast(position)),
-        _name(rvalue_cast(name))
+        _name(name)
     {
         validate_name();
     }
 
     string const& variable::name() const
+    {
+        return _name.str();
+    }
+
+    puppet::symbol const& variable::symbol() const
     {
         return _name;
     }
@@ -36,7 +41,7 @@ namespace puppet { namespace ast {
         static const std::regex valid_variable_regex(valid_variable_pattern);
 
         // Ensure the parameter name is valid
-        if (!regex_match(_name, valid_variable_regex)) {
+        if (!regex_match(_name.str(), valid_variable_regex)) {
             throw puppet::compiler::parse_exception(_position, (boost::format("variable name '%1%' is not a valid variable name: the name must conform to /%2%/.") % _name % valid_variable_pattern).str());
         }
     }
@@ -0,0 +1,478 @@
+#include <puppet/compiler/autoloader.hpp>
+#include <puppet/compiler/parser.hpp>
+#include <puppet/lexer/source_buffer.hpp>
+#include <puppet/cast.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/algorithm/string.hpp>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+using namespace puppet::lexer;
+
+namespace fs = boost::filesystem;
+namespace sys = boost::system;
+
+namespace puppet { namespace compiler {
+
+    // Bump this when the index format changes so older indexes are rebuilt
+    static char const index_header[] = "puppetcpp autoload index 3";
+
+    static string manifest_path(string const& directory, string const& name)
+    {
+        // The manifest for 'foo' is 'foo/manifests/init.pp' and the manifest for 'foo::bar::baz' is 'foo/manifests/bar/baz.pp'
+        vector<string> parts;
+        boost::split(parts, name, boost::is_any_of(":"), boost::token_compress_on);
+        if (parts.empty() || parts.front().empty()) {
+            return {};
+        }
+
+        fs::path path = fs::path(directory) / parts.front() / "manifests";
+        if (parts.size() == 1) {
+            return (path / "init.pp").string();
+        }
+        for (size_t i = 1; i < parts.size(); ++i) {
+            path /= parts[i];
+        }
+        return path.string() + ".pp";
+    }
+
+    static file_stamp read_stamp(istream& record, string& path)
+    {
+        int64_t modified = -1;
+        uintmax_t size = 0;
+        int64_t taken = 0;
+        record >> modified >> size >> taken;
+        record.get();
+        getline(record, path);
+        return file_stamp(modified, size, taken);
+    }
+
+    static void write_stamp(ostream& file, file_stamp const& stamp, string const& path)
+    {
+        file << stamp.modified() << ' ' << stamp.size() << ' ' << stamp.taken() << ' ' << path << '\n';
+    }
+
+    template <typename Callback>
+    static void scan_definitions(source_buffer const& source, Callback const& callback)
+    {
+        typedef parser::lexer_type lexer_type;
+        typedef boost::iterator_range<lexer_string_iterator> range_type;
+
+        auto to_id = [](token_id id) { return static_cast<typename lexer_type::id_type>(id); };
+        auto to_char_id = [](char id) { return static_cast<typename lexer_type::id_type>(id); };
+
+        // Each class or defined type body that is open; defined type bodies have an empty name and cannot contain definitions
+        struct body
+        {
+            string name;
+            size_t depth;
+        };
+        vector<body> bodies;
+
+        // The definition waiting for its opening brace
+        boost::optional<body> pending;
+
+        size_t depth = 0;
+        size_t parentheses = 0;
+        bool keyword = false;
+        bool is_class = false;
+
+        // Constructing a lexer is expensive, so each thread constructs one and reuses it
+        static thread_local lexer_type lexer;
+        auto begin = lex_begin(source);
+        auto end = lex_end(source);
+        auto token_end = lexer.end();
+        for (auto it = lexer.begin(begin, end); it != token_end && token_is_valid(*it); ++it) {
+            auto id = it->id();
+
+            // A name following 'class' or 'define' is a definition if it is at top-level or directly inside a class body
+            if (keyword) {
+                keyword = false;
+                if ((id == to_id(token_id::name) || id == to_id(token_id::statement_call)) &&
+                    (depth == 0 || (!bodies.empty() && bodies.back().depth == depth && !bodies.back().name.empty()))) {
+                    auto const& range = boost::get<range_type>(it->value());
+                    string name(range.begin(), range.end());
+                    if (boost::starts_with(name, "::")) {
+                        name = name.substr(2);
+                    }
+                    if (!bodies.empty()) {
+                        name = bodies.back().name + "::" + name;
+                    }
+                    callback(name);
+                    pending = body{ is_class ? rvalue_cast(name) : string(), 0 };
+                    continue;
+                }
+            }
+
+            if (id == to_id(token_id::keyword_class) || id == to_id(token_id::keyword_define)) {
+                keyword = true;
+                is_class = id == to_id(token_id::keyword_class);
+            } else if (id == to_char_id('(')) {
+                ++parentheses;
+            } else if (id == to_char_id(')')) {
+                if (parentheses > 0) {
+                    --parentheses;
+                }
+            } else if (id == to_char_id('{')) {
+                ++depth;
+
+                // The first brace outside of the parameter list opens the definition's body
+                if (pending && parentheses == 0) {
+                    pending->depth = depth;
+                    bodies.emplace_back(rvalue_cast(*pending));
+                    pending = boost::none;
+                }
+            } else if (id == to_char_id('}')) {
+                if (!bodies.empty() && bodies.back().depth == depth) {
+                    bodies.pop_back();
+                }
+                if (depth > 0) {
+                    --depth;
+                }
+            }
+        }
+    }
+
+    autoloader::autoloader(vector<string> directories, string index_path) :
+        _directories(rvalue_cast(directories)),
+        _index_path(rvalue_cast(index_path)),
+        _loaded(false)
+    {
+    }
+
+    vector<string> const& autoloader::directories() const
+    {
+        return _directories;
+    }
+
+    string const& autoloader::index_path() const
+    {
+        return _index_path;
+    }
+
+    boost::optional<definition_location> autoloader::find(string const& name)
+    {
+        lock_guard<mutex> lock(_mutex);
+        load();
+
+        auto key = boost::to_lower_copy(name);
+        if (boost::starts_with(key, "::")) {
+            key = key.substr(2);
+        }
+
+        auto it = _definitions.find(key);
+        if (it != _definitions.end()) {
+            // Directory stamps do not change when a manifest is edited, so check the manifest itself
+            auto path = it->second.path;
+            file_stamp stamp(path);
+            auto const& indexed = _manifest_stamps[path];
+            if (stamp == indexed && !indexed.racy()) {
+                return it->second;
+            }
+
+            // Re-index the manifest and look again
+            for (auto definition = _definitions.begin(); definition != _definitions.end();) {
+                if (definition->second.path == path) {
+                    definition = _definitions.erase(definition);
+                    continue;
+                }
+                ++definition;
+            }
+            if (!stamp.exists()) {
+                _manifest_stamps.erase(path);
+            } else {
+                scan_manifest(path, stamp);
+            }
+            write();
+
+            it = _definitions.find(key);
+            if (it != _definitions.end()) {
+                return it->second;
+            }
+        }
+
+        // Names that are not indexed are usually built-in types, so remember them rather than searching again
+        if (_misses.count(key)) {
+            return boost::none;
+        }
+
+        // Check the manifest the name would conventionally be in, as it may have been added or edited since indexing
+        if (scan_conventional(key)) {
+            write();
+            it = _definitions.find(key);
+            if (it != _definitions.end()) {
+                return it->second;
+            }
+        }
+        _misses.insert(rvalue_cast(key));
+        return boost::none;
+    }
+
+    void autoloader::rebuild()
+    {
+        lock_guard<mutex> lock(_mutex);
+        build();
+        write();
+        _loaded = true;
+    }
+
+    void autoloader::refresh(chrono::steady_clock::duration interval)
+    {
+        lock_guard<mutex> lock(_mutex);
+
+        // Every request refreshes, so only search for the missing names again once the interval has passed
+        auto now = chrono::steady_clock::now();
+        if (now - _refreshed < interval) {
+            return;
+        }
+        _misses.clear();
+        _refreshed = now;
+    }
+
+    vector<string> autoloader::manifests()
+    {
+        lock_guard<mutex> lock(_mutex);
+        load();
+
+        vector<string> paths;
+        for (auto const& definition : _definitions) {
+            paths.push_back(definition.second.path);
+        }
+        sort(paths.begin(), paths.end());
+        paths.erase(unique(paths.begin(), paths.end()), paths.end());
+        return paths;
+    }
+
+    void autoloader::load()
+    {
+        if (_loaded) {
+            return;
+        }
+        _loaded = true;
+
+        if (read()) {
+            return;
+        }
+        build();
+        write();
+    }
+
+    bool autoloader::read()
+    {
+        if (_index_path.empty()) {
+            return false;
+        }
+
+        ifstream file(_index_path);
+        if (!file) {
+            return false;
+        }
+
+        string line;
+        if (!getline(file, line) || line != index_header) {
+            return false;
+        }
+
+        // Each line is a record type followed by its fields; the path is always last as it may contain spaces
+        vector<string> roots;
+        bool valid = true;
+        while (valid && getline(file, line)) {
+            istringstream record(line);
+            string type;
+            record >> type;
+
+            if (type == "root") {
+                string path;
+                record.get();
+                getline(record, path);
+                roots.emplace_back(rvalue_cast(path));
+            } else if (type == "directory") {
+                string path;
+                auto stamp = read_stamp(record, path);
+                // A racy stamp cannot show that no module or manifest was added since, so the index must be rebuilt
+                valid = record && !stamp.racy() && file_stamp(path) == stamp;
+                _directory_stamps.emplace_back(rvalue_cast(path), stamp);
+            } else if (type == "manifest") {
+                string path;
+                auto stamp = read_stamp(record, path);
+                valid = static_cast<bool>(record);
+                _manifest_stamps[rvalue_cast(path)] = stamp;
+            } else if (type == "definition") {
+                string name;
+                definition_location location;
+                record >> name;
+                record.get();
+                getline(record, location.path);
+                valid = static_cast<bool>(record);
+                _definitions.emplace(rvalue_cast(name), rvalue_cast(location));
+            } else {
+                valid = false;
+            }
+        }
+
+        // The index is only current if it was built for the same module directories and none have changed
+        if (!valid || roots != _directories) {
+            _directory_stamps.clear();
+            _manifest_stamps.clear();
+            _definitions.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void autoloader::write() const
+    {
+        if (_index_path.empty()) {
+            return;
+        }
+
+        // Failing to write the index is not an error; it will be rebuilt on the next run
+        sys::error_code ec;
+        auto directory = fs::path(_index_path).parent_path();
+        if (!directory.empty()) {
+            fs::create_directories(directory, ec);
+            if (ec) {
+                return;
+            }
+        }
+
+        // Write to a unique temporary file and rename it into place so readers never see a partial index
+        auto temp_path = (directory / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp")).string();
+        {
+            ofstream file(temp_path, ios::trunc);
+            if (!file) {
+                return;
+            }
+            file << index_header << '\n';
+            for (auto const& root : _directories) {
+                file << "root " << root << '\n';
+            }
+            for (auto const& directory : _directory_stamps) {
+                file << "directory ";
+                write_stamp(file, directory.second, directory.first);
+            }
+            for (auto const& manifest : _manifest_stamps) {
+                file << "manifest ";
+                write_stamp(file, manifest.second, manifest.first);
+            }
+            for (auto const& definition : _definitions) {
+                file << "definition " << definition.first << ' ' << definition.second.path << '\n';
+            }
+            file.close();
+            if (!file) {
+                fs::remove(temp_path, ec);
+                return;
+            }
+        }
+
+        fs::rename(temp_path, _index_path, ec);
+        if (ec) {
+            fs::remove(temp_path, ec);
+        }
+    }
+
+    void autoloader::build()
+    {
+        _directory_stamps.clear();
+        _manifest_stamps.clear();
+        _definitions.clear();
+        _misses.clear();
+
+        for (auto const& directory : _directories) {
+            _directory_stamps.emplace_back(directory, file_stamp(directory));
+
+            sys::error_code ec;
+            if (!fs::is_directory(directory, ec)) {
+                continue;
+            }
+
+            // Scan the modules in name order so that the index is the same on every run
+            vector<string> modules;
+            for (fs::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+                if (fs::is_directory(it->status())) {
+                    modules.emplace_back(it->path().string());
+                }
+            }
+            sort(modules.begin(), modules.end());
+
+            for (auto const& module : modules) {
+                _directory_stamps.emplace_back(module, file_stamp(module));
+                scan_directory((fs::path(module) / "manifests").string());
+            }
+        }
+    }
+
+    void autoloader::scan_directory(string const& directory)
+    {
+        _directory_stamps.emplace_back(directory, file_stamp(directory));
+
+        sys::error_code ec;
+        if (!fs::is_directory(directory, ec)) {
+            return;
+        }
+
+        vector<fs::path> entries;
+        for (fs::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+            entries.emplace_back(it->path());
+        }
+        sort(entries.begin(), entries.end());
+
+        for (auto const& entry : entries) {
+            if (fs::is_directory(entry, ec)) {
+                scan_directory(entry.string());
+            } else if (entry.extension() == ".pp" && fs::is_regular_file(entry, ec)) {
+                scan_manifest(entry.string(), file_stamp(entry.string()));
+            }
+        }
+    }
+
+    void autoloader::scan_manifest(string const& path, file_stamp const& stamp)
+    {
+        _manifest_stamps[path] = stamp;
+
+        try {
+            source_buffer source(path);
+            scan_definitions(source, [&](string const& name) {
+                add_definition(name, path);
+            });
+        } catch (exception const&) {
+            // Keep the definitions found before the error; loading the manifest will report the error
+        }
+    }
+
+    bool autoloader::scan_conventional(string const& name)
+    {
+        bool scanned = false;
+        for (auto const& directory : _directories) {
+            auto path = manifest_path(directory, name);
+            if (path.empty()) {
+                break;
+            }
+            file_stamp stamp(path);
+            if (!stamp.exists()) {
+                continue;
+            }
+            auto it = _manifest_stamps.find(path);
+            if (it != _manifest_stamps.end() && it->second == stamp && !it->second.racy()) {
+                continue;
+            }
+            scan_manifest(path, stamp);
+            scanned = true;
+        }
+        return scanned;
+    }
+
+    void autoloader::add_definition(string name, string const& path)
+    {
+        boost::to_lower(name);
+
+        // Earlier module directories take precedence, so never replace an existing definition
+        definition_location location;
+        location.path = path;
+        _definitions.emplace(rvalue_cast(name), rvalue_cast(location));
+    }
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,88 @@
+#include <puppet/compiler/cache.hpp>
+#include <puppet/compiler/hash.hpp>
+#include <puppet/ast/serialization.hpp>
+#include <puppet/cast.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <fstream>
+
+using namespace std;
+using namespace puppet::lexer;
+
+namespace fs = boost::filesystem;
+namespace sys = boost::system;
+
+namespace puppet { namespace compiler {
+
+    cache::cache(string directory) :
+        _directory(rvalue_cast(directory))
+    {
+    }
+
+    string const& cache::directory() const
+    {
+        return _directory;
+    }
+
+    boost::optional<ast::syntax_tree> cache::load(source_buffer const& source, bool defer_bodies) const
+    {
+        ifstream file(entry_path(source, defer_bodies), ios::binary);
+        if (!file) {
+            return boost::none;
+        }
+
+        try {
+            return ast::deserialize(file);
+        } catch (ast::serialization_exception const&) {
+            // Treat a corrupt entry as a miss; it will be overwritten when the tree is stored
+            return boost::none;
+        }
+    }
+
+    bool cache::store(source_buffer const& source, ast::syntax_tree const& tree, bool defer_bodies) const
+    {
+        sys::error_code ec;
+        fs::create_directories(_directory, ec);
+        if (ec) {
+            return false;
+        }
+
+        // Write to a unique temporary file and rename it into place so the entry appears atomically
+        auto path = entry_path(source, defer_bodies);
+        auto temp_path = (fs::path(_directory) / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp")).string();
+        try {
+            ofstream file(temp_path, ios::binary | ios::trunc);
+            if (!file) {
+                return false;
+            }
+            ast::serialize(file, tree);
+            file.close();
+            if (!file) {
+                throw ast::serialization_exception("failed to write serialized syntax tree.");
+            }
+        } catch (ast::serialization_exception const&) {
+            fs::remove(temp_path, ec);
+            return false;
+        }
+
+        fs::rename(temp_path, path, ec);
+        if (ec) {
+            fs::remove(temp_path, ec);
+            return false;
+        }
+        return true;
+    }
+
+    string cache::entry_path(source_buffer const& source, bool defer_bodies) const
+    {
+        // Key on the library version as well as the contents so upgrades never load trees from an older parser
+        static char const version[] = LIBPUPPET_VERSION;
+        auto hash = hash_bytes(version, sizeof(version));
+        // Key on the parse mode too; a tree with deferred bodies must not be loaded when syntax errors in bodies are expected
+        char const mode = defer_bodies ? 1 : 0;
+        hash = hash_bytes(&mode, sizeof(mode), hash);
+        hash = hash_bytes(source.data(), source.size(), hash);
+        return (fs::path(_directory) / (boost::format("%016x-%x.ast") % hash % source.size()).str()).string();
+    }
+
+}}  // namespace puppet::compiler
@@ -1,5 +1,5 @@
 #include <puppet/compiler/context.hpp>
-#include <puppet/compiler/parser.hpp>
+#include <puppet/lexer/lexer.hpp>
 #include <puppet/compiler/node.hpp>
 #include <puppet/cast.hpp>
 
@@ -9,26 +9,18 @@ using namespace puppet::logging;
 
 namespace puppet { namespace compiler {
 
-    context::context(logging::logger& logger, shared_ptr<string> path, compiler::node& node) :
+    context::context(logging::logger& logger, shared_ptr<string> path, compiler::node& node, compiler::cache const* cache, bool defer_bodies) :
+        context(logger, make_shared<compiler::manifest>(logger, rvalue_cast(path), cache, defer_bodies), node)
+    {
+    }
+
+    context::context(logging::logger& logger, shared_ptr<compiler::manifest> manifest, compiler::node& node) :
         _logger(logger),
-        _path(rvalue_cast(path)),
+        _manifest(rvalue_cast(manifest)),
         _node(node)
     {
-        if (!_path) {
-            throw runtime_error("expected path");
-        }
-        _stream.open(*_path);
-        if (!_stream) {
-            throw compilation_exception((boost::format("manifest '%1%' does not exist or cannot be read.") % *_path).str());
-        }
-
-        // Parse the file into a syntax tree
-        try {
-            LOG(debug, "parsing '%1%'.", *_path);
-            _tree = parser::parse(_stream);
-            LOG(debug, "parsed syntax tree:\n%1%", _tree);
-        } catch (parse_exception const& ex) {
-            throw create_exception(ex.position(), ex.what());
+        if (!_manifest) {
+            throw runtime_error("expected manifest");
         }
     }
 
@@ -39,12 +31,27 @@ namespace puppet { namespace compiler {
 
     shared_ptr<string> const& context::path() const
     {
-        return _path;
+        return _manifest->path();
+    }
+
+    shared_ptr<source_buffer const> const& context::source() const
+    {
+        return _manifest->source();
     }
 
     ast::syntax_tree const& context::tree() const
     {
-        return _tree;
+        return _manifest->tree();
+    }
+
+    ast::arena const& context::arena() const
+    {
+        return _manifest->arena();
+    }
+
+    shared_ptr<compiler::manifest> const& context::manifest() const
+    {
+        return _manifest;
     }
 
     compiler::node& context::node()
@@ -52,6 +59,33 @@ namespace puppet { namespace compiler {
         return _node;
     }
 
+    template <typename Expression>
+    bool context::parse_deferred_body(Expression const& expression, compiler::manifest::parsed_callback const& parsed)
+    {
+        auto& logger = _logger;
+        return _manifest->parse_body(expression, [&](vector<ast::expression> const& body) {
+            LOG(debug, "parsed deferred body at %1%:%2%.", *path(), expression.position().line());
+            if (parsed) {
+                parsed(body);
+            }
+        });
+    }
+
+    bool context::parse_body(ast::class_definition_expression const& expression, compiler::manifest::parsed_callback const& parsed)
+    {
+        return parse_deferred_body(expression, parsed);
+    }
+
+    bool context::parse_body(ast::defined_type_expression const& expression, compiler::manifest::parsed_callback const& parsed)
+    {
+        return parse_deferred_body(expression, parsed);
+    }
+
+    bool context::parse_body(ast::node_definition_expression const& expression, compiler::manifest::parsed_callback const& parsed)
+    {
+        return parse_deferred_body(expression, parsed);
+    }
+
     void context::log(logging::level level, lexer::position const& position, std::string const& message)
     {
         if (!_logger.would_log(level)) {
@@ -60,16 +94,13 @@ namespace puppet { namespace compiler {
 
         string text;
         size_t column;
-        tie(text, column) = get_text_and_column(_stream, position.offset());
-        _logger.log(level, position.line(), column, text, *_path, "node '%1%': %2%", _node.name(), message);
+        tie(text, column) = get_text_and_column(*source(), position.offset());
+        _logger.log(level, position.line(), column, text, *path(), "node '%1%': %2%", _node.name(), message);
     }
 
     compilation_exception context::create_exception(lexer::position const& position, string const& message)
     {
-        string text;
-        size_t column;
-        tie(text, column) = get_text_and_column(_stream, position.offset());
-        return compilation_exception(message, *_path, position.line(), column, rvalue_cast(text));
+        return _manifest->create_exception(position, message);
     }
 
 }}  // namespace puppet::compiler
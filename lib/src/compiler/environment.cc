@@ -1,13 +1,39 @@
 #include <puppet/compiler/environment.hpp>
+#include <puppet/compiler/hash.hpp>
+#include <puppet/runtime/constant_folder.hpp>
+#include <puppet/runtime/definition_scanner.hpp>
+#include <puppet/runtime/expression_evaluator.hpp>
 #include <puppet/cast.hpp>
+#include <puppet/lexer/source_buffer.hpp>
+#include <boost/filesystem.hpp>
 
 using namespace std;
+using namespace puppet::logging;
+
+namespace fs = boost::filesystem;
 
 namespace puppet { namespace compiler {
 
-    environment::environment(string name, string base) :
+    static vector<string> get_module_directories(string const& base, vector<string> const& module_directories)
+    {
+        vector<string> directories;
+        directories.emplace_back((fs::path(base) / "modules").string());
+        directories.insert(directories.end(), module_directories.begin(), module_directories.end());
+        return directories;
+    }
+
+    static string get_index_path(string const& name, string const& cache_directory)
+    {
+        if (cache_directory.empty()) {
+            return {};
+        }
+        return (fs::path(cache_directory) / ("autoload-" + name + ".index")).string();
+    }
+
+    environment::environment(string name, string base, vector<string> const& module_directories, string const& cache_directory) :
         _name(rvalue_cast(name)),
-        _base(rvalue_cast(base))
+        _base(rvalue_cast(base)),
+        _autoloader(get_module_directories(_base, module_directories), get_index_path(_name, cache_directory))
     {
     }
 
@@ -21,4 +47,74 @@ namespace puppet { namespace compiler {
         return _base;
     }
 
+    compiler::autoloader& environment::autoloader()
+    {
+        return _autoloader;
+    }
+
+    shared_ptr<compiler::context> environment::load(logging::logger& logger, compiler::node& node, string const& path, compiler::cache const* cache, bool defer_bodies, bool copy_source)
+    {
+        // Find the manifest's entry; entries are locked separately so that different manifests load in parallel
+        shared_ptr<manifest_entry> entry;
+        {
+            lock_guard<mutex> lock(_mutex);
+            auto& existing = _manifests[path];
+            if (!existing) {
+                existing = make_shared<manifest_entry>();
+            }
+            entry = existing;
+        }
+
+        lock_guard<mutex> lock(entry->mutex);
+
+        // Share the loaded manifest unless the file has changed since it was loaded
+        file_stamp stamp(path);
+        if (entry->manifest && stamp.exists() && stamp == entry->stamp && is_unchanged(*entry, path, stamp)) {
+            return make_shared<compiler::context>(logger, entry->manifest, node);
+        }
+
+        // Parse the manifest, fold its constant expressions, and find its definitions before it is shared
+        auto manifest = make_shared<compiler::manifest>(logger, make_shared<string>(path), cache, defer_bodies, copy_source);
+        auto context = make_shared<compiler::context>(logger, manifest, node);
+        try {
+            runtime::constant_folder::fold(context);
+            manifest->definitions(make_shared<runtime::definitions>(runtime::definition_scanner::find(context)));
+        } catch (runtime::evaluation_exception const& ex) {
+            if (!ex.context()) {
+                throw compilation_exception(ex.what());
+            }
+            throw ex.context()->create_exception(ex.position(), ex.what());
+        }
+
+        // Hash what was parsed if the stamp cannot be trusted to show a later change
+        if (stamp.racy()) {
+            auto const& source = manifest->source();
+            entry->hash = hash_bytes(source->data(), source->size());
+        }
+        entry->manifest = rvalue_cast(manifest);
+        entry->stamp = stamp;
+        return context;
+    }
+
+    bool environment::is_unchanged(manifest_entry& entry, string const& path, file_stamp const& stamp)
+    {
+        if (!entry.stamp.racy()) {
+            return true;
+        }
+
+        // The file was changed just before it was loaded, so an unchanged stamp may hide a later change; compare the contents
+        try {
+            lexer::source_buffer source(path);
+            if (hash_bytes(source.data(), source.size()) != entry.hash) {
+                return false;
+            }
+        } catch (lexer::source_exception const&) {
+            return false;
+        }
+
+        // Keep the newer stamp so that the contents are no longer hashed once the file has been unchanged for long enough
+        entry.stamp = stamp;
+        return true;
+    }
+
 }}  // namespace puppet::compiler
@@ -0,0 +1,59 @@
+#include <puppet/compiler/file_stamp.hpp>
+
+using namespace std;
+
+namespace puppet { namespace compiler {
+
+    // File systems with the coarsest modification times (e.g. FAT) record them to two seconds
+    static int64_t const racy_window = 2000000000ll;
+
+    file_stamp::file_stamp() :
+        _modified(-1),
+        _size(0),
+        _taken(0)
+    {
+    }
+
+    file_stamp::file_stamp(int64_t modified, uintmax_t size, int64_t taken) :
+        _modified(modified),
+        _size(size),
+        _taken(taken)
+    {
+    }
+
+    bool file_stamp::exists() const
+    {
+        return _modified != -1;
+    }
+
+    int64_t file_stamp::modified() const
+    {
+        return _modified;
+    }
+
+    uintmax_t file_stamp::size() const
+    {
+        return _size;
+    }
+
+    int64_t file_stamp::taken() const
+    {
+        return _taken;
+    }
+
+    bool file_stamp::racy() const
+    {
+        return exists() && _modified >= _taken - racy_window;
+    }
+
+    bool file_stamp::operator==(file_stamp const& other) const
+    {
+        return _modified == other._modified && _size == other._size;
+    }
+
+    bool file_stamp::operator!=(file_stamp const& other) const
+    {
+        return !(*this == other);
+    }
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,17 @@
+#include <puppet/compiler/hash.hpp>
+
+using namespace std;
+
+namespace puppet { namespace compiler {
+
+    uint64_t hash_bytes(char const* data, size_t size, uint64_t hash)
+    {
+        // 64-bit FNV-1a
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+}}  // namespace puppet::compiler
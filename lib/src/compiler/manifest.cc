@@ -0,0 +1,162 @@
+#include <puppet/compiler/manifest.hpp>
+#include <puppet/compiler/parser.hpp>
+#include <puppet/compiler/cache.hpp>
+#include <puppet/runtime/vm/program.hpp>
+#include <puppet/cast.hpp>
+
+using namespace std;
+using namespace puppet::lexer;
+using namespace puppet::logging;
+
+namespace puppet { namespace compiler {
+
+    manifest::manifest(logging::logger& logger, shared_ptr<string> path, compiler::cache const* cache, bool defer_bodies, bool copy_source) :
+        _path(rvalue_cast(path))
+    {
+        if (!_path) {
+            throw runtime_error("expected path");
+        }
+
+        // Map or copy the file into memory; the buffer is kept for parsing deferred bodies and reporting positions in messages
+        try {
+            _source = make_shared<source_buffer>(*_path, copy_source);
+        } catch (source_exception const&) {
+            throw compilation_exception((boost::format("manifest '%1%' does not exist or cannot be read.") % *_path).str());
+        }
+
+        // Allocate the nodes of the syntax tree from this manifest's arena
+        ast::arena_scope scope{_arena};
+
+        // Use the cached syntax tree if the file has not changed since it was last parsed
+        boost::optional<ast::syntax_tree> cached;
+        if (cache && (cached = cache->load(*_source, defer_bodies))) {
+            LOG(debug, "loaded syntax tree for '%1%' from the cache.", *_path);
+            _tree = rvalue_cast(*cached);
+        } else {
+            // Parse the file into a syntax tree
+            try {
+                LOG(debug, "parsing '%1%'.", *_path);
+                _tree = parser::parse(*_source, false, defer_bodies);
+                LOG(debug, "parsed syntax tree:\n%1%", _tree);
+            } catch (parse_exception const& ex) {
+                throw create_exception(ex.position(), ex.what());
+            }
+
+            if (cache && !cache->store(*_source, _tree, defer_bodies)) {
+                LOG(debug, "failed to store the syntax tree for '%1%' in cache directory '%2%'.", *_path, cache->directory());
+            }
+        }
+        LOG(debug, "allocated %1% syntax tree nodes (%2% bytes) for '%3%'.", _arena.allocations(), _arena.bytes(), *_path);
+    }
+
+    shared_ptr<string> const& manifest::path() const
+    {
+        return _path;
+    }
+
+    shared_ptr<source_buffer const> const& manifest::source() const
+    {
+        return _source;
+    }
+
+    ast::syntax_tree const& manifest::tree() const
+    {
+        return _tree;
+    }
+
+    ast::arena const& manifest::arena() const
+    {
+        return _arena;
+    }
+
+    shared_ptr<runtime::definitions const> const& manifest::definitions() const
+    {
+        return _definitions;
+    }
+
+    void manifest::definitions(shared_ptr<runtime::definitions const> definitions)
+    {
+        _definitions = rvalue_cast(definitions);
+    }
+
+    template <typename Expression>
+    bool manifest::parse_deferred_body(Expression const& expression, parsed_callback const& parsed)
+    {
+        // Every evaluation of a definition calls this first; once the body is published, no lock is needed to read it
+        if (expression.body_parsed()) {
+            return false;
+        }
+
+        // Only the first parse takes the lock; another thread may have parsed the body while this one waited
+        lock_guard<mutex> lock(_mutex);
+
+        auto& deferred = expression.deferred_body();
+        if (!deferred) {
+            return false;
+        }
+
+        // Allocate the nodes of the body from this manifest's arena, like the rest of the syntax tree
+        ast::arena_scope scope{_arena};
+
+        boost::optional<vector<ast::expression>> body;
+        try {
+            body = parser::parse_body(*_source, *deferred);
+        } catch (parse_exception const& ex) {
+            throw create_exception(ex.position(), ex.what());
+        }
+        if (parsed && body) {
+            parsed(*body);
+        }
+
+        // Setting the body publishes it to threads that check without the lock
+        expression.body(rvalue_cast(body));
+        return true;
+    }
+
+    bool manifest::parse_body(ast::class_definition_expression const& expression, parsed_callback const& parsed)
+    {
+        return parse_deferred_body(expression, parsed);
+    }
+
+    bool manifest::parse_body(ast::defined_type_expression const& expression, parsed_callback const& parsed)
+    {
+        return parse_deferred_body(expression, parsed);
+    }
+
+    bool manifest::parse_body(ast::node_definition_expression const& expression, parsed_callback const& parsed)
+    {
+        return parse_deferred_body(expression, parsed);
+    }
+
+    runtime::vm::program const& manifest::program(vector<ast::expression> const& body, bool top_level)
+    {
+        // The syntax tree outlives the programs, so the block's address identifies it
+        lock_guard<mutex> lock(_mutex);
+
+        auto& program = _programs[&body];
+        if (!program) {
+            program = make_shared<runtime::vm::program>(body, top_level);
+        }
+        return *program;
+    }
+
+    runtime::vm::program const& manifest::program(ast::lambda const& lambda)
+    {
+        lock_guard<mutex> lock(_mutex);
+
+        auto& program = _programs[&lambda];
+        if (!program) {
+            program = make_shared<runtime::vm::program>(lambda);
+        }
+        return *program;
+    }
+
+    compilation_exception manifest::create_exception(lexer::position const& position, string const& message) const
+    {
+        string text;
+        size_t column;
+        tie(text, column) = get_text_and_column(*_source, position.offset());
+        return compilation_exception(message, *_path, position.line(), column, rvalue_cast(text));
+    }
+
+}}  // namespace puppet::compiler
@@ -1,7 +1,10 @@
 #include <puppet/compiler/node.hpp>
+#include <puppet/compiler/cache.hpp>
 #include <puppet/runtime/expression_evaluator.hpp>
 #include <puppet/runtime/definition_scanner.hpp>
 #include <puppet/cast.hpp>
+#include <atomic>
+#include <thread>
 
 using namespace std;
 using namespace puppet::lexer;
@@ -10,8 +13,16 @@ using namespace puppet::logging;
 
 namespace puppet { namespace compiler {
 
-    node::node(string const& name, compiler::environment& environment) :
-        _environment(environment)
+    static bool copy_sources(compiler::settings const& settings)
+    {
+        // Deferred bodies are parsed long after the file was read and a server keeps manifests for as long as it runs,
+        // so copy the files rather than map them; a mapped file that is rewritten in place changes or faults underneath the manifest
+        return settings.lazy_parsing() || !settings.server_socket().empty();
+    }
+
+    node::node(string const& name, compiler::environment& environment, shared_ptr<facts::provider> facts) :
+        _environment(environment),
+        _facts(rvalue_cast(facts))
     {
         // Copy each subname of the node name
         // For example, a node name of 'foo.bar.baz' would emplace 'foo', then 'foo.bar', then 'foo.bar.baz'.
@@ -37,6 +48,11 @@ namespace puppet { namespace compiler {
         return _environment;
     }
 
+    shared_ptr<facts::provider> const& node::facts() const
+    {
+        return _facts;
+    }
+
     catalog node::compile(logging::logger& logger, compiler::settings const& settings)
     {
         // Create a catalog with the "main" resources
@@ -44,23 +60,25 @@ namespace puppet { namespace compiler {
         create_main(catalog);
 
         // Create an evaluation context and a settings scope
-        runtime::context evaluation_context{ settings.facts(), &catalog };
+        runtime::context evaluation_context{ _facts, &catalog, settings.engine() };
         create_settings_scope(evaluation_context, settings);
 
         // TODO: set node parameters in the top scope
 
+        // Load classes and defined types from the environment's modules as they are referenced
+        set<string> loaded;
+        catalog.loader([&](runtime::catalog& catalog, string const& name) {
+            return load(logger, settings, catalog, loaded, name);
+        });
+
         // First parse all the files so they can be scanned
-        vector<shared_ptr<compiler::context>> contexts;
-        contexts.reserve(settings.manifests().size() + 1);
+        auto contexts = parse(logger, settings);
 
         try {
+            // Scan the contexts for definitions in the specified order
             definition_scanner scanner{ catalog };
-            for (auto const& manifest : settings.manifests()) {
-                // Create a compilation context for each manifest (parses the file)
-                contexts.push_back(make_shared<compiler::context>(logger, make_shared<string>(manifest), *this));
-
-                // Scan this context for definitions
-                scanner.scan(contexts.back());
+            for (auto const& context : contexts) {
+                scanner.scan(context);
             }
 
             // Now evaluate the manifests in the specified order
@@ -87,9 +105,36 @@ namespace puppet { namespace compiler {
             }
             throw ex.context()->create_exception(ex.position(), ex.what());
         }
+
+        // The loader refers to this compilation, so don't let it outlive it
+        catalog.loader(nullptr);
         return catalog;
     }
 
+    size_t node::preload(logging::logger& logger, compiler::settings const& settings)
+    {
+        boost::optional<compiler::cache> cache;
+        if (!settings.cache_directory().empty()) {
+            cache = compiler::cache(settings.cache_directory());
+        }
+
+        auto manifests = settings.manifests();
+        for (auto& manifest : _environment.autoloader().manifests()) {
+            manifests.emplace_back(rvalue_cast(manifest));
+        }
+
+        for (auto const& manifest : manifests) {
+            LOG(debug, "preloading manifest '%1%'.", manifest);
+            try {
+                _environment.load(logger, *this, manifest, cache.get_ptr(), false, copy_sources(settings));
+            } catch (compilation_exception const& ex) {
+                // Nodes that use the manifest will report the error when they load it
+                LOG(debug, "failed to preload manifest '%1%': %2%", manifest, ex.what());
+            }
+        }
+        return manifests.size();
+    }
+
     void node::each_name(function<bool(string const&)> const& callback) const
     {
         // Set goes from most specific to least specific in order, so traverse backwards
@@ -100,6 +145,84 @@ namespace puppet { namespace compiler {
         }
     }
 
+    vector<shared_ptr<compiler::context>> node::parse(logging::logger& logger, compiler::settings const& settings)
+    {
+        auto const& manifests = settings.manifests();
+        vector<shared_ptr<compiler::context>> contexts(manifests.size());
+        vector<exception_ptr> exceptions(manifests.size());
+
+        // Load unchanged manifests from the syntax tree cache if one was given
+        boost::optional<compiler::cache> cache;
+        if (!settings.cache_directory().empty()) {
+            cache = compiler::cache(settings.cache_directory());
+        }
+
+        // Each job takes the next unparsed manifest until none remain
+        atomic<size_t> next(0);
+        auto job = [&]() {
+            for (size_t index = next++; index < manifests.size(); index = next++) {
+                try {
+                    // Load the manifest from the environment (parses the file unless another node already has)
+                    contexts[index] = _environment.load(logger, *this, manifests[index], cache.get_ptr(), settings.lazy_parsing(), copy_sources(settings));
+                } catch (...) {
+                    exceptions[index] = current_exception();
+                }
+            }
+        };
+
+        // The calling thread is also a job, so only start threads for the additional jobs
+        // In batch and serve modes the jobs are already used to compile nodes in parallel, so parse on the calling thread
+        vector<thread> threads;
+        auto jobs = settings.batch_directory().empty() && settings.server_socket().empty() ? min(settings.jobs(), manifests.size()) : 1;
+        for (size_t i = 1; i < jobs; ++i) {
+            threads.emplace_back(job);
+        }
+        job();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        // Rethrow the first failure in manifest order so that errors are reported deterministically
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                rethrow_exception(exception);
+            }
+        }
+        return contexts;
+    }
+
+    bool node::load(logging::logger& logger, compiler::settings const& settings, runtime::catalog& catalog, set<string>& loaded, string const& name)
+    {
+        auto& autoloader = _environment.autoloader();
+        for (bool rebuilt = false;; rebuilt = true) {
+            auto location = autoloader.find(name);
+            if (!location || !loaded.insert(location->path).second) {
+                // Either no module defines the name or the manifest was already loaded
+                return false;
+            }
+
+            LOG(debug, "loading '%1%' from manifest '%2%'.", name, location->path);
+
+            boost::optional<compiler::cache> cache;
+            if (!settings.cache_directory().empty()) {
+                cache = compiler::cache(settings.cache_directory());
+            }
+
+            // Load the manifest from the environment and add its definitions to the catalog
+            auto context = _environment.load(logger, *this, location->path, cache.get_ptr(), settings.lazy_parsing(), copy_sources(settings));
+            definition_scanner scanner{ catalog };
+            scanner.scan(context);
+
+            if (catalog.find_class(types::klass(name)) || catalog.find_defined_type(name) || rebuilt) {
+                return true;
+            }
+
+            // The index is out of date as the manifest did not define the name; rebuild it and try once more
+            LOG(debug, "manifest '%1%' does not define '%2%': rebuilding the module index.", location->path, name);
+            autoloader.rebuild();
+        }
+    }
+
     void node::create_main(runtime::catalog& catalog)
     {
         auto path = make_shared<string>("<generated>");
@@ -7,27 +7,44 @@ using namespace boost::spirit;
 
 namespace puppet { namespace compiler {
 
-    ast::syntax_tree parser::parse(ifstream& input, bool interpolation)
+    ast::syntax_tree parser::parse(source_buffer const& input, bool interpolation, bool defer_bodies)
     {
-        file_static_lexer lexer;
         auto begin = lex_begin(input);
         auto end = lex_end(input);
-        return parse(lexer, input, begin, end, interpolation);
+        return parse<lexer_type>(input, begin, end, interpolation, defer_bodies);
+    }
+
+    boost::optional<vector<ast::expression>> parser::parse_body(source_buffer const& input, ast::deferred_body const& body)
+    {
+        if (body.end().offset() >= input.size()) {
+            throw parse_exception(body.begin(), "deferred body is outside of the source.");
+        }
+
+        // Start lexing at the body's opening brace with the position of the brace
+        lexer_string_iterator begin(input.data() + body.begin().offset());
+        begin.position(body.begin());
+        auto end = lex_end(input);
+        return parse_body<lexer_type>(input, begin, end);
     }
 
     ast::syntax_tree parser::parse(string const& input, bool interpolation)
     {
-        string_static_lexer lexer;
         auto begin = lex_begin(input);
         auto end = lex_end(input);
-        return parse(lexer, input, begin, end, interpolation);
+        return parse<lexer_type>(input, begin, end, interpolation);
     }
 
     ast::syntax_tree parser::parse(lexer_string_iterator& begin, lexer_string_iterator const& end, bool interpolation)
     {
-        string_static_lexer lexer;
         auto range = boost::make_iterator_range(begin, end);
-        return parse(lexer, range, begin, end, interpolation);
+        return parse<lexer_type>(range, begin, end, interpolation);
+    }
+
+    ast::syntax_tree parser::parse_with_grammar(string const& input, bool interpolation)
+    {
+        auto begin = lex_begin(input);
+        auto end = lex_end(input);
+        return parse_with_grammar<lexer_type>(input, begin, end, interpolation);
     }
 
     parser::expectation_info_printer::expectation_info_printer(ostream& os) :
@@ -0,0 +1,35 @@
+#include <puppet/compiler/file_stamp.hpp>
+#include <sys/stat.h>
+#include <time.h>
+
+using namespace std;
+
+namespace puppet { namespace compiler {
+
+    static int64_t nanoseconds(timespec const& time)
+    {
+        return static_cast<int64_t>(time.tv_sec) * 1000000000ll + time.tv_nsec;
+    }
+
+    file_stamp::file_stamp(string const& path) :
+        file_stamp()
+    {
+        // Take the time before the stat so that a change made between the two is always considered racy
+        timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        _taken = nanoseconds(now);
+
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0) {
+            return;
+        }
+#ifdef __APPLE__
+        // macOS names the nanosecond modification time differently than Linux
+        _modified = nanoseconds(info.st_mtimespec);
+#else
+        _modified = nanoseconds(info.st_mtim);
+#endif
+        _size = static_cast<uintmax_t>(info.st_size);
+    }
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,194 @@
+#include <puppet/compiler/process_pool.hpp>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace puppet::logging;
+
+namespace puppet { namespace compiler {
+
+    // The state shared between the pool and its workers; the job and worker results follow it in the same mapping
+    struct shared_state
+    {
+        atomic<size_t> next;
+    };
+
+    static size_t private_resident()
+    {
+        // Only Linux reports how much of a process' memory is no longer shared; the counts are in kilobytes
+        ifstream file("/proc/self/smaps_rollup");
+        size_t total = 0;
+        string line;
+        while (getline(file, line)) {
+            if (line.compare(0, 8, "Private_") != 0) {
+                continue;
+            }
+            istringstream stream(line.substr(line.find(':') + 1));
+            size_t kilobytes = 0;
+            if (stream >> kilobytes) {
+                total += kilobytes;
+            }
+        }
+        return total;
+    }
+
+    static size_t peak_resident()
+    {
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+#ifdef __APPLE__
+        // macOS reports the peak in bytes rather than kilobytes
+        return static_cast<size_t>(usage.ru_maxrss) / 1024;
+#else
+        return static_cast<size_t>(usage.ru_maxrss);
+#endif
+    }
+
+    static void work(
+        logging::logger& logger,
+        size_t worker,
+        size_t count,
+        process_pool::job_type const& job,
+        shared_state& state,
+        process_pool::job_result* jobs,
+        process_pool::worker_result& result)
+    {
+        typedef chrono::steady_clock clock;
+
+        // The worker's logger is a copy of the parent's, so only count what the worker logs
+        auto warnings = logger.warnings();
+        auto errors = logger.errors();
+        auto start = clock::now();
+
+        for (size_t index = state.next++; index < count; index = state.next++) {
+            auto job_start = clock::now();
+            bool succeeded = false;
+            try {
+                succeeded = job(index, worker);
+            } catch (exception const& ex) {
+                LOG(error, "unhandled exception in worker %1%: %2%", worker, ex.what());
+            }
+            jobs[index].seconds = chrono::duration<double>(clock::now() - job_start).count();
+            jobs[index].succeeded = succeeded;
+            jobs[index].completed = true;
+            ++result.jobs;
+            result.failed += succeeded ? 0 : 1;
+        }
+
+        result.seconds = chrono::duration<double>(clock::now() - start).count();
+        result.warnings = logger.warnings() - warnings;
+        result.errors = logger.errors() - errors;
+        result.peak_resident = peak_resident();
+        result.private_resident = private_resident();
+        result.exited = true;
+    }
+
+    process_pool::process_pool(size_t workers) :
+        _workers(max<size_t>(workers, 1))
+    {
+    }
+
+    size_t process_pool::workers() const
+    {
+        return _workers;
+    }
+
+    process_pool::results process_pool::run(logging::logger& logger, size_t count, job_type const& job) const
+    {
+        results results;
+        results.jobs.resize(count);
+        if (count == 0) {
+            return results;
+        }
+
+        // Don't fork more workers than there are jobs
+        auto workers = min(_workers, count);
+        results.workers.resize(workers);
+
+        // The results are written by the workers, so they live in memory shared with them
+        auto size = sizeof(shared_state) + sizeof(job_result) * count + sizeof(worker_result) * workers;
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANON, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw runtime_error((boost::format("failed to map shared memory for worker processes: %1%.") % strerror(errno)).str());
+        }
+        auto state = new (memory) shared_state();
+        state->next = 0;
+        auto jobs = reinterpret_cast<job_result*>(static_cast<char*>(memory) + sizeof(shared_state));
+        for (size_t i = 0; i < count; ++i) {
+            new (jobs + i) job_result();
+        }
+        auto worker_results = reinterpret_cast<worker_result*>(jobs + count);
+        for (size_t i = 0; i < workers; ++i) {
+            new (worker_results + i) worker_result();
+        }
+
+        // Flush anything buffered so that it isn't written again by each worker
+        cout.flush();
+        cerr.flush();
+        fflush(nullptr);
+
+        vector<pid_t> pids;
+        for (size_t worker = 0; worker < workers; ++worker) {
+            auto pid = fork();
+            if (pid < 0) {
+                LOG(error, "failed to fork worker process: %1%.", strerror(errno));
+                break;
+            }
+            if (pid == 0) {
+                try {
+                    work(logger, worker, count, job, *state, jobs, worker_results[worker]);
+                } catch (exception const& ex) {
+                    LOG(critical, "unhandled exception in worker %1%: %2%", worker, ex.what());
+                }
+                cout.flush();
+                cerr.flush();
+                fflush(nullptr);
+
+                // Exit without running destructors or exit handlers for state that belongs to the parent
+                _exit(EXIT_SUCCESS);
+            }
+            pids.push_back(pid);
+        }
+
+        for (size_t worker = 0; worker < pids.size(); ++worker) {
+            int status = 0;
+            while (waitpid(pids[worker], &status, 0) < 0 && errno == EINTR) {
+            }
+            if (WIFSIGNALED(status)) {
+                LOG(error, "worker %1% (pid %2%) was terminated by signal %3%.", worker, pids[worker], WTERMSIG(status));
+            }
+        }
+
+        // Jobs that were running when a worker was terminated are reported as incomplete
+        copy(jobs, jobs + count, results.jobs.begin());
+        copy(worker_results, worker_results + workers, results.workers.begin());
+        munmap(memory, size);
+
+        size_t warnings = 0;
+        size_t errors = 0;
+        for (auto const& worker : results.workers) {
+            warnings += worker.warnings;
+            errors += worker.errors;
+        }
+        logger.add(warnings, errors);
+        return results;
+    }
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,199 @@
+#include <puppet/compiler/server.hpp>
+#include <boost/format.hpp>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace puppet::logging;
+
+namespace puppet { namespace compiler {
+
+    // Requests larger than this are rejected rather than buffered
+    static size_t const max_request_size = 64 * 1024 * 1024;
+
+    // How long a worker waits for a connection before checking if the server was stopped
+    static int const poll_timeout_milliseconds = 250;
+
+    // How long a client may take to send its request or read the response
+    static int const client_timeout_seconds = 30;
+
+    static string error_message(char const* action)
+    {
+        return (boost::format("failed to %1%: %2%.") % action % strerror(errno)).str();
+    }
+
+    static bool read_request(int connection, string& request)
+    {
+        // The client shuts down its side of the connection once the request is written
+        char buffer[64 * 1024];
+        while (true) {
+            auto count = read(connection, buffer, sizeof(buffer));
+            if (count == 0) {
+                return true;
+            }
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            if (request.size() + count > max_request_size) {
+                return false;
+            }
+            request.append(buffer, count);
+        }
+    }
+
+    static void write_response(int connection, string const& response)
+    {
+        // Don't raise SIGPIPE when the client has gone away
+#ifdef MSG_NOSIGNAL
+        int flags = MSG_NOSIGNAL;
+#else
+        int flags = 0;
+#endif
+        size_t written = 0;
+        while (written < response.size()) {
+            auto count = send(connection, response.data() + written, response.size() - written, flags);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            written += count;
+        }
+    }
+
+    void server::run(atomic<bool> const* interrupted)
+    {
+        auto& logger = _logger;
+        auto const& path = _settings.server_socket();
+
+        sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw server_exception((boost::format("socket path '%1%' is too long.") % path).str());
+        }
+        strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+        int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0) {
+            throw server_exception(error_message("create socket"));
+        }
+
+        // Remove a socket left behind by a server that is no longer running, but never steal a live server's socket
+        if (connect(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            close(listener);
+            throw server_exception((boost::format("socket '%1%' is in use by another server.") % path).str());
+        }
+        if (errno == ECONNREFUSED) {
+            unlink(path.c_str());
+        }
+        close(listener);
+
+        listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0) {
+            throw server_exception(error_message("create socket"));
+        }
+        if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            auto message = error_message((boost::format("bind to socket '%1%'") % path).str().c_str());
+            close(listener);
+            throw server_exception(message);
+        }
+
+        // Workers poll the socket, so accepting must not block when another worker took the connection
+        if (listen(listener, SOMAXCONN) != 0 || fcntl(listener, F_SETFL, fcntl(listener, F_GETFL) | O_NONBLOCK) != 0) {
+            auto message = error_message("listen on socket");
+            close(listener);
+            unlink(path.c_str());
+            throw server_exception(message);
+        }
+
+        LOG(notice, "listening for compilation requests on '%1%' with %2% %3%.", path, _settings.jobs(), _settings.jobs() != 1 ? "workers" : "worker");
+
+        // The calling thread is also a worker, so only start threads for the additional workers
+        vector<thread> threads;
+        for (size_t i = 1; i < _settings.jobs(); ++i) {
+            threads.emplace_back([&]() { serve(listener, interrupted); });
+        }
+        serve(listener, interrupted);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        close(listener);
+        unlink(path.c_str());
+        LOG(notice, "stopped listening for compilation requests.");
+    }
+
+    void server::serve(int listener, atomic<bool> const* interrupted)
+    {
+        auto& logger = _logger;
+
+        // A signal interrupts the poll of the worker it was delivered to; the other workers see the flag within the poll timeout
+        while (!_stopped && !(interrupted && *interrupted)) {
+            pollfd descriptor;
+            descriptor.fd = listener;
+            descriptor.events = POLLIN;
+            descriptor.revents = 0;
+            if (poll(&descriptor, 1, poll_timeout_milliseconds) <= 0) {
+                continue;
+            }
+
+            // Another worker may have accepted the connection first
+            int connection = accept(listener, nullptr, nullptr);
+            if (connection < 0) {
+                continue;
+            }
+
+            // Some platforms inherit non-blocking mode from the listener; requests are read with blocking calls
+            fcntl(connection, F_SETFL, fcntl(connection, F_GETFL) & ~O_NONBLOCK);
+
+            // Don't let a client that never finishes its request hold the worker forever
+            timeval timeout;
+            timeout.tv_sec = client_timeout_seconds;
+            timeout.tv_usec = 0;
+            setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+            int enabled = 1;
+            setsockopt(connection, SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+
+            string request;
+            if (!read_request(connection, request)) {
+                LOG(warning, "failed to read compilation request: the request was too large or the client timed out.");
+                close(connection);
+                continue;
+            }
+
+            // Buffer the request's messages so they are not interleaved with those of other requests
+            buffered_logger request_logger(logger);
+            auto start = chrono::steady_clock::now();
+            string response;
+            try {
+                response = compile(request, request_logger);
+            } catch (exception const& ex) {
+                request_logger.log(level::error, (boost::format("unhandled exception: %1%") % ex.what()).str());
+                response = "{\"error\": \"internal compiler error.\"}\n";
+            }
+            auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            request_logger.log(level::info, (boost::format("compiled request in %1$.3f seconds.") % elapsed).str());
+            request_logger.flush();
+
+            write_response(connection, response);
+            close(connection);
+        }
+    }
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,104 @@
+#include <puppet/compiler/scheduler.hpp>
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace puppet { namespace compiler {
+
+    // The jobs waiting to be run by a worker
+    struct job_queue
+    {
+        mutex lock;
+        deque<size_t> jobs;
+    };
+
+    static bool take_job(vector<unique_ptr<job_queue>>& queues, size_t worker, size_t& job)
+    {
+        // Take from the front of the worker's own queue so its jobs run in order
+        {
+            auto& queue = *queues[worker];
+            lock_guard<mutex> guard(queue.lock);
+            if (!queue.jobs.empty()) {
+                job = queue.jobs.front();
+                queue.jobs.pop_front();
+                return true;
+            }
+        }
+
+        // Otherwise steal from the back of another worker's queue, away from where that worker is taking jobs
+        // Jobs are never added once running, so an empty pass over the queues means there is no work left
+        for (size_t i = 1; i < queues.size(); ++i) {
+            auto& queue = *queues[(worker + i) % queues.size()];
+            lock_guard<mutex> guard(queue.lock);
+            if (!queue.jobs.empty()) {
+                job = queue.jobs.back();
+                queue.jobs.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    scheduler::scheduler(size_t workers) :
+        _workers(max(workers, static_cast<size_t>(1)))
+    {
+    }
+
+    size_t scheduler::workers() const
+    {
+        return _workers;
+    }
+
+    void scheduler::run(size_t count, job_type const& job) const
+    {
+        if (count == 0) {
+            return;
+        }
+
+        // Give each worker a contiguous share of the jobs
+        auto workers = min(_workers, count);
+        vector<unique_ptr<job_queue>> queues;
+        for (size_t worker = 0; worker < workers; ++worker) {
+            queues.emplace_back(new job_queue());
+            for (size_t index = worker * count / workers; index < (worker + 1) * count / workers; ++index) {
+                queues.back()->jobs.push_back(index);
+            }
+        }
+
+        vector<exception_ptr> exceptions(count);
+        auto work = [&](size_t worker) {
+            size_t index;
+            while (take_job(queues, worker, index)) {
+                try {
+                    job(index, worker);
+                } catch (...) {
+                    exceptions[index] = current_exception();
+                }
+            }
+        };
+
+        // The calling thread is also a worker, so only start threads for the additional workers
+        vector<thread> threads;
+        for (size_t worker = 1; worker < workers; ++worker) {
+            threads.emplace_back(work, worker);
+        }
+        work(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        // Rethrow the first failure in job order so that errors are reported deterministically
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                rethrow_exception(exception);
+            }
+        }
+    }
+
+}}  // namespace puppet::compiler
@@ -0,0 +1,137 @@
+#include <puppet/compiler/server.hpp>
+#include <puppet/compiler/node.hpp>
+#include <puppet/facts/yaml.hpp>
+#include <puppet/cast.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <yaml-cpp/yaml.h>
+#include <chrono>
+#include <sstream>
+
+using namespace std;
+using namespace puppet::logging;
+using namespace puppet::runtime;
+
+namespace fs = boost::filesystem;
+namespace sys = boost::system;
+
+namespace puppet { namespace compiler {
+
+    // How long the autoloader remembers names that no module defines before searching the modules again
+    static auto const autoload_refresh_interval = chrono::seconds(5);
+
+    static string error_response(string const& message)
+    {
+        ostringstream response;
+        response << "{\"error\": ";
+        values::write_json(response, message);
+        response << "}\n";
+        return response.str();
+    }
+
+    static string get_member(YAML::Node const& request, char const* name)
+    {
+        auto member = request[name];
+        if (!member || member.IsNull()) {
+            return {};
+        }
+        if (!member.IsScalar()) {
+            throw server_exception((boost::format("expected a string for '%1%'.") % name).str());
+        }
+        return member.as<string>();
+    }
+
+    server::server(logging::logger& logger, compiler::settings const& settings) :
+        _logger(logger),
+        _settings(settings),
+        _stopped(false)
+    {
+    }
+
+    void server::stop()
+    {
+        _stopped = true;
+    }
+
+    string server::compile(string const& request, logging::logger& logger)
+    {
+        try {
+            // Requests are JSON, which YAML is a superset of
+            YAML::Node const document = YAML::Load(request);
+            if (!document.IsMap() || !document["facts"]) {
+                throw server_exception("expected an object with a 'facts' member.");
+            }
+
+            auto facts = make_shared<facts::yaml>(document["facts"]);
+            auto name = get_member(document, "node");
+            if (name.empty()) {
+                name = facts->node_name();
+                if (name.empty()) {
+                    throw server_exception("node name cannot be determined from facts: please specify the 'node' member.");
+                }
+            }
+            auto environment_name = get_member(document, "environment");
+            if (environment_name.empty()) {
+                environment_name = _settings.environment();
+            }
+            auto& environment = this->environment(environment_name);
+
+            // Pick up classes and defined types added to the modules since the last refresh
+            environment.autoloader().refresh(autoload_refresh_interval);
+
+            compiler::node node(name, environment, facts);
+            try {
+                LOG(notice, "compiling for node '%1%' with environment '%2%'.", node.name(), environment.name());
+                auto catalog = node.compile(logger, _settings);
+
+                ostringstream response;
+                catalog.write(response, node.name(), environment.name());
+                return response.str();
+            } catch (compilation_exception const& ex) {
+                LOG(error, ex.line(), ex.column(), ex.text(), ex.path(), "node '%1%': %2%", node.name(), ex.what());
+
+                ostringstream message;
+                if (!ex.path().empty()) {
+                    message << ex.path() << ":" << ex.line() << ":" << ex.column() << ": ";
+                }
+                message << ex.what();
+                return error_response(message.str());
+            }
+        } catch (YAML::Exception const& ex) {
+            LOG(error, "invalid request: %1%.", ex.msg);
+            return error_response("invalid request: " + ex.msg + ".");
+        } catch (facts::yaml_parse_exception const& ex) {
+            LOG(error, "invalid request: %1%", ex.what());
+            return error_response(string("invalid request: ") + ex.what());
+        } catch (server_exception const& ex) {
+            LOG(error, "invalid request: %1%", ex.what());
+            return error_response(string("invalid request: ") + ex.what());
+        }
+    }
+
+    compiler::environment& server::environment(string const& name)
+    {
+        // Environment names are used as directory names, so only allow the characters Puppet allows
+        if (name.find_first_not_of("abcdefghijklmnopqrstuvwxyz0123456789_") != string::npos) {
+            throw server_exception((boost::format("invalid environment name '%1%'.") % name).str());
+        }
+
+        lock_guard<mutex> lock(_mutex);
+        auto& environment = _environments[name];
+        if (!environment) {
+            // Other environments are found next to the configured environment's directory
+            auto base = _settings.environment_directory();
+            if (name != _settings.environment()) {
+                base = (fs::path(base).parent_path() / name).string();
+                sys::error_code ec;
+                if (!fs::is_directory(base, ec)) {
+                    _environments.erase(name);
+                    throw server_exception((boost::format("could not locate an environment directory for environment '%1%'.") % name).str());
+                }
+            }
+            environment.reset(new compiler::environment(name, rvalue_cast(base), _settings.module_directories(), _settings.cache_directory()));
+        }
+        return *environment;
+    }
+
+}}  // namespace puppet::compiler
@@ -11,6 +11,7 @@
 #include <boost/program_options.hpp>
 #pragma GCC diagnostic pop
 #include <iostream>
+#include <thread>
 
 using namespace std;
 namespace po = boost::program_options;
@@ -25,6 +26,16 @@ namespace puppet { namespace compiler {
         // Keep this list sorted alphabetically based on each option's long-form name
         po::options_description options("");
         options.add_options()
+            (
+                "batch",
+                po::value<string>(),
+                "The directory of YAML facts files to compile a catalog for each node from. Catalogs are written to the output directory."
+            )
+            (
+                "cache-dir",
+                po::value<string>(),
+                "The directory to cache parsed manifests in. Caching is disabled if not specified."
+            )
             (
                 "code-dir",
                 po::value<string>(),
@@ -38,6 +49,11 @@ namespace puppet { namespace compiler {
                 "debug,d",
                 "Enable debug output."
             )
+            (
+                "engine",
+                po::value<string>()->default_value("tree"),
+                "The engine to use to evaluate expressions.\nSupported engines: tree, vm."
+            )
             (
                 "environment,e",
                 po::value<string>()->default_value("production"),
@@ -53,10 +69,23 @@ namespace puppet { namespace compiler {
                 po::value<string>(),
                 "The path to the YAML facts file to use. Defaults to the current system's facts."
             )
+            (
+                "fork",
+                "Compiles nodes in forked worker processes rather than threads in batch mode. Manifests are parsed before forking and shared by the workers."
+            )
             (
                 "help",
                 "Print this help message."
             )
+            (
+                "jobs,j",
+                po::value<size_t>(),
+                "The number of manifests to parse in parallel or, in batch and serve modes, nodes to compile in parallel. Defaults to the number of hardware threads."
+            )
+            (
+                "lazy-parsing",
+                "Defers parsing the bodies of classes, defined types, and nodes until they are evaluated."
+            )
             (
                 "log-level,l",
                 po::value<logging::level>()->default_value(logging::level::notice, "notice"),
@@ -79,7 +108,12 @@ namespace puppet { namespace compiler {
             (
                 "output,o",
                 po::value<string>()->default_value("catalog.json"),
-                "The output path for the compiled catalog."
+                "The output path for the compiled catalog or the output directory in batch mode."
+            )
+            (
+                "serve",
+                po::value<string>(),
+                "The path of the Unix domain socket to serve compilation requests on. Each request gives a node's facts and receives its catalog."
             )
             (
                 "verbose",
@@ -160,70 +194,69 @@ namespace puppet { namespace compiler {
         }
 
         // If no node name was specified, use the FQDN fact
-        // NOTE: the following uses of boost::get are safe because facts never contain runtime variables
-        // Next try "networking" fact
-        auto networking = facts.lookup("networking");
-        if (networking) {
-            if (auto ptr = boost::get<runtime::values::hash const>(networking.get())) {
-                auto it = ptr->find(string("fqdn"));
-                if (it != ptr->end()) {
-                    if (auto str = boost::get<string const>(&it->second)) {
-                        name = *str;
-                    }
-                }
-                // Fallback to the hostname and domain if present
-                if (name.empty()) {
-                    auto hostname = ptr->find(string("hostname"));
-                    if (hostname != ptr->end()) {
-                        if (auto str = boost::get<string const>(&hostname->second)) {
-                            name = *str;
-                        }
-                        if (!name.empty()) {
-                            auto domain = ptr->find(string("domain"));
-                            if (domain != ptr->end()) {
-                                if (auto str = boost::get<string const>(&domain->second)) {
-                                    name += "." + *str;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        name = facts.node_name();
 
-        // Next try the legacy fqdn fact
+        // If still empty, user must explicitly specify
         if (name.empty()) {
-            auto fqdn = facts.lookup("fqdn");
-            if (fqdn) {
-                if (auto ptr = boost::get<string const>(fqdn.get())) {
-                    name = *ptr;
-                }
-            }
+            throw settings_exception("node name cannot be determined from facts: please specify the --node option to set the node name.");
+        }
+        return name;
+    }
+
+    static string get_batch_directory(po::variables_map const& vm)
+    {
+        if (!vm.count("batch")) {
+            return string();
         }
 
-        // Next try legacy hostname + domain facts
-        if (name.empty()) {
-            auto hostname = facts.lookup("hostname");
-            if (hostname) {
-                if (auto ptr = boost::get<string const>(hostname.get())) {
-                    name = *ptr;
-                }
-                if (!name.empty()) {
-                    auto domain = facts.lookup("domain");
-                    if (domain) {
-                        if (auto ptr = boost::get<string const>(domain.get())) {
-                            name += "." + *ptr;
-                        }
-                    }
-                }
-            }
+        // Check for conflicting options
+        if (vm.count("facts") || vm.count("node")) {
+            throw settings_exception("batch option conflicts with the facts and node options: each node's facts and name come from its facts file.");
         }
 
-        // If still empty, user must explicitly specify
-        if (name.empty()) {
-            throw settings_exception("node name cannot be determined from facts: please specify the --node option to set the node name.");
+        auto directory = vm["batch"].as<string>();
+        sys::error_code ec;
+        auto path = fs::canonical(directory, ec);
+        if (ec || !fs::is_directory(path, ec)) {
+            throw settings_exception((boost::format("invalid batch directory '%1%': expected a directory of YAML facts files.") % directory).str());
         }
-        return name;
+        return path.string();
+    }
+
+    static bool get_fork_workers(po::variables_map const& vm)
+    {
+        if (!vm.count("fork")) {
+            return false;
+        }
+        if (!vm.count("batch")) {
+            throw settings_exception("fork option requires the batch option.");
+        }
+        return true;
+    }
+
+    static string get_server_socket(po::variables_map const& vm)
+    {
+        if (!vm.count("serve")) {
+            return string();
+        }
+
+        // Check for conflicting options
+        if (vm.count("batch")) {
+            throw settings_exception("serve and batch options conflict: please specify only one.");
+        }
+        if (vm.count("facts") || vm.count("node")) {
+            throw settings_exception("serve option conflicts with the facts and node options: each request gives the node's facts and name.");
+        }
+        return fs::absolute(vm["serve"].as<string>()).string();
+    }
+
+    static string get_output_file(po::variables_map const& vm, bool batch)
+    {
+        // In batch mode, default to writing the catalogs to the current directory
+        if (batch && vm["output"].defaulted()) {
+            return fs::current_path().string();
+        }
+        return fs::absolute(vm["output"].as<string>()).string();
     }
 
     static vector<string> get_manifests(po::variables_map const& vm)
@@ -238,6 +271,40 @@ namespace puppet { namespace compiler {
         return manifests;
     }
 
+    static string get_cache_directory(po::variables_map const& vm)
+    {
+        if (vm.count("cache-dir")) {
+            return fs::absolute(vm["cache-dir"].as<string>()).string();
+        }
+        return string();
+    }
+
+    static size_t get_jobs(po::variables_map const& vm)
+    {
+        if (vm.count("jobs")) {
+            auto jobs = vm["jobs"].as<size_t>();
+            if (jobs == 0) {
+                throw settings_exception("the number of jobs must be greater than zero.");
+            }
+            return jobs;
+        }
+
+        // Default to the number of hardware threads (this may be unknown)
+        return max(thread::hardware_concurrency(), 1u);
+    }
+
+    static runtime::engine get_engine(po::variables_map const& vm)
+    {
+        auto engine = vm["engine"].as<string>();
+        if (engine == "tree") {
+            return runtime::engine::tree;
+        }
+        if (engine == "vm") {
+            return runtime::engine::vm;
+        }
+        throw settings_exception((boost::format("invalid engine '%1%': expected 'tree' or 'vm'.") % engine).str());
+    }
+
     static string get_environment_directory(po::variables_map const& vm, string const& code_directory, string const& environment)
     {
         bool specified = false;
@@ -308,6 +375,10 @@ namespace puppet { namespace compiler {
     }
 
     settings::settings() :
+        _jobs(1),
+        _engine(runtime::engine::tree),
+        _lazy_parsing(false),
+        _fork_workers(false),
         _log_level(logging::level::notice),
         _show_help(false),
         _show_version(false)
@@ -316,6 +387,10 @@ namespace puppet { namespace compiler {
     }
 
     settings::settings(int argc, char const* argv[]) :
+        _jobs(1),
+        _engine(runtime::engine::tree),
+        _lazy_parsing(false),
+        _fork_workers(false),
         _log_level(logging::level::notice),
         _show_help(false),
         _show_version(false)
@@ -348,11 +423,51 @@ namespace puppet { namespace compiler {
         return _manifests;
     }
 
+    string const& settings::cache_directory() const
+    {
+        return _cache_directory;
+    }
+
+    size_t settings::jobs() const
+    {
+        return _jobs;
+    }
+
+    runtime::engine settings::engine() const
+    {
+        return _engine;
+    }
+
+    bool settings::lazy_parsing() const
+    {
+        return _lazy_parsing;
+    }
+
+    string const& settings::batch_directory() const
+    {
+        return _batch_directory;
+    }
+
+    bool settings::fork_workers() const
+    {
+        return _fork_workers;
+    }
+
+    string const& settings::server_socket() const
+    {
+        return _server_socket;
+    }
+
     string const& settings::node_name() const
     {
         return _node_name;
     }
 
+    string const& settings::output_file() const
+    {
+        return _output_file;
+    }
+
     shared_ptr<facts::provider> const& settings::facts() const
     {
         return _facts;
@@ -396,12 +511,42 @@ namespace puppet { namespace compiler {
             "the compiler will compile the manifest for the 'production' environment.\n"
             "\n"
             "Manifests will be evaluated in the order they are presented on the command line.\n"
+            "Manifests are parsed in parallel; use the --jobs option to limit the number of\n"
+            "manifests parsed at once.\n"
+            "\n"
+            "Use the --cache-dir option to cache parsed manifests on disk; unchanged manifests\n"
+            "are loaded from the cache rather than parsed again.\n"
+            "\n"
+            "Use the --lazy-parsing option to only parse the bodies of the classes, defined\n"
+            "types, and nodes that are evaluated; syntax errors in the other bodies are not\n"
+            "reported.\n"
+            "\n"
+            "Use the --batch option to compile a catalog for every node with a YAML facts file\n"
+            "in the given directory; manifests are parsed once and shared by every node. Each\n"
+            "catalog is written to '<node>.json' in the output directory. Nodes are compiled in\n"
+            "parallel; use the --jobs option to limit the number of nodes compiled at once.\n"
+            "\n"
+            "Use the --fork option with --batch to compile nodes in forked worker processes\n"
+            "instead of threads. Every manifest, including those in modules, is parsed before\n"
+            "the workers are forked, so the workers share the parsed manifests copy-on-write.\n"
+            "Each worker's throughput and memory usage is reported when the batch completes.\n"
+            "\n"
+            "Use the --serve option to run a compile server on a Unix domain socket. A client\n"
+            "writes a JSON request such as {\"node\": \"web1\", \"facts\": {...}}, shuts down\n"
+            "its side of the connection, and reads back the JSON catalog or {\"error\": ...}.\n"
+            "Parsed manifests stay in memory between requests and are parsed again when they\n"
+            "change on disk.\n"
             "\n"
             "Examples\n"
             "========\n\n"
             "  puppetcpp\n"
             "  puppetcpp manifest.pp\n"
-            "  puppetcpp -e test -f facts.yaml"
+            "  puppetcpp -e test -f facts.yaml\n"
+            "  puppetcpp -j 4 site.pp nodes.pp\n"
+            "  puppetcpp --cache-dir /tmp/puppetcpp site.pp\n"
+            "  puppetcpp --batch facts -o catalogs site.pp\n"
+            "  puppetcpp --batch facts --fork -j 8 -o catalogs site.pp\n"
+            "  puppetcpp --serve /tmp/puppetcpp.sock site.pp"
             << endl;
     }
 
@@ -466,14 +611,38 @@ namespace puppet { namespace compiler {
         // Populate the module directories
         _module_directories = get_module_directories(vm, _code_directory);
 
-        // Populate the facts provider
-        _facts = get_facts(vm);
+        // Populate the batch directory
+        _batch_directory = get_batch_directory(vm);
+
+        // Populate whether or not batch mode forks worker processes
+        _fork_workers = get_fork_workers(vm);
 
-        // Populate the node name
-        _node_name = get_node(vm, *_facts);
+        // Populate the server socket
+        _server_socket = get_server_socket(vm);
+
+        // Populate the facts provider and node name; in batch and serve modes these come from each node's facts
+        if (_batch_directory.empty() && _server_socket.empty()) {
+            _facts = get_facts(vm);
+            _node_name = get_node(vm, *_facts);
+        }
+
+        // Populate the output path
+        _output_file = get_output_file(vm, !_batch_directory.empty());
 
         // Populate the manifests to compile
         _manifests = get_manifests(vm);
+
+        // Populate the number of jobs
+        _jobs = get_jobs(vm);
+
+        // Populate the cache directory
+        _cache_directory = get_cache_directory(vm);
+
+        // Populate the expression evaluation engine
+        _engine = get_engine(vm);
+
+        // Populate whether or not definition bodies are parsed lazily
+        _lazy_parsing = vm.count("lazy-parsing") > 0;
     }
 
 }}  // namespace puppet::compiler
\ No newline at end of file
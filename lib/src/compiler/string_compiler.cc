@@ -0,0 +1,399 @@
+#include <puppet/compiler/string_compiler.hpp>
+#include <puppet/compiler/parser.hpp>
+#include <puppet/ast/interpolated_string.hpp>
+#include <puppet/ast/expression_def.hpp>
+#include <puppet/cast.hpp>
+#include <boost/format.hpp>
+#include <codecvt>
+#include <cctype>
+
+using namespace std;
+using namespace puppet::lexer;
+
+namespace puppet { namespace compiler {
+
+    template <typename Value>
+    struct hex_to
+    {
+        operator Value() const
+        {
+            return value;
+        }
+
+        friend istream& operator>>(istream& in, hex_to& out)
+        {
+            in >> std::hex >> out.value;
+            return in;
+        }
+
+     private:
+        Value value;
+    };
+
+    struct string_compiler_impl
+    {
+        explicit string_compiler_impl(ast::string const& str) :
+            _str(str)
+        {
+        }
+
+        shared_ptr<ast::interpolated_string const> compile()
+        {
+            auto const& text = _str.value();
+            auto const& escapes = _str.escapes();
+            int margin = _str.margin();
+
+            // Position the iterators where the text starts in the source so that parsed expressions have source positions
+            auto start = lexer::position(_str.position().offset() + (_str.quote() ? 1 : 0), _str.position().line());
+            auto begin = lex_begin(text);
+            auto end = lex_end(text);
+            begin.position(start);
+
+            _literal.reserve(text.size());
+
+            int current_margin = margin;
+            while (begin != end) {
+                // This logic handles heredocs with margin specifiers (margin > 0)
+                for (; current_margin > 0 && begin != end; ++begin) {
+                    // If we've found a non-whitespace character, we're done
+                    if (*begin != ' ' && *begin != '\t') {
+                        break;
+                    }
+                    // If we've found a tab, decrement by the tab width
+                    if (*begin == '\t') {
+                        current_margin -= (current_margin > LEXER_TAB_WIDTH ? LEXER_TAB_WIDTH : current_margin);
+                    } else {
+                        current_margin -= 1;
+                    }
+                }
+                if (begin == end) {
+                    break;
+                }
+
+                // No more margin for this line
+                current_margin = 0;
+
+                // Perform escape replacements
+                if (*begin == '\\' && !escapes.empty()) {
+                    auto next = begin;
+                    ++next;
+                    if (next != end && *next == '\r') {
+                        ++next;
+                    }
+                    if (next != end && escapes.find(*next) != string::npos) {
+                        bool success = true;
+                        switch (*next) {
+                            case 'r':
+                                _literal += '\r';
+                                break;
+
+                            case 'n':
+                                _literal += '\n';
+                                break;
+
+                            case 't':
+                                _literal += '\t';
+                                break;
+
+                            case 's':
+                                _literal += ' ';
+                                break;
+
+                            case 'u':
+                                success = write_unicode_escape_sequence(begin.position(), ++next, end);
+                                break;
+
+                            case '\n':
+                                // Treat as new line, so reset the margin
+                                current_margin = margin;
+                                break;
+
+                            case '$':
+                                _literal += '$';
+                                break;
+
+                            default:
+                                _literal += *next;
+                                break;
+                        }
+                        if (success) {
+                            begin = ++next;
+                            continue;
+                        }
+                    } else if (next != end) {
+                        // Warn for invalid escape sequence (unless single quoted string)
+                        if (_str.quote() != '\'') {
+                            warn(begin.position(), (boost::format("invalid escape sequence '\\%1%'.") % *next).str());
+                        }
+                    }
+                } else if (*begin == '\n') {
+                    // Reset the margin
+                    current_margin = margin;
+                } else if (_str.interpolated() && *begin == '$') {
+                    auto next = begin;
+                    ++next;
+
+                    if (next != end && !isspace(*next)) {
+                        // First attempt to interpolate a variable using the lexer
+                        if (compile_variable(begin.position(), next, end)) {
+                            begin = next;
+                            continue;
+                        }
+                        // Otherwise, check for expression form
+                        if (*next == '{') {
+                            // Parse the rest of the string
+                            // The parsing will stop at the first unmatched } token
+                            auto tree = parser::parse(next, end, true);
+                            if (tree.body()) {
+                                compile_expressions(*tree.body());
+                            }
+
+                            // Move past where parsing stopped (must have been at the closing })
+                            begin = lexer_string_iterator(text.data() + (tree.end().offset() - start.offset()));
+                            begin.position(tree.end());
+                            ++begin;
+                            continue;
+                        }
+                    }
+                }
+
+                _literal += *begin++;
+            }
+
+            // Remove the trailing line break if instructed to do so
+            if (_str.remove_break()) {
+                if (boost::ends_with(text, "\n") && !_literal.empty()) {
+                    _literal.pop_back();
+                }
+                if (boost::ends_with(text, "\r") && !_literal.empty()) {
+                    _literal.pop_back();
+                }
+            }
+            flush();
+            return make_shared<ast::interpolated_string const>(rvalue_cast(_segments), rvalue_cast(_warnings));
+        }
+
+     private:
+        void flush()
+        {
+            if (_literal.empty()) {
+                return;
+            }
+            _segments.emplace_back(rvalue_cast(_literal));
+            _literal.clear();
+        }
+
+        void warn(lexer::position const& position, string message)
+        {
+            _warnings.emplace_back(position, rvalue_cast(message));
+        }
+
+        bool compile_variable(lexer::position const& position, lexer_string_iterator& begin, lexer_string_iterator const& end)
+        {
+            try {
+                bool bracket = begin != end && *begin == '{';
+                parser::lexer_type lexer;
+
+                auto current = begin;
+                auto token_begin = lexer.begin(current, end);
+                auto token_end = lexer.end();
+
+                // Check for the following forms:
+                // {keyword}, {name/bare_word}, {decimal}
+                // name, decimal
+
+                // Skip past the opening bracket
+                if (bracket && token_begin != token_end && token_begin->id() == '{') {
+                    ++token_begin;
+                }
+
+                string name;
+                if (token_begin != token_end &&
+                    (
+                        is_keyword(static_cast<token_id>(token_begin->id())) ||
+                        token_begin->id() == static_cast<size_t>(token_id::name) ||
+                        token_begin->id() == static_cast<size_t>(token_id::bare_word)
+                    )) {
+                    auto token = boost::get<boost::iterator_range<lexer_string_iterator>>(&token_begin->value());
+                    if (!token) {
+                        return false;
+                    }
+                    name.assign(token->begin(), token->end());
+                } else if (token_begin != token_end && token_begin->id() == static_cast<size_t>(token_id::number)) {
+                    auto token = boost::get<number_token>(&token_begin->value());
+                    if (!token) {
+                        return false;
+                    }
+                    if (token->base() != numeric_base::decimal || token->value().which() != 0) {
+                        throw parse_exception(position, (boost::format("'%1%' is not a valid match variable name.") % *token).str());
+                    }
+                    name = boost::lexical_cast<string>(boost::get<int64_t>(token->value()));
+                } else {
+                    return false;
+                }
+
+                // If bracketed, look for the closing bracket
+                if (bracket) {
+                    ++token_begin;
+
+                    // Check for not parsed or missing a closing } token
+                    if (token_begin == token_end || token_begin->id() != '}') {
+                        return false;
+                    }
+                }
+
+                // Output the variable
+                flush();
+                vector<ast::expression> expressions;
+                expressions.emplace_back(ast::basic_expression(ast::variable(position, rvalue_cast(name))));
+                _segments.emplace_back(rvalue_cast(expressions));
+
+                // Update to where we stopped lexing
+                begin = current;
+                return true;
+            } catch (lexer_exception<lexer_string_iterator> const& ex) {
+                throw parse_exception(ex.location().position(), ex.what());
+            }
+        }
+
+        void compile_expressions(vector<ast::expression> expressions)
+        {
+            if (expressions.empty()) {
+                return;
+            }
+
+            // Transform a leading name followed by an access or method call to its "variable" form
+            transform_expression(expressions.front());
+
+            flush();
+            _segments.emplace_back(rvalue_cast(expressions));
+        }
+
+        static void transform_expression(ast::expression& expression)
+        {
+            // Check for a postfix expression
+            auto postfix = boost::get<ast::postfix_expression>(&expression.primary());
+            if (!postfix || postfix->subexpressions().empty()) {
+                return;
+            }
+
+            // Check for access or method call
+            auto& subexpression = postfix->subexpressions().front();
+            if (!boost::get<ast::access_expression>(&subexpression) &&
+                !boost::get<ast::method_call_expression>(&subexpression)) {
+                return;
+            }
+
+            // If the expression is a name followed by an access operation or method call, treat as a variable
+            auto basic = boost::get<ast::basic_expression>(&postfix->primary());
+            if (!basic) {
+                return;
+            }
+
+            lexer::position variable_position;
+            string variable_name;
+
+            // Check for name
+            auto name = boost::get<ast::name>(basic);
+            if (name) {
+                variable_position = name->position();
+                variable_name = name->value();
+            } else {
+                // Also check for bare word
+                auto word = boost::get<ast::bare_word>(basic);
+                if (word) {
+                    variable_position = word->position();
+                    variable_name = word->value();
+                }
+            }
+            if (variable_name.empty()) {
+                return;
+            }
+            expression = ast::expression(ast::postfix_expression(ast::basic_expression(ast::variable(rvalue_cast(variable_position), rvalue_cast(variable_name))), postfix->subexpressions()), expression.binary());
+        }
+
+        bool write_unicode_escape_sequence(lexer::position const& position, lexer_string_iterator& begin, lexer_string_iterator const& end)
+        {
+            // Check for a variable length unicode escape sequence
+            bool variable_length = false;
+            if (begin != end && *begin == '{') {
+                ++begin;
+                variable_length = true;
+            }
+
+            string characters;
+            characters.reserve(6);
+            for (; begin != end; ++begin) {
+                // Break on '}' for variable length
+                if (variable_length && *begin == '}') {
+                    break;
+                }
+                // Check for valid hex digit
+                if (!isxdigit(*begin)) {
+                    warn(position, (boost::format("unicode escape sequence contains non-hexadecimal character '%1%'.") % *begin).str());
+                    return false;
+                }
+
+                characters.push_back(*begin);
+
+                // Break on 4 characters for fixed length
+                if (!variable_length && characters.size() == 4) {
+                    break;
+                }
+            }
+
+            if (variable_length) {
+                if (begin == end || *begin != '}') {
+                    warn(position, "a closing '}' was not found for unicode escape sequence.");
+                    return false;
+                }
+                if (characters.empty() || characters.size() > 6) {
+                    warn(position, "expected at least 1 and at most 6 hexadecimal digits for unicode escape sequence.");
+                    return false;
+                }
+            }
+
+            // Convert the input to a unicode character
+            char32_t from;
+            try {
+                from = static_cast<char32_t>(boost::lexical_cast<hex_to<uint32_t>>(characters));
+            } catch (boost::bad_lexical_cast const&) {
+                warn(position, "invalid unicode escape sequence.");
+                return false;
+            }
+
+            // Convert the unicode character to utf8 bytes (maximum is 4 bytes)
+            codecvt_utf8<char32_t> converter;
+            char32_t const* next_from = nullptr;
+            char* next_to = nullptr;
+            auto state = mbstate_t();
+            char buffer[4] = {};
+            converter.out(state, &from, &from + 1, next_from, buffer, std::end(buffer), next_to);
+
+            // Ensure all characters were converted (there was only one)
+            if (next_from != &from + 1) {
+                warn(position, "invalid unicode code point.");
+                return false;
+            }
+
+            // Output the number of bytes converted
+            for (size_t i = 0; (&buffer[0] + i) < next_to; ++i) {
+                _literal += buffer[i];
+            }
+            return true;
+        }
+
+        ast::string const& _str;
+        string _literal;
+        vector<ast::interpolated_string::segment> _segments;
+        vector<ast::interpolated_string::warning> _warnings;
+    };
+
+    ast::string string_compiler::compile(ast::string const& str)
+    {
+        string_compiler_impl impl(str);
+        auto compiled = impl.compile();
+        return ast::string(str.position(), str.value(), str.escapes(), str.quote(), str.interpolated(), str.format(), str.margin(), str.remove_break(), rvalue_cast(compiled));
+    }
+
+}}  // namespace puppet::compiler
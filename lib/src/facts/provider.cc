@@ -0,0 +1,72 @@
+#include <puppet/facts/provider.hpp>
+
+using namespace std;
+
+namespace puppet { namespace facts {
+
+    string provider::node_name()
+    {
+        string name;
+
+        // NOTE: the following uses of boost::get are safe because facts never contain runtime variables
+        // First try "networking" fact
+        auto networking = lookup("networking");
+        if (networking) {
+            if (auto ptr = boost::get<runtime::values::hash const>(networking.get())) {
+                auto it = ptr->find(string("fqdn"));
+                if (it != ptr->end()) {
+                    if (auto str = boost::get<string const>(&it->second)) {
+                        name = *str;
+                    }
+                }
+                // Fallback to the hostname and domain if present
+                if (name.empty()) {
+                    auto hostname = ptr->find(string("hostname"));
+                    if (hostname != ptr->end()) {
+                        if (auto str = boost::get<string const>(&hostname->second)) {
+                            name = *str;
+                        }
+                        if (!name.empty()) {
+                            auto domain = ptr->find(string("domain"));
+                            if (domain != ptr->end()) {
+                                if (auto str = boost::get<string const>(&domain->second)) {
+                                    name += "." + *str;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Next try the legacy fqdn fact
+        if (name.empty()) {
+            auto fqdn = lookup("fqdn");
+            if (fqdn) {
+                if (auto ptr = boost::get<string const>(fqdn.get())) {
+                    name = *ptr;
+                }
+            }
+        }
+
+        // Next try legacy hostname + domain facts
+        if (name.empty()) {
+            auto hostname = lookup("hostname");
+            if (hostname) {
+                if (auto ptr = boost::get<string const>(hostname.get())) {
+                    name = *ptr;
+                }
+                if (!name.empty()) {
+                    auto domain = lookup("domain");
+                    if (domain) {
+                        if (auto ptr = boost::get<string const>(domain.get())) {
+                            name += "." + *ptr;
+                        }
+                    }
+                }
+            }
+        }
+        return name;
+    }
+
+}}  // namespace puppet::facts
@@ -62,6 +62,20 @@ namespace puppet { namespace facts {
         }
     }
 
+    yaml::yaml(Node const& facts)
+    {
+        if (!facts.IsMap()) {
+            throw yaml_parse_exception("failed parsing facts: expected a map of fact names to values.");
+        }
+        try {
+            for (auto const& kvp : facts) {
+                store(kvp.first.as<string>(), kvp.second);
+            }
+        } catch (Exception& ex) {
+            throw yaml_parse_exception((boost::format("failed parsing facts: %1%.") % ex.msg).str());
+        }
+    }
+
     shared_ptr<values::value const> yaml::lookup(string const& name)
     {
         // Check the cache for the value
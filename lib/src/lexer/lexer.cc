@@ -18,12 +18,22 @@ namespace puppet { namespace lexer {
 
     lexer_string_iterator lex_begin(string const& str)
     {
-        return lexer_string_iterator(typename lexer_string_iterator::base_type(str.begin()));
+        return lexer_string_iterator(str.data());
     }
 
     lexer_string_iterator lex_end(string const& str)
     {
-        return lexer_string_iterator(typename lexer_string_iterator::base_type(str.end()));
+        return lexer_string_iterator(str.data() + str.size());
+    }
+
+    lexer_string_iterator lex_begin(source_buffer const& buffer)
+    {
+        return lexer_string_iterator(buffer.data());
+    }
+
+    lexer_string_iterator lex_end(source_buffer const& buffer)
+    {
+        return lexer_string_iterator(buffer.data() + buffer.size());
     }
 
     lexer_string_iterator lex_begin(boost::iterator_range<lexer_string_iterator> const& range)
@@ -116,26 +126,45 @@ namespace puppet { namespace lexer {
         return make_tuple(rvalue_cast(text), column);
     }
 
-    tuple<string, size_t> get_text_and_column(string const& input, size_t position, size_t tab_width)
+    static tuple<string, size_t> get_text_and_column(char const* start, char const* current, char const* stop, size_t tab_width)
     {
-        auto start = input.rfind('\n', position);
-        if (start == string::npos) {
-            start = 0;
-        } else {
-            ++start;
-        }
-
-        string text = input.substr(start, input.find('\n', start));
+        string text(start, stop);
 
         // Convert tabs to spaces
-        size_t column = (position - start) + 1;
+        size_t column = (current - start) + 1;
         if (tab_width > 1) {
-            column += count(text.begin(), text.begin() + column, '\t') * (tab_width - 1);
+            column += count(start, current, '\t') * (tab_width - 1);
         }
 
         return make_tuple(rvalue_cast(text), column);
     }
 
+    tuple<string, size_t> get_text_and_column(string const& input, size_t position, size_t tab_width)
+    {
+        if (position > input.size()) {
+            return make_tuple("", 1);
+        }
+
+        // Find the start and end of the line containing the position
+        auto begin = input.data();
+        auto current = begin + position;
+        auto start = find(reverse_iterator<char const*>(current), reverse_iterator<char const*>(begin), '\n').base();
+        auto stop = find(current, begin + input.size(), '\n');
+        return get_text_and_column(start, current, stop, tab_width);
+    }
+
+    tuple<string, size_t> get_text_and_column(source_buffer const& buffer, size_t position, size_t tab_width)
+    {
+        if (position > buffer.size()) {
+            return make_tuple("", 1);
+        }
+
+        // Use the buffer's line index rather than scanning for the line
+        auto bounds = buffer.line_bounds(position);
+        auto begin = buffer.data();
+        return get_text_and_column(begin + bounds.first, begin + position, begin + bounds.second, tab_width);
+    }
+
     position get_last_position(ifstream& input)
     {
         // We need to read the entire file looking for new lines
@@ -160,11 +189,11 @@ namespace puppet { namespace lexer {
         return position(offset, line);
     }
 
-    position get_last_position(string const& input)
+    static position get_last_position(char const* begin, char const* end)
     {
         std::size_t offset = 0, line = 1;
         std::size_t current_offset = 0, current_line = 1;
-        for (auto it = input.begin(); it != input.end(); ++it) {
+        for (auto it = begin; it != end; ++it) {
             if (*it == '\n') {
                 ++current_line;
             }
@@ -179,6 +208,16 @@ namespace puppet { namespace lexer {
         return position(offset, line);
     }
 
+    position get_last_position(string const& input)
+    {
+        return get_last_position(input.data(), input.data() + input.size());
+    }
+
+    position get_last_position(source_buffer const& buffer)
+    {
+        return get_last_position(buffer.data(), buffer.data() + buffer.size());
+    }
+
     position get_last_position(boost::iterator_range<lexer_string_iterator> const& range)
     {
         // Get the last position in the range (end is non-inclusive)
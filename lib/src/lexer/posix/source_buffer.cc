@@ -0,0 +1,82 @@
+#include <puppet/lexer/source_buffer.hpp>
+#include <boost/format.hpp>
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace puppet { namespace lexer {
+
+    source_buffer::source_buffer(string const& path, bool copy) :
+        _data(nullptr),
+        _size(0)
+    {
+        int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw source_exception((boost::format("'%1%' does not exist or cannot be read.") % path).str());
+        }
+
+        struct stat info;
+        if (fstat(descriptor, &info) != 0 || !S_ISREG(info.st_mode)) {
+            close(descriptor);
+            throw source_exception((boost::format("'%1%' is not a regular file.") % path).str());
+        }
+
+        // Empty files cannot be mapped; treat them as an empty buffer
+        if (info.st_size == 0) {
+            close(descriptor);
+            index_lines();
+            return;
+        }
+
+        if (copy) {
+            // Read the whole file; it may have been truncated since it was stat'd, so stop at the end of the file
+            auto size = static_cast<size_t>(info.st_size);
+            _copy.reset(new char[size]);
+            while (_size < size) {
+                auto count = read(descriptor, _copy.get() + _size, size - _size);
+                if (count < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (count < 0) {
+                    close(descriptor);
+                    throw source_exception((boost::format("'%1%' could not be read.") % path).str());
+                }
+                if (count == 0) {
+                    break;
+                }
+                _size += static_cast<size_t>(count);
+            }
+            close(descriptor);
+            _data = _size ? _copy.get() : nullptr;
+            index_lines();
+            return;
+        }
+
+        // Map the file and close the descriptor immediately; the mapping remains valid until unmapped
+        auto data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+        if (data == MAP_FAILED) {
+            throw source_exception((boost::format("'%1%' could not be mapped into memory.") % path).str());
+        }
+
+        // The lexer reads the file front to back
+        madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+        _data = static_cast<char const*>(data);
+        _size = static_cast<size_t>(info.st_size);
+
+        index_lines();
+    }
+
+    source_buffer::~source_buffer()
+    {
+        if (_data && !_copy) {
+            munmap(const_cast<char*>(_data), _size);
+        }
+    }
+
+}}  // namespace puppet::lexer
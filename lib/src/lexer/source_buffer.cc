@@ -0,0 +1,56 @@
+#include <puppet/lexer/source_buffer.hpp>
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace puppet { namespace lexer {
+
+    source_exception::source_exception(string const& message) :
+        runtime_error(message)
+    {
+    }
+
+    char const* source_buffer::data() const
+    {
+        return _data;
+    }
+
+    size_t source_buffer::size() const
+    {
+        return _size;
+    }
+
+    size_t source_buffer::lines() const
+    {
+        return _line_starts.size();
+    }
+
+    pair<size_t, size_t> source_buffer::line_bounds(size_t offset) const
+    {
+        offset = min(offset, _size);
+
+        // Find the last line that starts at or before the offset
+        auto it = upper_bound(_line_starts.begin(), _line_starts.end(), offset);
+        size_t start = *(it - 1);
+        size_t stop = it == _line_starts.end() ? _size : *it - 1;
+        return make_pair(start, stop);
+    }
+
+    void source_buffer::index_lines()
+    {
+        _line_starts.clear();
+        _line_starts.push_back(0);
+
+        auto end = _data + _size;
+        for (auto current = _data; current && current < end;) {
+            auto newline = static_cast<char const*>(memchr(current, '\n', end - current));
+            if (!newline) {
+                break;
+            }
+            current = newline + 1;
+            _line_starts.push_back(current - _data);
+        }
+    }
+
+}}  // namespace puppet::lexer
@@ -7,7 +7,7 @@ namespace puppet { namespace lexer {
 
     ostream& operator<<(ostream& os, token_id const& id)
     {
-        static map<token_id, string> token_names = {
+        static map<token_id, string> const token_names = {
             { token_id::append,                 "unsupported '+=' operator" },
             { token_id::remove,                 "'-='" },
             { token_id::equals,                 "'=='" },
@@ -92,6 +92,9 @@ namespace puppet { namespace logging {
         if (!would_log(level)) {
             return;
         }
+
+        // Messages may be logged from multiple threads (e.g. when parsing manifests in parallel)
+        lock_guard<mutex> lock(_mutex);
         if (level == logging::level::warning) {
             ++_warnings;
         } else if (level >= logging::level::error) {
@@ -110,6 +113,13 @@ namespace puppet { namespace logging {
         return _errors;
     }
 
+    void logger::add(size_t warnings, size_t errors)
+    {
+        lock_guard<mutex> lock(_mutex);
+        _warnings += warnings;
+        _errors += errors;
+    }
+
     logging::level logger::level() const
     {
         return _level;
@@ -245,4 +255,27 @@ namespace puppet { namespace logging {
         return level >= logging::level::warning ? _colorize_stderr : _colorize_stdout;
     }
 
+    buffered_logger::buffered_logger(logger& target) :
+        _target(target)
+    {
+        level(target.level());
+    }
+
+    void buffered_logger::flush()
+    {
+        // Keep the messages of each buffer together when buffers are flushed from different threads
+        static mutex flush_mutex;
+        lock_guard<mutex> lock(flush_mutex);
+
+        for (auto const& entry : _entries) {
+            _target.log(entry.level, entry.line, entry.column, entry.text, entry.path, entry.message);
+        }
+        _entries.clear();
+    }
+
+    void buffered_logger::log_message(logging::level level, size_t line, size_t column, string const& text, string const& path, string const& message)
+    {
+        _entries.push_back(entry{ level, line, column, text, path, message });
+    }
+
 }}  // namespace puppet::logging
@@ -1,22 +1,17 @@
 #include <puppet/runtime/catalog.hpp>
 #include <puppet/runtime/expression_evaluator.hpp>
 #include <puppet/runtime/executor.hpp>
+#include <puppet/runtime/constant_folder.hpp>
 #include <puppet/compiler/node.hpp>
 #include <puppet/ast/expression_def.hpp>
-#include <boost/graph/tiernan_all_cycles.hpp>
+#include <boost/graph/strong_components.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 
 using namespace std;
 using namespace puppet::lexer;
 using namespace puppet::runtime::values;
 
-namespace boost {
-    // Helper needed for dependency cycle detection
-    void renumber_vertex_indices(puppet::runtime::dependency_graph const&)
-    {
-    }
-}
-
 namespace puppet { namespace runtime {
 
     attributes::attributes(shared_ptr<runtime::attributes const> parent) :
@@ -24,24 +19,42 @@ namespace puppet { namespace runtime {
     {
     }
 
-    shared_ptr<values::value const> attributes::get(string const& name, bool check_parent) const
+    vector<attributes::value_type>::iterator attributes::find(symbol const& name)
+    {
+        // Resources have few attributes, so scanning them by identity is cheaper than a binary search comparing names
+        return find_if(_values.begin(), _values.end(), [&](value_type const& element) { return element.first == name; });
+    }
+
+    vector<attributes::value_type>::const_iterator attributes::find(symbol const& name) const
+    {
+        return find_if(_values.begin(), _values.end(), [&](value_type const& element) { return element.first == name; });
+    }
+
+    values::value const* attributes::get(symbol const& name, bool check_parent) const
     {
         // Check the values first
-        auto it = _values.find(name);
+        auto it = find(name);
         if (it != _values.end()) {
-            return is_undef(*it->second) ? nullptr : it->second;
+            return is_undef(it->second) ? nullptr : &it->second;
         }
         // Check the parent if there is one
         return (check_parent && _parent) ? _parent->get(name) : nullptr;
     }
 
-    void attributes::set(string const& name, values::value value)
+    void attributes::set(symbol const& name, values::value value)
     {
-        // Set the value
-        _values[name] = make_shared<values::value>(rvalue_cast(value));
+        auto it = find(name);
+        if (it != _values.end()) {
+            it->second = rvalue_cast(value);
+            return;
+        }
+
+        // Keep the values sorted by name so they are enumerated in a stable order
+        it = lower_bound(_values.begin(), _values.end(), name, [](value_type const& element, symbol const& name) { return element.first < name; });
+        _values.emplace(it, name, rvalue_cast(value));
     }
 
-    bool attributes::append(string const& name, values::value value, bool append_duplicates)
+    bool attributes::append(symbol const& name, values::value value, bool append_duplicates)
     {
         values::array new_value = to_array(value);
 
@@ -57,11 +70,12 @@ namespace puppet { namespace runtime {
             return false;
         }
 
+        // Take the existing array before setting the attribute, which may move the stored values and invalidate existing
         values::array existing_value;
-        auto it = _values.find(name);
+        auto it = find(name);
         if (it != _values.end()) {
             // The value is stored locally, so mutate the existing one
-            existing_value = mutate_as<values::array>(*it->second);
+            existing_value = mutate_as<values::array>(it->second);
         } else {
             // Otherwise, it's stored in a parent and cannot be changed; create a copy
             existing_value = *as<values::array>(*existing);
@@ -82,12 +96,12 @@ namespace puppet { namespace runtime {
         return true;
     }
 
-    void attributes::each(function<bool(string const& name, shared_ptr<values::value const> const& value)> const& callback) const
+    void attributes::each(function<bool(symbol const& name, values::value const& value)> const& callback) const
     {
         // Enumerate this collection's values first
         for (auto const& element : _values) {
             // Skip undefined elements as they aren't set
-            if (is_undef(*element.second)) {
+            if (is_undef(element.second)) {
                 continue;
             }
             if (!callback(element.first, element.second)) {
@@ -97,12 +111,37 @@ namespace puppet { namespace runtime {
 
         // Enumerate the parent and call the callback for any attribute not in this collection
         if (_parent) {
-            _parent->each([&](string const& name, shared_ptr<values::value const> const& value) {
-                return _values.count(name) != 0 || callback(name, value);
+            _parent->each([&](symbol const& name, values::value const& value) {
+                return find(name) != _values.end() || callback(name, value);
             });
         }
     }
 
+    void attributes::flatten()
+    {
+        if (_parent) {
+            // Copy the inherited values that are not set or hidden by an undefined value in this collection
+            vector<value_type> inherited;
+            _parent->each([&](symbol const& name, values::value const& value) {
+                if (find(name) == _values.end()) {
+                    inherited.emplace_back(name, value);
+                }
+                return true;
+            });
+            _parent.reset();
+
+            _values.reserve(_values.size() + inherited.size());
+            for (auto& element : inherited) {
+                _values.emplace_back(rvalue_cast(element));
+            }
+            sort(_values.begin(), _values.end(), [](value_type const& left, value_type const& right) { return left.first < right.first; });
+        }
+
+        // Undefined values only hide the parent's values, so they are not needed once the parent is gone
+        _values.erase(remove_if(_values.begin(), _values.end(), [](value_type const& element) { return is_undef(element.second); }), _values.end());
+        _values.shrink_to_fit();
+    }
+
     resource::resource(
         runtime::catalog& catalog,
         types::resource type,
@@ -170,6 +209,26 @@ namespace puppet { namespace runtime {
         _attributes = make_shared<runtime::attributes>(_attributes);
     }
 
+    bool resource::relate(runtime::relationship relationship, resource const& target)
+    {
+        // Key the relationship by the target's vertex and the kind of relationship so that duplicates are found in constant time
+        static const size_t kinds = static_cast<size_t>(runtime::relationship::subscribe) + 1;
+        if (!_related.insert(target.vertex_id() * kinds + static_cast<size_t>(relationship)).second) {
+            return false;
+        }
+        _relationships.emplace_back(relationship, &target);
+        return true;
+    }
+
+    void resource::each_relationship(function<bool(runtime::relationship relationship, resource const& target)> const& callback) const
+    {
+        for (auto const& relationship : _relationships) {
+            if (!callback(relationship.first, *relationship.second)) {
+                return;
+            }
+        }
+    }
+
     bool resource::is_metaparameter(string const& name)
     {
         static const unordered_set<string> metaparameters = {
@@ -198,6 +257,16 @@ namespace puppet { namespace runtime {
         _vertex_id = id;
     }
 
+    template <typename Expression>
+    static void parse_body(shared_ptr<compiler::context> const& context, Expression const& expression)
+    {
+        // Parse the body if its parsing was deferred and fold it like the rest of the syntax tree
+        // The body is folded before it is visible to other nodes sharing the manifest
+        context->parse_body(expression, [&](vector<ast::expression> const& body) {
+            constant_folder::fold(context, body);
+        });
+    }
+
     class_definition::class_definition(types::klass klass, shared_ptr<compiler::context> context, ast::class_definition_expression const& expression) :
         _klass(rvalue_cast(klass)),
         _context(rvalue_cast(context)),
@@ -243,6 +312,8 @@ namespace puppet { namespace runtime {
             return;
         }
 
+        parse_body(_context, *_expression);
+
         // Create a scope for the class
         auto scope = make_shared<runtime::scope>(evaluate_parent(context), &resource);
 
@@ -306,6 +377,8 @@ namespace puppet { namespace runtime {
 
     void defined_type::evaluate(runtime::context& context, runtime::resource& resource)
     {
+        parse_body(_context, _expression);
+
         // Create a temporary scope for evaluating the defined type
         auto scope = make_shared<runtime::scope>(context.node_or_top(), &resource);
 
@@ -338,6 +411,8 @@ namespace puppet { namespace runtime {
 
     void node_definition::evaluate(runtime::context& context)
     {
+        parse_body(_context, _expression);
+
         // Create a new expression evaluator based on the node's compilation context
         expression_evaluator evaluator{ _context, context };
 
@@ -346,6 +421,9 @@ namespace puppet { namespace runtime {
         executor.execute(context.node_scope());
     }
 
+    // The vertex of a slot that does not hold a resource
+    static size_t const empty_slot = static_cast<size_t>(-1);
+
     dependency_graph const& catalog::graph() const
     {
         return _graph;
@@ -353,20 +431,15 @@ namespace puppet { namespace runtime {
 
     resource* catalog::find_resource(types::resource const& resource)
     {
-        if (!resource.fully_qualified()) {
+        if (!resource.fully_qualified() || _resource_index.empty()) {
             return nullptr;
         }
 
-        // Find the resource type and title
-        auto resources = _resources.find(resource.type_name());
-        if (resources == _resources.end()) {
+        auto const& slot = _resource_index[find_slot(resource, boost::hash<types::resource>()(resource))];
+        if (slot.vertex == empty_slot) {
             return nullptr;
         }
-        auto it = resources->second.find(resource.title());
-        if (it == resources->second.end()) {
-            return nullptr;
-        }
-        return &it->second;
+        return &_resources[slot.vertex];
     }
 
     runtime::resource& catalog::add_resource(types::resource type, shared_ptr<string> path, size_t line, shared_ptr<runtime::attributes> attributes, bool exported)
@@ -375,22 +448,77 @@ namespace puppet { namespace runtime {
             throw evaluation_exception("resource name is not fully qualified.");
         }
 
-        string resource_type = type.type_name();
-        string title = type.title();
-
-        auto& resources = _resources[rvalue_cast(resource_type)];
+        // Keep the index at most half full so that probe sequences stay short
+        if ((_resources.size() + 1) * 2 > _resource_index.size()) {
+            grow_index();
+        }
 
-        auto result = resources.emplace(make_pair(rvalue_cast(title), runtime::resource(*this, rvalue_cast(type), rvalue_cast(path), line, rvalue_cast(attributes), exported)));
-        auto& resource = result.first->second;
-        if (!result.second) {
-            throw evaluation_exception((boost::format("resource %1% was previously declared at %2%:%3%.") % type % *resource.path() % resource.line()).str());
+        // The type name is interned, so hashing a resource only reads the title's characters
+        auto hash = boost::hash<types::resource>()(type);
+        auto& slot = _resource_index[find_slot(type, hash)];
+        if (slot.vertex != empty_slot) {
+            auto const& existing = _resources[slot.vertex];
+            throw evaluation_exception((boost::format("resource %1% was previously declared at %2%:%3%.") % type % *existing.path() % existing.line()).str());
         }
 
-        // Add a graph vertex for the resource
-        resource.vertex_id(boost::add_vertex(&resource, _graph));
+        // Resources are only ever appended, so the deque never moves them and the graph can point at them
+        _resources.emplace_back(*this, rvalue_cast(type), rvalue_cast(path), line, rvalue_cast(attributes), exported);
+        auto& resource = _resources.back();
+
+        // Add a graph vertex for the resource; vertices are added in the same order, so the vertex is the resource's index
+        slot.hash = hash;
+        slot.vertex = boost::add_vertex(&resource, _graph);
+        resource.vertex_id(slot.vertex);
         return resource;
     }
 
+    size_t catalog::find_slot(types::resource const& type, size_t hash) const
+    {
+        // Linear probing; the index is never full, so an empty slot is always found
+        auto mask = _resource_index.size() - 1;
+        for (auto i = hash & mask;; i = (i + 1) & mask) {
+            auto const& slot = _resource_index[i];
+            if (slot.vertex == empty_slot) {
+                return i;
+            }
+            if (slot.hash != hash) {
+                continue;
+            }
+            auto const& existing = _resources[slot.vertex].type();
+            if (existing.type_symbol() == type.type_symbol() && existing.title() == type.title()) {
+                return i;
+            }
+        }
+    }
+
+    void catalog::grow_index()
+    {
+        // The index size is always a power of two so slots can be found with a mask
+        vector<resource_slot> index(max<size_t>(_resource_index.size() * 2, 64));
+        auto mask = index.size() - 1;
+        for (auto const& slot : _resource_index) {
+            if (slot.vertex == empty_slot) {
+                continue;
+            }
+            auto i = slot.hash & mask;
+            while (index[i].vertex != empty_slot) {
+                i = (i + 1) & mask;
+            }
+            index[i] = slot;
+        }
+        _resource_index = rvalue_cast(index);
+    }
+
+    void catalog::loader(loader_type loader)
+    {
+        _loader = rvalue_cast(loader);
+    }
+
+    bool catalog::load(string const& name)
+    {
+        return _loader && _loader(*this, name);
+    }
+
     vector<class_definition> const* catalog::find_class(types::klass const& klass)
     {
         auto it = _classes.find(klass);
@@ -431,10 +559,13 @@ namespace puppet { namespace runtime {
             throw evaluation_exception((boost::format("class '%1%' was previously declared at %2%:%3%.") % type.title() % *existing->path() % existing->line()).str(), compilation_context, position);
         }
 
-        // Lookup the class
-        auto it = _classes.find(types::klass(type.title()));
+        // Lookup the class, loading it from a module if it has not been defined
+        types::klass klass(type.title());
+        auto it = _classes.find(klass);
+        if ((it == _classes.end() || it->second.empty()) && load(klass.title())) {
+            it = _classes.find(klass);
+        }
         if (it == _classes.end() || it->second.empty()) {
-            // TODO: search node for class
             throw evaluation_exception((boost::format("cannot declare class '%1%' because it has not been defined.") % type.title()).str(), compilation_context, position);
         }
 
@@ -443,8 +574,13 @@ namespace puppet { namespace runtime {
 
         try {
             // Evaluate all definitions of the class
-            for (auto &definition : it->second) {
+            // Evaluating a definition may load manifests that add definitions and reallocate the vector, so evaluate a copy
+            // and store it back afterwards to mark the definition as evaluated
+            auto& definitions = it->second;
+            for (size_t i = 0; i < definitions.size(); ++i) {
+                auto definition = definitions[i];
                 definition.evaluate(evaluation_context, resource);
+                definitions[i] = rvalue_cast(definition);
             }
         } catch (evaluation_exception const& ex) {
             // If the original exception has context, log an error with full context
@@ -459,7 +595,7 @@ namespace puppet { namespace runtime {
 
     defined_type const* catalog::find_defined_type(string const& type)
     {
-        auto it = _defined_types.find(type);
+        auto it = _defined_types.find(boost::to_lower_copy(type));
         if (it == _defined_types.end()) {
             return nullptr;
         }
@@ -473,7 +609,7 @@ namespace puppet { namespace runtime {
     {
         // Add the defined type
         defined_type defined(type, context, expression);
-        auto result = _defined_types.emplace(make_pair(rvalue_cast(type), rvalue_cast(defined)));
+        auto result = _defined_types.emplace(make_pair(boost::to_lower_copy(type), rvalue_cast(defined)));
         if (!result.second) {
             auto const& existing = result.first->second;
             throw evaluation_exception(
@@ -506,10 +642,13 @@ namespace puppet { namespace runtime {
             throw evaluation_exception((boost::format("defined type '%1%' was previously declared at %2%:%3%.") % type % *existing->path() % existing->line()).str(), compilation_context, position);
         }
 
-        // Lookup the defined type
-        auto it = _defined_types.find(type.title());
+        // Lookup the defined type, loading it from a module if it has not been defined
+        auto name = boost::to_lower_copy(type.type_name());
+        auto it = _defined_types.find(name);
+        if (it == _defined_types.end() && load(name)) {
+            it = _defined_types.find(name);
+        }
         if (it == _defined_types.end()) {
-            // TODO: search node for defined type
             throw evaluation_exception((boost::format("cannot declare defined type %1% because it has not been defined.") % type).str(), compilation_context, position);
         }
 
@@ -645,37 +784,47 @@ namespace puppet { namespace runtime {
 
     void catalog::finalize()
     {
+        static const symbol before_parameter("before");
+        static const symbol notify_parameter("notify");
+        static const symbol require_parameter("require");
+        static const symbol subscribe_parameter("subscribe");
+
+        for (auto& resource : _resources) {
+            // No more attributes are set once the catalog is finalized, so stop inheriting from resource defaults
+            resource.attributes().flatten();
+
+            // The relationship metaparameters are now final, so relate the resource to their targets like the relationship operators do
+            // They cannot be related when set because a target may be declared later and a resource override may replace them
+            relate_metaparameter(resource, before_parameter, runtime::relationship::before);
+            relate_metaparameter(resource, notify_parameter, runtime::relationship::notify);
+            relate_metaparameter(resource, require_parameter, runtime::relationship::require);
+            relate_metaparameter(resource, subscribe_parameter, runtime::relationship::subscribe);
+        }
+
         // Populate the dependency graph
         populate_graph();
     }
 
     void catalog::populate_graph()
     {
-        string before_parameter = "before";
-        string notify_parameter = "notify";
-        string require_parameter = "require";
-        string subscribe_parameter = "subscribe";
-
-        // Loop through each resource and add relationships
-        for (auto const& types_pair : _resources) {
-            for (auto const& resource_pair : types_pair.second) {
-                auto const& source = resource_pair.second;
-
-                // Proccess the relationship metaparameters for the resource
-                process_relationship_parameter(source, before_parameter, runtime::relationship::before);
-                process_relationship_parameter(source, notify_parameter, runtime::relationship::notify);
-                process_relationship_parameter(source, require_parameter, runtime::relationship::require);
-                process_relationship_parameter(source, subscribe_parameter, runtime::relationship::subscribe);
+        // Add an edge for each relationship of each resource; the metaparameters were related when the catalog was finalized
+        for (auto const& source : _resources) {
+            source.each_relationship([&](runtime::relationship relationship, resource const& target) {
+                add_relationship(relationship, source, target);
+                return true;
+            });
 
-                // TODO: handle containment
-            }
+            // TODO: handle containment
         }
 
+        // The edge set is only needed while populating the graph
+        _edges = unordered_set<size_t>();
+
         // Finally, detect any cycles
         detect_cycles();
     }
 
-    void catalog::process_relationship_parameter(resource const& source, string const& name, runtime::relationship relationship)
+    void catalog::relate_metaparameter(resource& source, symbol const& name, runtime::relationship relationship)
     {
         auto parameter = source.attributes().get(name);
         if (!parameter) {
@@ -704,8 +853,8 @@ namespace puppet { namespace runtime {
                      target_resource).str());
             }
 
-            // Add the relationship
-            add_relationship(relationship, source, *target);
+            // Add the relationship; any duplicates are ignored
+            source.relate(relationship, *target);
         }, [&](string const& message) {
             throw evaluation_exception(
                 (boost::format("resource %1% (declared at %2%:%3%) cannot form a '%4%' relationship: %5%") %
@@ -729,46 +878,182 @@ namespace puppet { namespace runtime {
         }
 
         // Add the edge to the graph if it doesn't already exist
-        if (!boost::edge(source_ptr->vertex_id(), target_ptr->vertex_id(), _graph).second) {
+        // Finding an edge in the graph scans the source's out-edges, so check the hashed edge set instead
+        if (_edges.insert(source_ptr->vertex_id() * boost::num_vertices(_graph) + target_ptr->vertex_id()).second) {
             boost::add_edge(source_ptr->vertex_id(), target_ptr->vertex_id(), relationship, _graph);
         }
     }
 
-    struct cycle_visitor
+    static string reference(resource const& resource)
     {
-        explicit cycle_visitor(vector<string>& cycles) :
-            _cycles(cycles)
-        {
-        }
+        ostringstream ss;
+        ss << resource.type();
+        return ss.str();
+    }
+
+    void catalog::write(ostream& out, string const& node, string const& environment) const
+    {
+        out << "{\n  \"name\": ";
+        write_json(out, node);
+        out << ",\n  \"environment\": ";
+        write_json(out, environment);
+
+        // Graph vertices are in the order the resources were added, which keeps the output stable
+        out << ",\n  \"resources\": [";
+        vector<string> classes;
+        bool first = true;
+        auto vertices = boost::vertices(_graph);
+        for (auto it = vertices.first; it != vertices.second; ++it) {
+            auto const& resource = *_graph[*it];
+            auto const& type = resource.type();
+            if (type.is_class()) {
+                classes.push_back(type.title());
+            }
+
+            out << (first ? "\n    {" : ",\n    {");
+            first = false;
+            out << "\n      \"type\": ";
+            write_json(out, type.type_name());
+            out << ",\n      \"title\": ";
+            write_json(out, type.title());
+            if (resource.path()) {
+                out << ",\n      \"file\": ";
+                write_json(out, *resource.path());
+                out << ",\n      \"line\": " << resource.line();
+            }
+            out << ",\n      \"exported\": " << (resource.exported() ? "true" : "false");
 
-        template <typename Path, typename Graph>
-        void cycle(Path const& path, Graph const& graph)
-        {
-            ostringstream cycle;
-            bool first = true;
-            for (auto const& id : path) {
-                if (first) {
-                    first = false;
-                } else {
-                    cycle << " => ";
+            // Inherited attributes are enumerated after the resource's own, so sort the parameters by name
+            vector<pair<string, value const*>> parameters;
+            resource.attributes().each([&](symbol const& name, value const& value) {
+                parameters.emplace_back(name.str(), &value);
+                return true;
+            });
+            if (!parameters.empty()) {
+                sort(parameters.begin(), parameters.end(), [](pair<string, value const*> const& left, pair<string, value const*> const& right) {
+                    return left.first < right.first;
+                });
+                out << ",\n      \"parameters\": {";
+                bool first_parameter = true;
+                for (auto const& parameter : parameters) {
+                    out << (first_parameter ? "\n        " : ",\n        ");
+                    first_parameter = false;
+                    write_json(out, parameter.first);
+                    out << ": ";
+                    write_json(out, *parameter.second);
                 }
-                auto resource = graph[id];
-                cycle << resource->type() << " declared at " << *resource->path() << ":" << resource->line();
+                out << "\n      }";
             }
-            // Append on the first vertex again to complete the cycle
-            auto resource = graph[path.front()];
-            cycle << " => " << resource->type();
-            _cycles.push_back(cycle.str());
+            out << "\n    }";
+        }
+        out << (first ? "]" : "\n  ]");
+
+        out << ",\n  \"edges\": [";
+        first = true;
+        auto edges = boost::edges(_graph);
+        for (auto it = edges.first; it != edges.second; ++it) {
+            out << (first ? "\n    {" : ",\n    {");
+            first = false;
+            out << " \"source\": ";
+            write_json(out, reference(*_graph[boost::source(*it, _graph)]));
+            out << ", \"target\": ";
+            write_json(out, reference(*_graph[boost::target(*it, _graph)]));
+            out << " }";
+        }
+        out << (first ? "]" : "\n  ]");
+
+        out << ",\n  \"classes\": [";
+        first = true;
+        for (auto const& klass : classes) {
+            out << (first ? "\n    " : ",\n    ");
+            first = false;
+            write_json(out, klass);
         }
+        out << (first ? "]" : "\n  ]");
+        out << "\n}\n";
+    }
 
-        vector<string>& _cycles;
-    };
+    static string describe_cycle(dependency_graph const& graph, vector<dependency_graph::vertex_descriptor> const& path)
+    {
+        ostringstream cycle;
+        bool first = true;
+        for (auto const& id : path) {
+            if (first) {
+                first = false;
+            } else {
+                cycle << " => ";
+            }
+            auto resource = graph[id];
+            cycle << resource->type() << " declared at " << *resource->path() << ":" << resource->line();
+        }
+        // Append on the first vertex again to complete the cycle
+        auto resource = graph[path.front()];
+        cycle << " => " << resource->type();
+        return cycle.str();
+    }
 
     void catalog::detect_cycles()
     {
-        // Check for cycles in the graph
+        using vertex = dependency_graph::vertex_descriptor;
+
+        // Every cycle lies within a strongly connected component, so finding the components is enough to know the graph is acyclic
+        // Unlike enumerating every cycle, this takes linear time no matter how tangled the dependencies are
+        auto count = boost::num_vertices(_graph);
+        vector<size_t> components(count);
+        auto component_count = boost::strong_components(_graph, boost::make_iterator_property_map(components.begin(), boost::get(boost::vertex_index, _graph)));
+
+        // Report one cycle per component; a component of one resource only has a cycle if the resource depends on itself
+        vector<bool> reported(component_count);
         vector<string> cycles;
-        boost::tiernan_all_cycles(_graph, cycle_visitor(cycles));
+        vector<vertex> parents(count);
+        vector<bool> visited(count);
+        vector<vertex> queue;
+        for (vertex root = 0; root < count; ++root) {
+            auto component = components[root];
+            if (reported[component]) {
+                continue;
+            }
+
+            // Search breadth-first from the component's first resource for the shortest path back to it
+            // The search stays within the component, so the total work over all components is still linear
+            bool found = false;
+            vertex last = root;
+            queue.assign(1, root);
+            visited[root] = true;
+            for (size_t next = 0; next < queue.size() && !found; ++next) {
+                auto current = queue[next];
+                for (auto edges = boost::out_edges(current, _graph); edges.first != edges.second; ++edges.first) {
+                    auto target = boost::target(*edges.first, _graph);
+                    if (target == root) {
+                        found = true;
+                        last = current;
+                        break;
+                    }
+                    if (components[target] != component || visited[target]) {
+                        continue;
+                    }
+                    visited[target] = true;
+                    parents[target] = current;
+                    queue.push_back(target);
+                }
+            }
+            for (auto v : queue) {
+                visited[v] = false;
+            }
+
+            reported[component] = true;
+            if (!found) {
+                continue;
+            }
+
+            vector<vertex> path;
+            for (auto v = last; v != root; v = parents[v]) {
+                path.push_back(v);
+            }
+            path.push_back(root);
+            reverse(path.begin(), path.end());
+            cycles.push_back(describe_cycle(_graph, path));
+        }
         if (cycles.empty()) {
             return;
         }
@@ -0,0 +1,390 @@
+#include <puppet/runtime/constant_folder.hpp>
+#include <puppet/runtime/expression_evaluator.hpp>
+#include <puppet/compiler/context.hpp>
+#include <puppet/ast/constant.hpp>
+#include <puppet/ast/expression_def.hpp>
+#include <puppet/ast/interpolated_string.hpp>
+#include <puppet/cast.hpp>
+
+using namespace std;
+
+namespace puppet { namespace runtime {
+
+    /**
+     * This utility type is responsible for folding the constant expressions of the AST.
+     * Each operator returns whether or not the visited expression is constant.
+     * Expressions are folded from the leaves up, so evaluating a constant uses the already folded constants beneath it.
+     */
+    struct folding_visitor : boost::static_visitor<bool>
+    {
+        explicit folding_visitor(expression_evaluator& evaluator) :
+            _evaluator(evaluator)
+        {
+        }
+
+        result_type operator()(ast::basic_expression const& expr)
+        {
+            return boost::apply_visitor(*this, expr);
+        }
+
+        result_type operator()(ast::catalog_expression const& expr)
+        {
+            boost::apply_visitor(*this, expr);
+            return false;
+        }
+
+        result_type operator()(ast::control_flow_expression const& expr)
+        {
+            boost::apply_visitor(*this, expr);
+            return false;
+        }
+
+        result_type operator()(ast::unary_expression const& expr)
+        {
+            // All unary operators are pure
+            return boost::apply_visitor(*this, expr.operand());
+        }
+
+        result_type operator()(ast::postfix_expression const& expr)
+        {
+            // Only access expressions on a constant are constant
+            bool constant = boost::apply_visitor(*this, expr.primary());
+            for (auto const& subexpression : expr.subexpressions()) {
+                constant = boost::apply_visitor(*this, subexpression) && constant;
+            }
+            return constant;
+        }
+
+        result_type operator()(ast::expression const& expr)
+        {
+            bool constant = boost::apply_visitor(*this, expr.primary());
+
+            for (auto const& binary : expr.binary()) {
+                if (boost::apply_visitor(*this, binary.operand())) {
+                    try {
+                        binary.fold(make_shared<ast::constant>(_evaluator.evaluate(binary.operand())));
+                    } catch (evaluation_exception const&) {
+                        constant = false;
+                        continue;
+                    }
+                    constant = constant && is_pure(binary.op());
+                } else {
+                    constant = false;
+                }
+            }
+
+            if (!constant || expr.blank()) {
+                return false;
+            }
+
+            try {
+                expr.fold(make_shared<ast::constant>(_evaluator.evaluate(expr)));
+            } catch (evaluation_exception const&) {
+                // Leave the expression to report the failure when it is evaluated
+                return false;
+            }
+            return true;
+        }
+
+        result_type operator()(ast::case_expression const& expr)
+        {
+            operator()(expr.expression());
+
+            for (auto const& proposition : expr.propositions()) {
+                fold(proposition.options());
+                fold(proposition.body());
+            }
+            return false;
+        }
+
+        result_type operator()(ast::if_expression const& expr)
+        {
+            operator()(expr.conditional());
+            fold(expr.body());
+
+            if (expr.elsifs()) {
+                for (auto const& elsif : *expr.elsifs()) {
+                    operator()(elsif.conditional());
+                    fold(elsif.body());
+                }
+            }
+
+            if (expr.else_()) {
+                fold(expr.else_()->body());
+            }
+            return false;
+        }
+
+        result_type operator()(ast::unless_expression const& expr)
+        {
+            operator()(expr.conditional());
+            fold(expr.body());
+
+            if (expr.else_()) {
+                fold(expr.else_()->body());
+            }
+            return false;
+        }
+
+        result_type operator()(ast::function_call_expression const& expr)
+        {
+            fold(expr.arguments());
+            if (expr.lambda()) {
+                operator()(*expr.lambda());
+            }
+            return false;
+        }
+
+        result_type operator()(ast::selector_expression const& expr)
+        {
+            for (auto const& case_ : expr.cases()) {
+                operator()(case_.selector());
+                operator()(case_.result());
+            }
+            return false;
+        }
+
+        result_type operator()(ast::access_expression const& expr)
+        {
+            return fold(expr.arguments());
+        }
+
+        result_type operator()(ast::method_call_expression const& expr)
+        {
+            fold(expr.arguments());
+            if (expr.lambda()) {
+                operator()(*expr.lambda());
+            }
+            return false;
+        }
+
+        result_type operator()(ast::lambda const& lambda)
+        {
+            fold(lambda.parameters());
+            fold(lambda.body());
+            return false;
+        }
+
+        result_type operator()(boost::blank const&)
+        {
+            return false;
+        }
+
+        result_type operator()(ast::undef const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::defaulted const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::boolean const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::number const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::regex const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::variable const&)
+        {
+            return false;
+        }
+
+        result_type operator()(ast::name const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::bare_word const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::type const&)
+        {
+            return true;
+        }
+
+        result_type operator()(ast::string const& str)
+        {
+            // Strings with warnings are not folded so that the warnings are reported when evaluated
+            auto& compiled = str.compiled();
+            if (!compiled || !compiled->warnings().empty()) {
+                return false;
+            }
+
+            // The string is constant if all of its interpolations are constant
+            bool constant = true;
+            for (auto const& segment : compiled->segments()) {
+                if (auto expressions = boost::get<vector<ast::expression>>(&segment)) {
+                    constant = fold(*expressions) && constant;
+                }
+            }
+            return constant;
+        }
+
+        result_type operator()(ast::array const& array)
+        {
+            return fold(array.elements());
+        }
+
+        result_type operator()(ast::hash const& hash)
+        {
+            bool constant = true;
+            if (hash.elements()) {
+                for (auto const& pair : *hash.elements()) {
+                    constant = operator()(pair.first) && constant;
+                    constant = operator()(pair.second) && constant;
+                }
+            }
+            return constant;
+        }
+
+        result_type operator()(ast::resource_expression const& expr)
+        {
+            boost::apply_visitor(*this, expr.type());
+
+            for (auto const& body : expr.bodies()) {
+                operator()(body.title());
+                fold(body.attributes());
+            }
+            return false;
+        }
+
+        result_type operator()(ast::resource_override_expression const& expr)
+        {
+            boost::apply_visitor(*this, expr.reference());
+            fold(expr.attributes());
+            return false;
+        }
+
+        result_type operator()(ast::resource_defaults_expression const& expr)
+        {
+            fold(expr.attributes());
+            return false;
+        }
+
+        result_type operator()(ast::class_definition_expression const& expr)
+        {
+            fold(expr.parameters());
+            fold(expr.body());
+            return false;
+        }
+
+        result_type operator()(ast::defined_type_expression const& expr)
+        {
+            fold(expr.parameters());
+            fold(expr.body());
+            return false;
+        }
+
+        result_type operator()(ast::node_definition_expression const& expr)
+        {
+            fold(expr.body());
+            return false;
+        }
+
+        result_type operator()(ast::collection_expression const& expr)
+        {
+            if (expr.first()) {
+                boost::apply_visitor(*this, expr.first()->value());
+            }
+            for (auto const& binary : expr.remainder()) {
+                boost::apply_visitor(*this, binary.operand().value());
+            }
+            return false;
+        }
+
+        bool fold(vector<ast::expression> const& expressions)
+        {
+            bool constant = true;
+            for (auto const& expression : expressions) {
+                constant = operator()(expression) && constant;
+            }
+            return constant;
+        }
+
+        bool fold(vector<ast::attribute_expression> const& attributes)
+        {
+            for (auto const& attribute : attributes) {
+                operator()(attribute.value());
+            }
+            return false;
+        }
+
+        bool fold(vector<ast::parameter> const& parameters)
+        {
+            for (auto const& parameter : parameters) {
+                if (parameter.type()) {
+                    boost::apply_visitor(*this, *parameter.type());
+                }
+                if (parameter.default_value()) {
+                    operator()(*parameter.default_value());
+                }
+            }
+            return false;
+        }
+
+        template <typename T>
+        bool fold(boost::optional<T> const& optional)
+        {
+            return !optional || fold(*optional);
+        }
+
+     private:
+        static bool is_pure(ast::binary_operator op)
+        {
+            // Operators that assign, set match variables, or add relationships are not pure
+            switch (op) {
+                case ast::binary_operator::in:
+                case ast::binary_operator::match:
+                case ast::binary_operator::not_match:
+                case ast::binary_operator::assignment:
+                case ast::binary_operator::in_edge:
+                case ast::binary_operator::in_edge_subscribe:
+                case ast::binary_operator::out_edge:
+                case ast::binary_operator::out_edge_subscribe:
+                    return false;
+
+                default:
+                    return true;
+            }
+        }
+
+        expression_evaluator& _evaluator;
+    };
+
+    void constant_folder::fold(shared_ptr<compiler::context> const& context)
+    {
+        if (!context) {
+            return;
+        }
+
+        auto& tree = context->tree();
+        if (!tree.body()) {
+            return;
+        }
+        fold(context, *tree.body());
+    }
+
+    void constant_folder::fold(shared_ptr<compiler::context> const& context, vector<ast::expression> const& expressions)
+    {
+        // Constants are evaluated in an empty evaluation context; they do not depend on scope
+        runtime::context evaluation_context;
+        expression_evaluator evaluator{ context, evaluation_context };
+
+        folding_visitor visitor(evaluator);
+        visitor.fold(expressions);
+    }
+
+}}  // namespace puppet::runtime
@@ -1,5 +1,7 @@
 #include <puppet/runtime/context.hpp>
 #include <puppet/runtime/expression_evaluator.hpp>
+#include <puppet/runtime/vm/program.hpp>
+#include <puppet/compiler/manifest.hpp>
 #include <puppet/cast.hpp>
 #include <boost/format.hpp>
 
@@ -50,8 +52,9 @@ namespace puppet { namespace runtime {
         _context._node_scope.reset();
     }
 
-    context::context(shared_ptr<facts::provider> facts, runtime::catalog* catalog) :
-        _catalog(catalog)
+    context::context(shared_ptr<facts::provider> facts, runtime::catalog* catalog, runtime::engine engine) :
+        _catalog(catalog),
+        _engine(engine)
     {
         // Get the "main" resource if given a catalog
         runtime::resource* main = _catalog ? _catalog->find_resource(types::resource("class", "main")) : nullptr;
@@ -70,6 +73,29 @@ namespace puppet { namespace runtime {
         return _catalog;
     }
 
+    runtime::engine context::engine() const
+    {
+        return _engine;
+    }
+
+    vm::program const& context::program(compiler::manifest& manifest, vector<ast::expression> const& body, bool top_level)
+    {
+        auto& program = _programs[&body];
+        if (!program) {
+            program = &manifest.program(body, top_level);
+        }
+        return *program;
+    }
+
+    vm::program const& context::program(compiler::manifest& manifest, ast::lambda const& lambda)
+    {
+        auto& program = _programs[&lambda];
+        if (!program) {
+            program = &manifest.program(lambda);
+        }
+        return *program;
+    }
+
     shared_ptr<runtime::scope> const& context::current_scope()
     {
         return _scope_stack.back();
@@ -139,7 +165,7 @@ namespace puppet { namespace runtime {
         // Look for the last :: delimiter; if not found, use the current scope
         auto pos = name.rfind("::");
         if (pos == string::npos) {
-            auto variable = current_scope()->get(name);
+            auto variable = current_scope()->get(symbol(name));
             return variable ? variable->value() : nullptr;
         }
 
@@ -151,14 +177,14 @@ namespace puppet { namespace runtime {
 
         // An empty namespace is the top scope
         if (ns.empty()) {
-            auto variable = top_scope()->get(var);
+            auto variable = top_scope()->get(symbol(var));
             return variable ? variable->value() : nullptr;
         }
 
         // Lookup the namespace
         auto scope = find_scope(ns);
         if (scope) {
-            auto variable = scope->get(var);
+            auto variable = scope->get(symbol(var));
             return variable ? variable->value() : nullptr;
         }
 
@@ -179,6 +205,16 @@ namespace puppet { namespace runtime {
         return nullptr;
     }
 
+    shared_ptr<value const> context::lookup(symbol const& name, expression_evaluator* evaluator, lexer::position const* position)
+    {
+        // Only qualified names need to be split into a namespace and a variable name
+        if (name.str().find(':') != string::npos) {
+            return lookup(name.str(), evaluator, position);
+        }
+        auto variable = current_scope()->get(name);
+        return variable ? variable->value() : nullptr;
+    }
+
     shared_ptr<value const> context::lookup(size_t index) const
     {
         // Walk the match scope stack for a non-null set of matches
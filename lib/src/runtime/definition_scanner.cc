@@ -17,8 +17,8 @@ namespace puppet { namespace runtime {
      */
     struct scanning_visitor : boost::static_visitor<void>
     {
-        scanning_visitor(runtime::catalog& catalog, shared_ptr<compiler::context> const& context) :
-            _catalog(catalog),
+        scanning_visitor(runtime::definitions& definitions, shared_ptr<compiler::context> const& context) :
+            _definitions(definitions),
             _context(context)
         {
             // Push a "top level" scope
@@ -305,34 +305,7 @@ namespace puppet { namespace runtime {
         result_type operator()(ast::class_definition_expression const& expr)
         {
             // Validate the class name
-            types::klass klass(validate_name(true, expr.name()));
-
-            // Check to see if this class's parent matches existing definitions
-            if (expr.parent()) {
-                auto definitions = _catalog.find_class(klass);
-                if (definitions) {
-                    types::klass parent(expr.parent()->value());
-                    for (auto const& definition : *definitions) {
-                        auto existing = definition.parent();
-                        if (!existing) {
-                            continue;
-                        }
-                        if (parent == *existing) {
-                            continue;
-                        }
-                        throw evaluation_exception(
-                            (boost::format("class '%1%' cannot inherit from '%2%' because the class already inherits from '%3%' at %4%:%5%.") %
-                             klass.title() %
-                             expr.parent()->value() %
-                             existing->title() %
-                             *definition.path() %
-                             definition.line()
-                            ).str(),
-                            _context,
-                            expr.parent()->position());
-                    }
-                }
-            }
+            auto name = validate_name(true, expr.name());
 
             // Validate the class parameters
             if (expr.parameters()) {
@@ -340,7 +313,7 @@ namespace puppet { namespace runtime {
             }
 
             // Push back the class definition
-            _catalog.define_class(klass, _context, expr);
+            _definitions.add(rvalue_cast(name), &expr);
 
             // Scan the parameters
             if (expr.parameters()) {
@@ -376,7 +349,7 @@ namespace puppet { namespace runtime {
             }
 
             // Add the defined type
-            _catalog.define_type(validate_name(false, expr.name()), _context, expr);
+            _definitions.add(validate_name(false, expr.name()), &expr);
 
             // Defined types have no class scope
             class_scope scope(_scopes, {});
@@ -407,8 +380,8 @@ namespace puppet { namespace runtime {
                 throw evaluation_exception("node definitions can only be defined at top-level or inside a class.", _context, expr.position());
             }
 
-            // Define the node in the catalog
-            _catalog.define_node(_context, expr);
+            // Push back the node definition
+            _definitions.add({}, &expr);
 
             // Node definitions have no class scope
             class_scope scope(_scopes, {});
@@ -483,20 +456,6 @@ namespace puppet { namespace runtime {
             if (qualified_name == "main" || qualified_name == "settings") {
                 throw evaluation_exception((boost::format("'%1%' is the name of a built-in class and cannot be used.") % qualified_name).str(), _context, name.position());
             }
-
-            // Check for conflicts between defined types and classes
-            if (is_class) {
-                auto type = _catalog.find_defined_type(qualified_name);
-                if (type) {
-                    throw evaluation_exception((boost::format("'%1%' was previously defined as a defined type at %2%:%3%.") % qualified_name % *type->path() % type->line()).str(), _context, name.position());
-                }
-            } else {
-                auto definitions = _catalog.find_class(types::klass(qualified_name));
-                if (definitions) {
-                    auto& first = definitions->front();
-                    throw evaluation_exception((boost::format("'%1%' was previously defined as a class at %2%:%3%.") % qualified_name % *first.path() % first.line()).str(), _context, name.position());
-                }
-            }
             return qualified_name;
         }
 
@@ -539,11 +498,96 @@ namespace puppet { namespace runtime {
             deque<string>& _scopes;
         };
 
-        runtime::catalog& _catalog;
+        runtime::definitions& _definitions;
         shared_ptr<compiler::context> const& _context;
         deque<string> _scopes;
     };
 
+    /**
+     * This utility type is responsible for adding definitions to the catalog.
+     * Definitions from different manifests may conflict, so they are checked against the catalog as they are added.
+     */
+    struct defining_visitor : boost::static_visitor<void>
+    {
+        defining_visitor(runtime::catalog& catalog, shared_ptr<compiler::context> const& context, string const& name) :
+            _catalog(catalog),
+            _context(context),
+            _name(name)
+        {
+        }
+
+        result_type operator()(ast::class_definition_expression const* expr)
+        {
+            // Check for conflicts with defined types
+            auto type = _catalog.find_defined_type(_name);
+            if (type) {
+                throw evaluation_exception((boost::format("'%1%' was previously defined as a defined type at %2%:%3%.") % _name % *type->path() % type->line()).str(), _context, expr->name().position());
+            }
+
+            // Check to see if this class's parent matches existing definitions
+            types::klass klass(_name);
+            if (expr->parent()) {
+                auto definitions = _catalog.find_class(klass);
+                if (definitions) {
+                    types::klass parent(expr->parent()->value());
+                    for (auto const& definition : *definitions) {
+                        auto existing = definition.parent();
+                        if (!existing) {
+                            continue;
+                        }
+                        if (parent == *existing) {
+                            continue;
+                        }
+                        throw evaluation_exception(
+                            (boost::format("class '%1%' cannot inherit from '%2%' because the class already inherits from '%3%' at %4%:%5%.") %
+                             klass.title() %
+                             expr->parent()->value() %
+                             existing->title() %
+                             *definition.path() %
+                             definition.line()
+                            ).str(),
+                            _context,
+                            expr->parent()->position());
+                    }
+                }
+            }
+
+            _catalog.define_class(rvalue_cast(klass), _context, *expr);
+        }
+
+        result_type operator()(ast::defined_type_expression const* expr)
+        {
+            // Check for conflicts with classes
+            auto definitions = _catalog.find_class(types::klass(_name));
+            if (definitions) {
+                auto& first = definitions->front();
+                throw evaluation_exception((boost::format("'%1%' was previously defined as a class at %2%:%3%.") % _name % *first.path() % first.line()).str(), _context, expr->name().position());
+            }
+
+            _catalog.define_type(_name, _context, *expr);
+        }
+
+        result_type operator()(ast::node_definition_expression const* expr)
+        {
+            _catalog.define_node(_context, *expr);
+        }
+
+     private:
+        runtime::catalog& _catalog;
+        shared_ptr<compiler::context> const& _context;
+        string const& _name;
+    };
+
+    void definitions::add(string name, expression_type expression)
+    {
+        _values.emplace_back(rvalue_cast(name), rvalue_cast(expression));
+    }
+
+    vector<definitions::value_type> const& definitions::values() const
+    {
+        return _values;
+    }
+
     definition_scanner::definition_scanner(runtime::catalog& catalog) :
         _catalog(catalog)
     {
@@ -555,15 +599,39 @@ namespace puppet { namespace runtime {
             return;
         }
 
+        // Manifests shared by the environment are scanned once when they are loaded
+        if (auto const& definitions = context->manifest()->definitions()) {
+            define(context, *definitions);
+            return;
+        }
+        define(context, find(context));
+    }
+
+    runtime::definitions definition_scanner::find(shared_ptr<compiler::context> const& context)
+    {
+        runtime::definitions definitions;
+        if (!context) {
+            return definitions;
+        }
+
         auto& tree = context->tree();
         if (!tree.body()) {
-            return;
+            return definitions;
         }
 
-        scanning_visitor visitor(_catalog, context);
+        scanning_visitor visitor(definitions, context);
         for (auto const& expression : *tree.body()) {
             visitor(expression);
         }
+        return definitions;
+    }
+
+    void definition_scanner::define(shared_ptr<compiler::context> const& context, runtime::definitions const& definitions)
+    {
+        for (auto const& definition : definitions.values()) {
+            defining_visitor visitor(_catalog, context, definition.first);
+            boost::apply_visitor(visitor, definition.second);
+        }
     }
 
 }}  // namespace puppet::runtime
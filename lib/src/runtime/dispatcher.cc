@@ -19,7 +19,7 @@ namespace puppet { namespace runtime {
 
     static optional<vector<ast::parameter>> const& lambda_parameters(optional<ast::lambda> const& lambda)
     {
-        static optional<vector<ast::parameter>> none;
+        static optional<vector<ast::parameter>> const none;
         if (!lambda) {
             return none;
         }
@@ -28,7 +28,7 @@ namespace puppet { namespace runtime {
 
     static optional<vector<ast::expression>> const& lamda_body(optional<ast::lambda> const& lambda)
     {
-        static optional<vector<ast::expression>> none;
+        static optional<vector<ast::expression>> const none;
         if (!lambda) {
             return none;
         }
@@ -47,7 +47,7 @@ namespace puppet { namespace runtime {
             _evaluator(evaluator),
             _name(name),
             _position(position),
-            _lambda(evaluator, _position, lambda_parameters(lambda), lamda_body(lambda)),
+            _lambda(evaluator, _position, lambda_parameters(lambda), lamda_body(lambda), lambda ? &*lambda : nullptr),
             _lambda_given(lambda)
     {
         _arguments.reserve((arguments ? arguments->size() : 0) + (first_value ? 1 : 0));
@@ -167,6 +167,8 @@ namespace puppet { namespace runtime {
         _position(position)
     {
         // Keep in alphabetical order
+        // The table is never modified after initialization and the functions are stateless, so nodes compiled on
+        // different threads can share it
         static const unordered_map<string, function_type> functions {
             { "alert",          functions::logging_function(logging::level::alert) },
             { "assert_type",    functions::assert_type() },
@@ -53,7 +53,7 @@ namespace puppet { namespace runtime { namespace evaluators {
     basic_expression_evaluator::result_type basic_expression_evaluator::operator()(ast::string const& str)
     {
         string_interpolator interpolator(_evaluator);
-        return interpolator.interpolate(str.position(), str.value(), str.escapes(), str.quote(), str.interpolated(), str.margin(), str.remove_break());
+        return interpolator.interpolate(str);
     }
 
     basic_expression_evaluator::result_type basic_expression_evaluator::operator()(ast::regex const& regx)
@@ -79,9 +79,9 @@ namespace puppet { namespace runtime { namespace evaluators {
         if (isdigit(name[0])) {
             value = context.lookup(stoi(name));
         } else {
-            value = context.lookup(name, &_evaluator, &var.position());
+            value = context.lookup(var.symbol(), &_evaluator, &var.position());
         }
-        return values::variable(name, rvalue_cast(value));
+        return values::variable(var.symbol(), rvalue_cast(value));
     }
 
     basic_expression_evaluator::result_type basic_expression_evaluator::operator()(ast::name const& name)
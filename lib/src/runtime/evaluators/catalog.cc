@@ -60,12 +60,11 @@ namespace puppet { namespace runtime { namespace evaluators {
         }
 
         // TODO: check for known type
-        // TODO: if not a known type and not a "class" resource, load the defined type
         // TODO: if type still unknown, raise an error
         auto& evaluation_context = _evaluator.evaluation_context();
         auto& compilation_context = _evaluator.compilation_context();
         auto catalog = evaluation_context.catalog();
-        bool is_defined_type = !is_class && catalog->find_defined_type(type_name);
+        bool is_defined_type = !is_class && (catalog->find_defined_type(type_name) || (catalog->load(type_name) && catalog->find_defined_type(type_name)));
 
         // Evaluate the default attributes
         auto default_body = find_default_body(expr);
@@ -183,19 +182,19 @@ namespace puppet { namespace runtime { namespace evaluators {
                     auto& attributes = resource.attributes();
 
                     if (attribute.op() == ast::attribute_operator::assignment) {
-                        if (!override && attributes.get(name.value())) {
+                        if (!override && attributes.get(name.symbol())) {
                             if (is_undef(value)) {
                                 throw _evaluator.create_exception(name.position(), (boost::format("cannot remove attribute '%1%' from resource %2%.") % name % resource.type()).str());
                             }
                             throw _evaluator.create_exception(name.position(), (boost::format("attribute '%1%' has already been set for resource %2%.") % name % resource.type()).str());
                         }
                         // Set the parameter in the resource
-                        attributes.set(name.value(), rvalue_cast(value));
+                        attributes.set(name.symbol(), rvalue_cast(value));
                     } else if (attribute.op() == ast::attribute_operator::append) {
-                        if (!override && attributes.get(name.value())) {
+                        if (!override && attributes.get(name.symbol())) {
                             throw _evaluator.create_exception(name.position(), (boost::format("attribute '%1%' has already been set for resource %2% and cannot be appended to.") % name % resource.type()).str());
                         }
-                        if (!attributes.append(name.value(), rvalue_cast(value))) {
+                        if (!attributes.append(name.symbol(), rvalue_cast(value))) {
                             throw _evaluator.create_exception(name.position(), (boost::format("attribute '%1%' is not an array.") % name).str());
                         }
                     } else {
@@ -273,12 +272,12 @@ namespace puppet { namespace runtime { namespace evaluators {
                 }
 
                 // Ensure the value doesn't exist locally on the attributes collection
-                if (attributes->get(attribute.name().value(), false)) {
+                if (attributes->get(attribute.name().symbol(), false)) {
                     throw _evaluator.create_exception(attribute.position(), (boost::format("attribute '%1%' already exists in this resource body.") % attribute.name()).str());
                 }
 
                 // Set the attribute
-                attributes->set(attribute.name().value(), evaluate_attribute(attribute));
+                attributes->set(attribute.name().symbol(), evaluate_attribute(attribute));
             }
         }
         return attributes;
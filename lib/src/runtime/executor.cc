@@ -1,4 +1,5 @@
 #include <puppet/runtime/executor.hpp>
+#include <puppet/runtime/vm/machine.hpp>
 #include <puppet/cast.hpp>
 #include <boost/format.hpp>
 
@@ -42,11 +43,13 @@ namespace puppet { namespace runtime {
         return _name;
     }
 
-    executor::executor(expression_evaluator& evaluator, lexer::position const& position, optional<vector<ast::parameter>> const& parameters, optional<vector<ast::expression>> const& body) :
+    executor::executor(expression_evaluator& evaluator, lexer::position const& position, optional<vector<ast::parameter>> const& parameters, optional<vector<ast::expression>> const& body, ast::lambda const* lambda) :
         _evaluator(evaluator),
         _position(position),
         _parameters(parameters),
-        _body(body)
+        _body(body),
+        _lambda(lambda),
+        _program(nullptr)
     {
     }
 
@@ -79,9 +82,13 @@ namespace puppet { namespace runtime {
 
     value executor::execute(values::array& arguments, shared_ptr<runtime::scope> const& scope) const
     {
+        // A lambda's program binds its variables to slots, so it can only be executed in an ephemeral scope created for it
+        auto program = _lambda && scope ? nullptr : this->program();
+
         // Create the execution scope
-        auto local_scope = _evaluator.evaluation_context().create_local_scope(scope);
-        auto& current_scope = _evaluator.evaluation_context().current_scope();
+        auto& context = _evaluator.evaluation_context();
+        auto local_scope = context.create_local_scope(program && _lambda ? make_shared<runtime::scope>(context.current_scope(), program->slots()) : scope);
+        auto& current_scope = context.current_scope();
 
         bool has_optional_parameters = false;
         if (_parameters) {
@@ -131,13 +138,13 @@ namespace puppet { namespace runtime {
                     throw argument_exception(rvalue_cast(message), i);
                 });
 
-                if (current_scope->set(name, make_shared<values::value>(rvalue_cast(value)), _evaluator.compilation_context()->path(), parameter.position().line())) {
+                if (current_scope->set(parameter.variable().symbol(), make_shared<values::value>(rvalue_cast(value)), _evaluator.compilation_context()->path(), parameter.position().line())) {
                     throw _evaluator.create_exception(parameter.position(), (boost::format("parameter $%1% already exists in the parameter list.") % name).str());
                 }
             }
         }
 
-        return evaluate_body();
+        return evaluate_body(program);
     }
 
     values::value executor::execute(runtime::resource const& resource, shared_ptr<runtime::scope> const& scope) const
@@ -155,7 +162,7 @@ namespace puppet { namespace runtime {
 
                 // Check that parameters without default values are in the resource's attributes
                 if (!parameter.default_value()) {
-                    if (!attributes.get(name)) {
+                    if (!attributes.get(parameter.variable().symbol())) {
                         throw _evaluator.create_exception(parameter.position(), (boost::format("parameter $%1% is required but no value was given.") % name).str());
                     }
                     continue;
@@ -170,20 +177,23 @@ namespace puppet { namespace runtime {
                 });
 
                 // Set the default value into the scope
-                if (current_scope->set(name, make_shared<values::value>(rvalue_cast(value)), path, parameter.position().line())) {
+                if (current_scope->set(parameter.variable().symbol(), make_shared<values::value>(rvalue_cast(value)), path, parameter.position().line())) {
                     throw _evaluator.create_exception(parameter.position(), (boost::format("parameter $%1% already exists in the parameter list.") % name).str());
                 }
             }
         }
 
+        static const symbol title_symbol("title");
+        static const symbol name_symbol("name");
+
         shared_ptr<values::value const> title = make_shared<values::value const>(resource.type().title());
         shared_ptr<values::value const> name = title;
 
         // Set each attribute in the scope
-        attributes.each([&](string const& attribute_name, shared_ptr<values::value const> const& attribute_value) {
+        attributes.each([&](symbol const& attribute_name, values::value const& attribute_value) {
             // Check for resource name
-            if (attribute_name == "name") {
-                name = attribute_value;
+            if (attribute_name == name_symbol) {
+                name = make_shared<values::value const>(attribute_value);
                 return true;
             }
 
@@ -191,7 +201,7 @@ namespace puppet { namespace runtime {
             ast::parameter const* parameter = nullptr;
             if (_parameters) {
                 for (auto const& p : *_parameters) {
-                    if (p.variable().name() == attribute_name) {
+                    if (p.variable().symbol() == attribute_name) {
                         parameter = &p;
                         break;
                     }
@@ -201,29 +211,29 @@ namespace puppet { namespace runtime {
             // If the attribute is a parameter, validate it
             if (parameter) {
                 // Verify the value matches the parameter type
-                validate_type(*parameter, *attribute_value, [&](string message) {
-                    throw attribute_value_exception(rvalue_cast(message), attribute_name);
+                validate_type(*parameter, attribute_value, [&](string message) {
+                    throw attribute_value_exception(rvalue_cast(message), attribute_name.str());
                 });
-            } else if (!resource::is_metaparameter(attribute_name)) {
+            } else if (!resource::is_metaparameter(attribute_name.str())) {
                 // Not a parameter or metaparameter for the class or defined type
                 if (resource.type().is_class()) {
                     throw attribute_name_exception(
                         (boost::format("'%1%' is not a valid parameter for class '%2%'.") % attribute_name % resource.type().title()).str(),
-                        attribute_name);
+                        attribute_name.str());
                 }
                 throw attribute_name_exception(
                     (boost::format("'%1%' is not a valid parameter for defined type '%2%'.") % attribute_name % resource.type().type_name()).str(),
-                    attribute_name);
+                    attribute_name.str());
             }
 
-            current_scope->set(attribute_name, attribute_value, resource.path(), resource.line());
+            current_scope->set(attribute_name, make_shared<values::value const>(attribute_value), resource.path(), resource.line());
             return true;
         });
 
-        scope->set("title", rvalue_cast(title), path, resource.line());
-        scope->set("name", rvalue_cast(name), path, resource.line());
+        scope->set(title_symbol, rvalue_cast(title), path, resource.line());
+        scope->set(name_symbol, rvalue_cast(name), path, resource.line());
 
-        return evaluate_body();
+        return evaluate_body(program());
     }
 
     void executor::validate_type(ast::parameter const& parameter, values::value const& value, function<void(string)> const& type_error) const
@@ -247,9 +257,27 @@ namespace puppet { namespace runtime {
         }
     }
 
-    values::value executor::evaluate_body() const
+    vm::program const* executor::program() const
     {
-        // Evaluate the body
+        if (!_body || _evaluator.evaluation_context().engine() != runtime::engine::vm) {
+            return nullptr;
+        }
+        if (!_program) {
+            auto& context = _evaluator.evaluation_context();
+            auto& manifest = *_evaluator.compilation_context()->manifest();
+            _program = _lambda ? &context.program(manifest, *_lambda) : &context.program(manifest, *_body);
+        }
+        return _program;
+    }
+
+    values::value executor::evaluate_body(vm::program const* program) const
+    {
+        // Execute the body's program if it was compiled for the stack machine
+        if (program) {
+            return vm::machine(_evaluator).execute(*program);
+        }
+
+        // Otherwise, evaluate the body
         value result;
         if (_body) {
             for (size_t i = 0; i < _body->size(); ++i) {
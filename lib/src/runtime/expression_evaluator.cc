@@ -21,6 +21,8 @@
 #include <puppet/runtime/operators/relationship.hpp>
 #include <puppet/runtime/operators/right_shift.hpp>
 #include <puppet/runtime/dispatcher.hpp>
+#include <puppet/runtime/vm/machine.hpp>
+#include <puppet/ast/constant.hpp>
 #include <puppet/ast/expression_def.hpp>
 #include <puppet/cast.hpp>
 #include <boost/format.hpp>
@@ -92,6 +94,12 @@ namespace puppet { namespace runtime {
             return;
         }
 
+        // Execute the top level's program if compiling for the stack machine
+        if (_evaluation_context.engine() == runtime::engine::vm) {
+            vm::machine(*this).execute(_evaluation_context.program(*_compilation_context->manifest(), *tree.body(), true));
+            return;
+        }
+
         for (auto& expression : *tree.body()) {
             // Top level expressions must be productive
             evaluate(expression, true);
@@ -104,12 +112,16 @@ namespace puppet { namespace runtime {
             throw create_exception(expr.position(), "unproductive expressions may only appear last in a block.");
         }
 
+        // Use the value of the expression if it was folded into a constant
+        if (expr.constant()) {
+            return expr.constant()->value();
+        }
+
         // Evaluate the primary expression
         auto result = evaluate(expr.primary());
 
-        // Climb the remainder of the expression
-        auto begin = expr.binary().begin();
-        climb_expression(result, expr.position(), 0, begin, expr.binary().end());
+        // Evaluate the binary expressions
+        evaluate(result, expr.position(), expr, 0, expr.binary().size());
 
         return result;
     }
@@ -165,6 +177,42 @@ namespace puppet { namespace runtime {
         return equals(actual, expected);
     }
 
+    function<values::value(operators::binary_context&)> const* expression_evaluator::find_binary_operator(ast::binary_operator op)
+    {
+        // Read-only after initialization and the operators are stateless, so this is safe to share between threads
+        static const unordered_map<ast::binary_operator, function<values::value(operators::binary_context&)>> binary_operators = {
+            { ast::binary_operator::assignment,         operators::assignment() },
+            { ast::binary_operator::divide,             operators::divide() },
+            { ast::binary_operator::equals,             operators::equals() },
+            { ast::binary_operator::greater_than,       operators::greater() },
+            { ast::binary_operator::greater_equals,     operators::greater_equal() },
+            { ast::binary_operator::in,                 operators::in() },
+            { ast::binary_operator::in_edge,            operators::in_edge() },
+            { ast::binary_operator::in_edge_subscribe,  operators::in_edge_subscribe() },
+            { ast::binary_operator::less_than,          operators::less() },
+            { ast::binary_operator::less_equals,        operators::less_equal() },
+            { ast::binary_operator::left_shift,         operators::left_shift() },
+            { ast::binary_operator::logical_and,        operators::logical_and() },
+            { ast::binary_operator::logical_or,         operators::logical_or() },
+            { ast::binary_operator::match,              operators::match() },
+            { ast::binary_operator::minus,              operators::minus() },
+            { ast::binary_operator::modulo,             operators::modulo() },
+            { ast::binary_operator::multiply,           operators::multiply() },
+            { ast::binary_operator::not_equals,         operators::not_equals() },
+            { ast::binary_operator::not_match,          operators::not_match() },
+            { ast::binary_operator::out_edge,           operators::out_edge() },
+            { ast::binary_operator::out_edge_subscribe, operators::out_edge_subscribe() },
+            { ast::binary_operator::plus,               operators::plus() },
+            { ast::binary_operator::right_shift,        operators::right_shift() }
+        };
+
+        auto it = binary_operators.find(op);
+        if (it == binary_operators.end()) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
     bool expression_evaluator::is_productive(ast::expression const& expr)
     {
         // Check if the primary expression itself is productive
@@ -222,39 +270,37 @@ namespace puppet { namespace runtime {
         return false;
     }
 
-    void expression_evaluator::climb_expression(
+    void expression_evaluator::evaluate(
         value& left,
         lexer::position const& left_position,
-        uint8_t min_precedence,
-        vector<ast::binary_expression>::const_iterator& begin,
-        vector<ast::binary_expression>::const_iterator const& end)
+        ast::expression const& expr,
+        size_t begin,
+        size_t end)
     {
-        // This member implements precedence climbing for binary expressions
-        uint8_t precedence;
-        while (begin != end && (precedence = get_precedence(begin->op())) >= min_precedence)
-        {
-            auto op = begin->op();
-            auto& operand = begin->operand();
-            auto right_position = begin->position();
-            ++begin;
+        // Operator precedence was resolved when the expression was constructed
+        // The right operand of each binary expression is its primary operand and the binary expressions up to its operand end
+        auto& binary = expr.binary();
+        while (begin < end) {
+            auto& current = binary[begin];
+            auto op = current.op();
+            auto operand_end = expr.operand_end(begin);
 
             // If the operator is a logical and/or operator, attempt short circuiting
             if ((op == ast::binary_operator::logical_and && !is_truthy(left)) ||
                 (op == ast::binary_operator::logical_or && is_truthy(left))) {
                 left = op == ast::binary_operator::logical_or;
-                begin = end;
-                return;
+                begin = operand_end;
+                continue;
             }
 
             // Evaluate the right side
-            value right = evaluate(operand);
-
-            // Recurse and climb the expression
-            uint8_t next_precedence = precedence + (is_right_associative(op) ? static_cast<uint8_t>(0) : static_cast<uint8_t>(1));
-            climb_expression(right, right_position, next_precedence, begin, end);
+            value right = current.constant() ? current.constant()->value() : evaluate(current.operand());
+            auto right_position = current.position();
+            evaluate(right, right_position, expr, begin + 1, operand_end);
 
             // Evaluate this part of the expression
             evaluate(left, left_position, op, right, right_position);
+            begin = operand_end;
         }
     }
 
@@ -265,100 +311,13 @@ namespace puppet { namespace runtime {
         value& right,
         lexer::position& right_position)
     {
-        static const unordered_map<ast::binary_operator, function<values::value(operators::binary_context&)>> binary_operators = {
-            { ast::binary_operator::assignment,         operators::assignment() },
-            { ast::binary_operator::divide,             operators::divide() },
-            { ast::binary_operator::equals,             operators::equals() },
-            { ast::binary_operator::greater_than,       operators::greater() },
-            { ast::binary_operator::greater_equals,     operators::greater_equal() },
-            { ast::binary_operator::in,                 operators::in() },
-            { ast::binary_operator::in_edge,            operators::in_edge() },
-            { ast::binary_operator::in_edge_subscribe,  operators::in_edge_subscribe() },
-            { ast::binary_operator::less_than,          operators::less() },
-            { ast::binary_operator::less_equals,        operators::less_equal() },
-            { ast::binary_operator::left_shift,         operators::left_shift() },
-            { ast::binary_operator::logical_and,        operators::logical_and() },
-            { ast::binary_operator::logical_or,         operators::logical_or() },
-            { ast::binary_operator::match,              operators::match() },
-            { ast::binary_operator::minus,              operators::minus() },
-            { ast::binary_operator::modulo,             operators::modulo() },
-            { ast::binary_operator::multiply,           operators::multiply() },
-            { ast::binary_operator::not_equals,         operators::not_equals() },
-            { ast::binary_operator::not_match,          operators::not_match() },
-            { ast::binary_operator::out_edge,           operators::out_edge() },
-            { ast::binary_operator::out_edge_subscribe, operators::out_edge_subscribe() },
-            { ast::binary_operator::plus,               operators::plus() },
-            { ast::binary_operator::right_shift,        operators::right_shift() }
-        };
-
-        auto it = binary_operators.find(op);
-        if (it == binary_operators.end()) {
+        auto function = find_binary_operator(op);
+        if (!function) {
             throw create_exception(left_position, (boost::format("unspported binary operator '%1%' in binary expression.") % op).str());
         }
 
         operators::binary_context context(*this, left, left_position, right, right_position);
-        left = it->second(context);
-    }
-
-    uint8_t expression_evaluator::get_precedence(ast::binary_operator op)
-    {
-        // Return the precedence (low to high)
-        switch (op) {
-            case ast::binary_operator::in_edge:
-            case ast::binary_operator::in_edge_subscribe:
-            case ast::binary_operator::out_edge:
-            case ast::binary_operator::out_edge_subscribe:
-                return 1;
-
-            case ast::binary_operator::assignment:
-                return 2;
-
-            case ast::binary_operator::logical_or:
-                return 3;
-
-            case ast::binary_operator::logical_and:
-                return 4;
-
-            case ast::binary_operator::greater_than:
-            case ast::binary_operator::greater_equals:
-            case ast::binary_operator::less_than:
-            case ast::binary_operator::less_equals:
-                return 5;
-
-            case ast::binary_operator::equals:
-            case ast::binary_operator::not_equals:
-                return 6;
-
-            case ast::binary_operator::left_shift:
-            case ast::binary_operator::right_shift:
-                return 7;
-
-            case ast::binary_operator::plus:
-            case ast::binary_operator::minus:
-                return 8;
-
-            case ast::binary_operator::multiply:
-            case ast::binary_operator::divide:
-            case ast::binary_operator::modulo:
-                return 9;
-
-            case ast::binary_operator::match:
-            case ast::binary_operator::not_match:
-                return 10;
-
-            case ast::binary_operator::in:
-                return 11;
-
-            default:
-                break;
-        }
-
-        throw runtime_error("invalid binary operator.");
-    }
-
-    bool expression_evaluator::is_right_associative(ast::binary_operator op)
-    {
-        return op == ast::binary_operator::assignment;
+        left = (*function)(context);
     }
 
 }}  // namespace puppet::runtime
@@ -7,7 +7,7 @@ using namespace puppet::runtime::values;
 
 namespace puppet { namespace runtime { namespace operators {
 
-    static value add_relationship(binary_context& context, string const& attribute_name)
+    static value add_relationship(binary_context& context, runtime::relationship relationship)
     {
         auto& evaluator = context.evaluator();
         auto catalog = evaluator.evaluation_context().catalog();
@@ -17,6 +17,7 @@ namespace puppet { namespace runtime { namespace operators {
 
         // Populate an array of resource references from the right-hand side
         values::array result;
+        vector<runtime::resource const*> targets;
         each_resource(context.right(), [&](types::resource const& target_resource) {
             // Locate the target in the catalog
             auto target = catalog->find_resource(target_resource);
@@ -25,6 +26,7 @@ namespace puppet { namespace runtime { namespace operators {
             }
 
             result.emplace_back(target_resource);
+            targets.push_back(target);
         }, [&](string const& message) {
             throw evaluator.create_exception(context.right_position(), message);
         });
@@ -37,7 +39,13 @@ namespace puppet { namespace runtime { namespace operators {
                 throw evaluator.create_exception(context.left_position(), (boost::format("cannot create relationship: resource %1% does not exist in the catalog.") % source_resource).str());
             }
 
-            source->attributes().append(attribute_name, result, true /* remove duplicates */);
+            // Relate the source to each target; the resource skips relationships it already has
+            for (auto target : targets) {
+                if (source == target) {
+                    throw evaluator.create_exception(context.left_position(), (boost::format("cannot create relationship: resource %1% cannot form a relationship with itself.") % source_resource).str());
+                }
+                source->relate(relationship, *target);
+            }
         }, [&](string const& message) {
             throw evaluator.create_exception(context.left_position(), message);
         });
@@ -46,22 +54,22 @@ namespace puppet { namespace runtime { namespace operators {
 
     value in_edge::operator()(binary_context& context) const
     {
-        return add_relationship(context, "before");
+        return add_relationship(context, runtime::relationship::before);
     }
 
     value in_edge_subscribe::operator()(binary_context& context) const
     {
-        return add_relationship(context, "notify");
+        return add_relationship(context, runtime::relationship::notify);
     }
 
     value out_edge::operator()(binary_context& context) const
     {
-        return add_relationship(context, "require");
+        return add_relationship(context, runtime::relationship::require);
     }
 
     value out_edge_subscribe::operator()(binary_context& context) const
     {
-        return add_relationship(context, "subscribe");
+        return add_relationship(context, runtime::relationship::subscribe);
     }
 
 }}}  // namespace puppet::runtime::operators
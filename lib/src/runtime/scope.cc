@@ -32,7 +32,19 @@ namespace puppet { namespace runtime {
 
     scope::scope(shared_ptr<scope> parent, runtime::resource* resource) :
         _parent(rvalue_cast(parent)),
-        _resource(resource)
+        _resource(resource),
+        _slot_names(nullptr)
+    {
+        if (!_parent) {
+            throw runtime_error("expected a parent scope.");
+        }
+    }
+
+    scope::scope(shared_ptr<scope> parent, vector<symbol> const& slots) :
+        _parent(rvalue_cast(parent)),
+        _resource(nullptr),
+        _slot_names(&slots),
+        _slots(slots.size(), assigned_variable(nullptr))
     {
         if (!_parent) {
             throw runtime_error("expected a parent scope.");
@@ -41,7 +53,8 @@ namespace puppet { namespace runtime {
 
     scope::scope(shared_ptr<facts::provider> facts, runtime::resource* resource) :
         _facts(rvalue_cast(facts)),
-        _resource(resource)
+        _resource(resource),
+        _slot_names(nullptr)
     {
     }
 
@@ -68,8 +81,17 @@ namespace puppet { namespace runtime {
         return _resource->type().title() + "::" + name;
     }
 
-    assigned_variable const* scope::set(string name, shared_ptr<values::value const> value, shared_ptr<string> path, size_t line)
+    assigned_variable const* scope::set(symbol const& name, shared_ptr<values::value const> value, shared_ptr<string> path, size_t line)
     {
+        // Variables bound to slots are set in their slot
+        if (auto slot = find_slot(name)) {
+            if (slot->value()) {
+                return slot;
+            }
+            *slot = assigned_variable(rvalue_cast(value), rvalue_cast(path), line);
+            return nullptr;
+        }
+
         // Check to see if the variable already exists
         auto it = _variables.find(name);
         if (it != _variables.end()) {
@@ -83,12 +105,18 @@ namespace puppet { namespace runtime {
                 return previous;
             }
         }
-        _variables.emplace(make_pair(rvalue_cast(name), assigned_variable(rvalue_cast(value), rvalue_cast(path), line)));
+        _variables.emplace(make_pair(name, assigned_variable(rvalue_cast(value), rvalue_cast(path), line)));
         return nullptr;
     }
 
-    assigned_variable const* scope::get(string const& name)
+    assigned_variable const* scope::get(symbol const& name)
     {
+        // Unassigned slots fall through to the parent scopes
+        auto slot = find_slot(name);
+        if (slot && slot->value()) {
+            return slot;
+        }
+
         auto it = _variables.find(name);
         if (it != _variables.end()) {
             return &it->second;
@@ -103,7 +131,7 @@ namespace puppet { namespace runtime {
         if (!_facts) {
             return nullptr;
         }
-        auto value = _facts->lookup(name);
+        auto value = _facts->lookup(name.str());
         if (!value) {
             return nullptr;
         }
@@ -112,6 +140,39 @@ namespace puppet { namespace runtime {
         return &_variables.emplace(make_pair(name, assigned_variable(rvalue_cast(value)))).first->second;
     }
 
+    assigned_variable const* scope::set(size_t slot, shared_ptr<values::value const> value, shared_ptr<string> path, size_t line)
+    {
+        auto& variable = _slots[slot];
+        if (variable.value()) {
+            return &variable;
+        }
+        variable = assigned_variable(rvalue_cast(value), rvalue_cast(path), line);
+        return nullptr;
+    }
+
+    assigned_variable const* scope::get(size_t slot)
+    {
+        auto& variable = _slots[slot];
+        if (variable.value()) {
+            return &variable;
+        }
+        return _parent->get((*_slot_names)[slot]);
+    }
+
+    assigned_variable* scope::find_slot(symbol const& name)
+    {
+        if (!_slot_names) {
+            return nullptr;
+        }
+        // Lambdas bind few variables, so a linear scan is cheaper than hashing the name
+        for (size_t i = 0; i < _slot_names->size(); ++i) {
+            if ((*_slot_names)[i] == name) {
+                return &_slots[i];
+            }
+        }
+        return nullptr;
+    }
+
     ostream& operator<<(ostream& os, scope const& s)
     {
         if (!s.resource()) {
@@ -3,6 +3,12 @@
 #include <puppet/cast.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <sstream>
 
 using namespace std;
 
@@ -255,6 +261,162 @@ namespace puppet { namespace runtime { namespace values {
         }
     }
 
+    static void write_json_string(ostream& out, string const& str)
+    {
+        out << '"';
+        for (auto c : str) {
+            switch (c) {
+                case '"':
+                    out << "\\\"";
+                    break;
+                case '\\':
+                    out << "\\\\";
+                    break;
+                case '\n':
+                    out << "\\n";
+                    break;
+                case '\r':
+                    out << "\\r";
+                    break;
+                case '\t':
+                    out << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        out << "\\u" << hex << setw(4) << setfill('0') << static_cast<int>(c) << dec << setfill(' ');
+                    } else {
+                        out << c;
+                    }
+                    break;
+            }
+        }
+        out << '"';
+    }
+
+    struct json_value_writer : boost::static_visitor<>
+    {
+        explicit json_value_writer(ostream& out) :
+            _out(out)
+        {
+        }
+
+        result_type operator()(undef const&) const
+        {
+            _out << "null";
+        }
+
+        result_type operator()(defaulted const&) const
+        {
+            write_json_string(_out, "default");
+        }
+
+        result_type operator()(int64_t value) const
+        {
+            _out << value;
+        }
+
+        result_type operator()(long double value) const
+        {
+            // JSON has no infinity or NaN, so write them as strings like other values without a JSON representation
+            if (!isfinite(value)) {
+                ostringstream ss;
+                ss << value;
+                write_json_string(_out, ss.str());
+                return;
+            }
+
+            // Add digits until the text reads back as the same value so no precision is lost
+            string text;
+            for (int precision = numeric_limits<long double>::digits10; precision <= numeric_limits<long double>::max_digits10; ++precision) {
+                ostringstream ss;
+                ss.imbue(locale::classic());
+                ss << setprecision(precision) << value;
+                text = ss.str();
+                if (strtold(text.c_str(), nullptr) == value) {
+                    break;
+                }
+            }
+
+            // Keep the value a float when read back
+            if (text.find_first_of(".e") == string::npos) {
+                text += ".0";
+            }
+            _out << text;
+        }
+
+        result_type operator()(bool value) const
+        {
+            _out << (value ? "true" : "false");
+        }
+
+        result_type operator()(string const& value) const
+        {
+            write_json_string(_out, value);
+        }
+
+        result_type operator()(variable const& value) const
+        {
+            boost::apply_visitor(*this, value.value());
+        }
+
+        result_type operator()(array const& value) const
+        {
+            _out << '[';
+            bool first = true;
+            for (auto const& element : value) {
+                if (first) {
+                    first = false;
+                } else {
+                    _out << ',';
+                }
+                boost::apply_visitor(*this, element);
+            }
+            _out << ']';
+        }
+
+        result_type operator()(hash const& value) const
+        {
+            // JSON object keys must be strings
+            _out << '{';
+            bool first = true;
+            for (auto const& element : value) {
+                if (first) {
+                    first = false;
+                } else {
+                    _out << ',';
+                }
+                auto key = as<string>(element.first);
+                if (key) {
+                    write_json_string(_out, *key);
+                } else {
+                    ostringstream ss;
+                    ss << element.first;
+                    write_json_string(_out, ss.str());
+                }
+                _out << ':';
+                boost::apply_visitor(*this, element.second);
+            }
+            _out << '}';
+        }
+
+        template <typename T>
+        result_type operator()(T const& value) const
+        {
+            // Regexes and types are written as their Puppet representation
+            ostringstream ss;
+            ss << value;
+            write_json_string(_out, ss.str());
+        }
+
+     private:
+        ostream& _out;
+    };
+
+    void write_json(ostream& os, value const& val)
+    {
+        boost::apply_visitor(json_value_writer(os), val);
+    }
+
     bool operator==(undef const&, undef const&)
     {
         return true;
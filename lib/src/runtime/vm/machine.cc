@@ -0,0 +1,227 @@
+#include <puppet/runtime/vm/machine.hpp>
+#include <puppet/runtime/operators/logical_not.hpp>
+#include <puppet/runtime/operators/negate.hpp>
+#include <puppet/runtime/operators/splat.hpp>
+#include <puppet/cast.hpp>
+#include <boost/format.hpp>
+#include <sstream>
+
+using namespace std;
+using namespace puppet::runtime::values;
+
+namespace puppet { namespace runtime { namespace vm {
+
+    machine::machine(expression_evaluator& evaluator) :
+        _evaluator(evaluator)
+    {
+    }
+
+    value machine::execute(vm::program const& program)
+    {
+        auto& instructions = program.instructions();
+        auto& context = _evaluator.evaluation_context();
+
+        // Slots are bound to the scope the program starts executing in
+        auto frame = context.current_scope();
+
+        vector<value> stack;
+        stack.reserve(program.stack_size());
+
+        // Match scopes are owned here so that they are left if an exception is thrown
+        vector<unique_ptr<match_scope>> match_scopes;
+
+        for (size_t pc = 0; pc < instructions.size();) {
+            auto& instruction = instructions[pc++];
+            switch (instruction.code) {
+                case opcode::push:
+                    stack.push_back(program.constants()[instruction.operand]);
+                    break;
+
+                case opcode::load:
+                    stack.emplace_back(load(*program.variables()[instruction.operand].variable));
+                    break;
+
+                case opcode::load_slot: {
+                    auto& reference = program.variables()[instruction.operand];
+                    stack.emplace_back(load(*reference.variable, *frame, reference.slot));
+                    break;
+                }
+
+                case opcode::assign_slot: {
+                    auto& reference = program.variables()[instruction.operand];
+                    stack.back() = assign(*reference.variable, *frame, reference.slot, stack.back());
+                    break;
+                }
+
+                case opcode::evaluate:
+                    stack.emplace_back(_evaluator.evaluate(*program.expressions()[instruction.operand]));
+                    break;
+
+                case opcode::pop:
+                    stack.pop_back();
+                    break;
+
+                case opcode::unary: {
+                    auto& operation = program.unary_operations()[instruction.operand];
+                    operators::unary_context unary_context(_evaluator, stack.back(), operation.position);
+                    switch (operation.op) {
+                        case ast::unary_operator::negate:
+                            stack.back() = operators::negate()(unary_context);
+                            break;
+
+                        case ast::unary_operator::logical_not:
+                            stack.back() = operators::logical_not()(unary_context);
+                            break;
+
+                        case ast::unary_operator::splat:
+                            stack.back() = operators::splat()(unary_context);
+                            break;
+
+                        default:
+                            throw _evaluator.create_exception(operation.position, "unexpected unary expression.");
+                    }
+                    break;
+                }
+
+                case opcode::binary: {
+                    auto& operation = program.binary_operations()[instruction.operand];
+                    if (!operation.function) {
+                        throw _evaluator.create_exception(operation.left_position, (boost::format("unspported binary operator '%1%' in binary expression.") % operation.op).str());
+                    }
+                    auto right = rvalue_cast(stack.back());
+                    stack.pop_back();
+                    operators::binary_context binary_context(_evaluator, stack.back(), operation.left_position, right, operation.right_position);
+                    stack.back() = (*operation.function)(binary_context);
+                    break;
+                }
+
+                case opcode::branch_and:
+                    if (!is_truthy(stack.back())) {
+                        stack.back() = false;
+                        pc = instruction.operand;
+                    }
+                    break;
+
+                case opcode::branch_or:
+                    if (is_truthy(stack.back())) {
+                        stack.back() = true;
+                        pc = instruction.operand;
+                    }
+                    break;
+
+                case opcode::branch_false: {
+                    bool truthy = is_truthy(stack.back());
+                    stack.pop_back();
+                    if (!truthy) {
+                        pc = instruction.operand;
+                    }
+                    break;
+                }
+
+                case opcode::branch_true: {
+                    bool truthy = is_truthy(stack.back());
+                    stack.pop_back();
+                    if (truthy) {
+                        pc = instruction.operand;
+                    }
+                    break;
+                }
+
+                case opcode::jump:
+                    pc = instruction.operand;
+                    break;
+
+                case opcode::enter_match_scope:
+                    match_scopes.emplace_back(new match_scope(context));
+                    break;
+
+                case opcode::leave_match_scope:
+                    match_scopes.pop_back();
+                    break;
+
+                case opcode::unproductive:
+                    throw _evaluator.create_exception(program.positions()[instruction.operand], "unproductive expressions may only appear last in a block.");
+
+                case opcode::make_array: {
+                    values::array array(std::make_move_iterator(stack.end() - instruction.operand), std::make_move_iterator(stack.end()));
+                    stack.erase(stack.end() - instruction.operand, stack.end());
+                    stack.emplace_back(rvalue_cast(array));
+                    break;
+                }
+
+                case opcode::make_hash: {
+                    values::hash hash;
+                    for (auto it = stack.end() - instruction.operand * 2; it != stack.end(); it += 2) {
+                        hash.emplace(rvalue_cast(*it), rvalue_cast(*(it + 1)));
+                    }
+                    stack.erase(stack.end() - instruction.operand * 2, stack.end());
+                    stack.emplace_back(rvalue_cast(hash));
+                    break;
+                }
+
+                case opcode::concatenate: {
+                    ostringstream ss;
+                    for (auto it = stack.end() - instruction.operand; it != stack.end(); ++it) {
+                        ss << *it;
+                    }
+                    stack.erase(stack.end() - instruction.operand, stack.end());
+                    stack.emplace_back(ss.str());
+                    break;
+                }
+
+                default:
+                    throw runtime_error("unexpected instruction.");
+            }
+        }
+
+        if (stack.empty()) {
+            return value();
+        }
+        return rvalue_cast(stack.back());
+    }
+
+    value machine::load(ast::variable const& variable)
+    {
+        auto& name = variable.name();
+        if (name.empty()) {
+            throw _evaluator.create_exception(variable.position(), "variable name cannot be empty.");
+        }
+
+        auto& context = _evaluator.evaluation_context();
+
+        shared_ptr<value const> value;
+        if (isdigit(name[0])) {
+            value = context.lookup(stoi(name));
+        } else {
+            value = context.lookup(variable.symbol(), &_evaluator, &variable.position());
+        }
+        return values::variable(variable.symbol(), rvalue_cast(value));
+    }
+
+    value machine::load(ast::variable const& variable, runtime::scope& frame, size_t slot)
+    {
+        auto assigned = frame.get(slot);
+        return values::variable(variable.symbol(), assigned ? assigned->value() : nullptr);
+    }
+
+    value machine::assign(ast::variable const& variable, runtime::scope& frame, size_t slot, values::value& value)
+    {
+        // If the right side is a variable, assign to the variable's value
+        shared_ptr<values::value const> assigned;
+        if (auto existing = as<values::variable>(value)) {
+            assigned = existing->value_ptr();
+        } else {
+            assigned = make_shared<values::value const>(rvalue_cast(value));
+        }
+
+        auto previous = frame.set(slot, assigned, _evaluator.compilation_context()->path(), variable.position().line());
+        if (previous) {
+            if (previous->path() && !previous->path()->empty()) {
+                throw _evaluator.create_exception(variable.position(), (boost::format("cannot assign to $%1%: variable was previously assigned at %2%:%3%.") % variable.name() % *previous->path() % previous->line()).str());
+            }
+            throw _evaluator.create_exception(variable.position(), (boost::format("cannot assign to $%1%: a fact or node parameter exists with the same name.") % variable.name()).str());
+        }
+        return values::variable(variable.symbol(), rvalue_cast(assigned));
+    }
+
+}}}  // namespace puppet::runtime::vm
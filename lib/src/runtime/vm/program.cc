@@ -0,0 +1,443 @@
+#include <puppet/runtime/vm/program.hpp>
+#include <puppet/runtime/expression_evaluator.hpp>
+#include <puppet/ast/constant.hpp>
+#include <puppet/ast/expression_def.hpp>
+#include <puppet/ast/interpolated_string.hpp>
+#include <puppet/cast.hpp>
+#include <algorithm>
+#include <cctype>
+
+using namespace std;
+using namespace puppet::runtime::values;
+
+namespace puppet { namespace runtime { namespace vm {
+
+    struct program_compiler
+    {
+        explicit program_compiler(vm::program& program) :
+            _program(program)
+        {
+        }
+
+        void compile(vector<ast::expression> const* body, bool top_level)
+        {
+            // An empty block evaluates to undef
+            if (!body || body->empty()) {
+                push(value());
+                return;
+            }
+
+            for (size_t i = 0; i < body->size(); ++i) {
+                auto& expression = (*body)[i];
+                if (i > 0) {
+                    _program.emit(opcode::pop, 0, -1);
+                }
+
+                // Like the tree walker, check that the expression is productive before evaluating it
+                if ((top_level || i < body->size() - 1) && !expression_evaluator::is_productive(expression)) {
+                    _program._positions.push_back(expression.position());
+                    _program.emit(opcode::unproductive, _program._positions.size() - 1);
+                }
+                compile(expression);
+            }
+        }
+
+        void compile(ast::lambda const& lambda)
+        {
+            // The parameters are bound to the first slots; a duplicate parameter is reported when it is bound
+            if (lambda.parameters()) {
+                for (auto& parameter : *lambda.parameters()) {
+                    bind(parameter.variable().symbol());
+                }
+            }
+            _slotted = true;
+            compile(lambda.body().get_ptr(), false);
+        }
+
+     private:
+        void compile(ast::expression const& expression)
+        {
+            if (expression.constant()) {
+                push(expression.constant()->value());
+                return;
+            }
+            if (compile_assignment(expression)) {
+                return;
+            }
+            compile(expression.primary());
+            compile(expression, 0, expression.binary().size(), expression.position());
+        }
+
+        bool compile_assignment(ast::expression const& expression)
+        {
+            // Only an assignment of the whole expression to a local variable is bound to a slot (i.e. $name = ...)
+            auto& binary = expression.binary();
+            if (!_slotted || binary.empty() || binary[0].op() != ast::binary_operator::assignment || expression.operand_end(0) != binary.size()) {
+                return false;
+            }
+            auto basic = boost::get<ast::basic_expression>(&expression.primary());
+            auto variable = basic ? boost::get<ast::variable>(basic) : nullptr;
+            if (!variable) {
+                return false;
+            }
+
+            // Match variables and qualified names cannot be assigned; leave the error to the assignment operator
+            auto& name = variable->name();
+            if (name.empty() || isdigit(name[0]) || name.find(':') != string::npos) {
+                return false;
+            }
+
+            auto& assignment = binary[0];
+            if (assignment.constant()) {
+                push(assignment.constant()->value());
+            } else {
+                compile(assignment.operand());
+            }
+            compile(expression, 1, binary.size(), assignment.position());
+
+            _program._variables.push_back(variable_reference{ variable, bind(variable->symbol()) });
+            _program.emit(opcode::assign_slot, _program._variables.size() - 1);
+            return true;
+        }
+
+        void compile(ast::expression const& expression, size_t begin, size_t end, lexer::position const& left_position)
+        {
+            // Emit the binary expressions in the order the tree walker evaluates them
+            auto& binary = expression.binary();
+            while (begin < end) {
+                auto& current = binary[begin];
+                auto operand_end = expression.operand_end(begin);
+
+                // Logical and/or short circuit past the right operand
+                size_t branch = 0;
+                bool short_circuits = current.op() == ast::binary_operator::logical_and || current.op() == ast::binary_operator::logical_or;
+                if (short_circuits) {
+                    branch = _program.emit(current.op() == ast::binary_operator::logical_and ? opcode::branch_and : opcode::branch_or);
+                }
+
+                if (current.constant()) {
+                    push(current.constant()->value());
+                } else {
+                    compile(current.operand());
+                }
+                compile(expression, begin + 1, operand_end, current.position());
+
+                // Resolve the operator now so that executing the instruction calls it directly
+                _program._binary_operations.push_back(binary_operation{ current.op(), expression_evaluator::find_binary_operator(current.op()), left_position, current.position() });
+                _program.emit(opcode::binary, _program._binary_operations.size() - 1, -1);
+
+                if (short_circuits) {
+                    patch(branch);
+                }
+                begin = operand_end;
+            }
+        }
+
+        void compile(ast::primary_expression const& expression)
+        {
+            if (boost::get<boost::blank>(&expression)) {
+                push(value());
+                return;
+            }
+            if (auto basic = boost::get<ast::basic_expression>(&expression)) {
+                if (compile(*basic)) {
+                    return;
+                }
+            } else if (auto control_flow = boost::get<ast::control_flow_expression>(&expression)) {
+                if (compile(*control_flow)) {
+                    return;
+                }
+            } else if (auto unary = boost::get<ast::unary_expression>(&expression)) {
+                compile(unary->operand());
+                _program._unary_operations.push_back(unary_operation{ unary->op(), unary->position() });
+                _program.emit(opcode::unary, _program._unary_operations.size() - 1);
+                return;
+            } else if (auto nested = boost::get<ast::expression>(&expression)) {
+                compile(*nested);
+                return;
+            }
+
+            // Otherwise, fall back to the tree walker
+            _program._expressions.push_back(&expression);
+            _program.emit(opcode::evaluate, _program._expressions.size() - 1, 1);
+        }
+
+        bool compile(ast::basic_expression const& expression)
+        {
+            // Return false without emitting any instructions if the expression is not supported
+            if (boost::get<ast::undef>(&expression)) {
+                push(value());
+            } else if (boost::get<ast::defaulted>(&expression)) {
+                push(defaulted());
+            } else if (auto boolean = boost::get<ast::boolean>(&expression)) {
+                push(boolean->value());
+            } else if (auto number = boost::get<ast::number>(&expression)) {
+                if (auto integer = boost::get<int64_t>(&number->value())) {
+                    push(*integer);
+                } else {
+                    push(boost::get<long double>(number->value()));
+                }
+            } else if (auto str = boost::get<ast::string>(&expression)) {
+                return compile(*str);
+            } else if (auto variable = boost::get<ast::variable>(&expression)) {
+                load(*variable);
+            } else if (auto name = boost::get<ast::name>(&expression)) {
+                push(name->value());
+            } else if (auto word = boost::get<ast::bare_word>(&expression)) {
+                push(word->value());
+            } else if (auto array = boost::get<ast::array>(&expression)) {
+                return compile(*array);
+            } else if (auto hash = boost::get<ast::hash>(&expression)) {
+                compile(*hash);
+            } else {
+                return false;
+            }
+            return true;
+        }
+
+        bool compile(ast::control_flow_expression const& expression)
+        {
+            // Case expressions and function calls are left to the tree walker; a lambda passed to a function is compiled when it is called
+            if (auto if_ = boost::get<ast::if_expression>(&expression)) {
+                compile(*if_);
+                return true;
+            }
+            if (auto unless = boost::get<ast::unless_expression>(&expression)) {
+                compile(*unless);
+                return true;
+            }
+            return false;
+        }
+
+        void compile(ast::if_expression const& expression)
+        {
+            // If expressions create a new match scope
+            _program.emit(opcode::enter_match_scope);
+
+            vector<size_t> jumps;
+            compile_branch(expression.conditional(), opcode::branch_false, expression.body(), jumps);
+            if (expression.elsifs()) {
+                for (auto& elsif : *expression.elsifs()) {
+                    compile_branch(elsif.conditional(), opcode::branch_false, elsif.body(), jumps);
+                }
+            }
+            compile(expression.else_() ? expression.else_()->body().get_ptr() : nullptr, false);
+            for (auto jump : jumps) {
+                patch(jump);
+            }
+
+            _program.emit(opcode::leave_match_scope);
+        }
+
+        void compile(ast::unless_expression const& expression)
+        {
+            // Unless expressions create a new match scope
+            _program.emit(opcode::enter_match_scope);
+
+            vector<size_t> jumps;
+            compile_branch(expression.conditional(), opcode::branch_true, expression.body(), jumps);
+            compile(expression.else_() ? expression.else_()->body().get_ptr() : nullptr, false);
+            for (auto jump : jumps) {
+                patch(jump);
+            }
+
+            _program.emit(opcode::leave_match_scope);
+        }
+
+        void compile_branch(ast::expression const& conditional, opcode code, boost::optional<vector<ast::expression>> const& body, vector<size_t>& jumps)
+        {
+            compile(conditional);
+            auto branch = _program.emit(code, 0, -1);
+            compile(body.get_ptr(), false);
+            jumps.push_back(_program.emit(opcode::jump));
+
+            // The next branch starts without the value of this one
+            --_program._depth;
+            patch(branch);
+        }
+
+        bool compile(ast::string const& str)
+        {
+            // Strings with compilation warnings are left to the tree walker, which reports the warnings
+            auto& compiled = str.compiled();
+            if (!compiled || !compiled->warnings().empty()) {
+                return false;
+            }
+
+            auto& segments = compiled->segments();
+            if (segments.empty()) {
+                push(string());
+                return true;
+            }
+            if (segments.size() == 1) {
+                if (auto text = boost::get<string>(&segments.front())) {
+                    push(*text);
+                    return true;
+                }
+            }
+
+            for (auto& segment : segments) {
+                if (auto text = boost::get<string>(&segment)) {
+                    push(*text);
+                    continue;
+                }
+
+                // The value of an interpolation is the value of its last expression
+                auto& expressions = boost::get<vector<ast::expression>>(segment);
+                if (expressions.empty()) {
+                    push(value());
+                    continue;
+                }
+                bool first = true;
+                for (auto& expression : expressions) {
+                    if (!first) {
+                        _program.emit(opcode::pop, 0, -1);
+                    }
+                    first = false;
+                    compile(expression);
+                }
+            }
+            _program.emit(opcode::concatenate, segments.size(), 1 - static_cast<int>(segments.size()));
+            return true;
+        }
+
+        bool compile(ast::array const& array)
+        {
+            size_t count = 0;
+            if (array.elements()) {
+                // Elements that might unfold are left to the tree walker
+                for (auto& element : *array.elements()) {
+                    if (!element.binary().empty()) {
+                        continue;
+                    }
+                    auto unary = boost::get<ast::unary_expression>(&element.primary());
+                    if ((unary && unary->op() == ast::unary_operator::splat) || boost::get<ast::expression>(&element.primary())) {
+                        return false;
+                    }
+                }
+                for (auto& element : *array.elements()) {
+                    compile(element);
+                }
+                count = array.elements()->size();
+            }
+            _program.emit(opcode::make_array, count, 1 - static_cast<int>(count));
+            return true;
+        }
+
+        void compile(ast::hash const& hash)
+        {
+            size_t count = 0;
+            if (hash.elements()) {
+                for (auto& element : *hash.elements()) {
+                    compile(element.first);
+                    compile(element.second);
+                }
+                count = hash.elements()->size();
+            }
+            _program.emit(opcode::make_hash, count, 1 - static_cast<int>(count * 2));
+        }
+
+        void load(ast::variable const& variable)
+        {
+            auto& slots = _program._slots;
+            auto slot = find(slots.begin(), slots.end(), variable.symbol());
+            _program._variables.push_back(variable_reference{ &variable, static_cast<size_t>(slot - slots.begin()) });
+            _program.emit(slot == slots.end() ? opcode::load : opcode::load_slot, _program._variables.size() - 1, 1);
+        }
+
+        size_t bind(symbol const& name)
+        {
+            auto& slots = _program._slots;
+            auto slot = find(slots.begin(), slots.end(), name);
+            if (slot != slots.end()) {
+                return slot - slots.begin();
+            }
+            slots.push_back(name);
+            return slots.size() - 1;
+        }
+
+        void push(value constant)
+        {
+            _program._constants.emplace_back(rvalue_cast(constant));
+            _program.emit(opcode::push, _program._constants.size() - 1, 1);
+        }
+
+        void patch(size_t branch)
+        {
+            _program._instructions[branch].operand = static_cast<uint32_t>(_program._instructions.size());
+        }
+
+        vm::program& _program;
+        bool _slotted = false;
+    };
+
+    program::program(vector<ast::expression> const& body, bool top_level) :
+        _depth(0),
+        _stack_size(0)
+    {
+        program_compiler compiler(*this);
+        compiler.compile(&body, top_level);
+    }
+
+    program::program(ast::lambda const& lambda) :
+        _depth(0),
+        _stack_size(0)
+    {
+        program_compiler compiler(*this);
+        compiler.compile(lambda);
+    }
+
+    vector<instruction> const& program::instructions() const
+    {
+        return _instructions;
+    }
+
+    vector<value> const& program::constants() const
+    {
+        return _constants;
+    }
+
+    vector<variable_reference> const& program::variables() const
+    {
+        return _variables;
+    }
+
+    vector<ast::primary_expression const*> const& program::expressions() const
+    {
+        return _expressions;
+    }
+
+    vector<unary_operation> const& program::unary_operations() const
+    {
+        return _unary_operations;
+    }
+
+    vector<binary_operation> const& program::binary_operations() const
+    {
+        return _binary_operations;
+    }
+
+    vector<lexer::position> const& program::positions() const
+    {
+        return _positions;
+    }
+
+    vector<symbol> const& program::slots() const
+    {
+        return _slots;
+    }
+
+    size_t program::stack_size() const
+    {
+        return _stack_size;
+    }
+
+    size_t program::emit(opcode code, size_t operand, int effect)
+    {
+        _instructions.push_back(instruction{ code, static_cast<uint32_t>(operand) });
+        _depth += effect;
+        _stack_size = max(_stack_size, _depth);
+        return _instructions.size() - 1;
+    }
+
+}}}  // namespace puppet::runtime::vm
@@ -0,0 +1,97 @@
+#include <puppet/symbol.hpp>
+#include <atomic>
+#include <mutex>
+
+using namespace std;
+
+namespace puppet {
+
+    // An interned name; entries are never removed, so their names have stable addresses
+    struct symbol_entry
+    {
+        symbol_entry(string name, symbol_entry* next) :
+            name(move(name)),
+            next(next)
+        {
+        }
+
+        string const name;
+        symbol_entry* const next;
+    };
+
+    // The number of buckets in the symbol table; this is fixed so that buckets never move while being read
+    static size_t const bucket_count = 1 << 15;
+
+    static string const* empty_name()
+    {
+        static string const name;
+        return &name;
+    }
+
+    static string const* intern(string const& name)
+    {
+        if (name.empty()) {
+            return empty_name();
+        }
+
+        // Each bucket is the head of a chain of entries; new entries are only ever pushed onto the front of a chain.
+        // Static atomics are zero-initialized, so every bucket starts out as an empty chain.
+        static atomic<symbol_entry*> buckets[bucket_count];
+        static mutex insert_mutex;
+
+        auto& bucket = buckets[std::hash<string>()(name) & (bucket_count - 1)];
+
+        // Most names are already interned, so search the chain without taking a lock or writing to shared memory
+        for (auto entry = bucket.load(memory_order_acquire); entry; entry = entry->next) {
+            if (entry->name == name) {
+                return &entry->name;
+            }
+        }
+
+        // Take the lock to add the name; another thread may have added it in the meantime
+        lock_guard<mutex> lock(insert_mutex);
+        auto head = bucket.load(memory_order_relaxed);
+        for (auto entry = head; entry; entry = entry->next) {
+            if (entry->name == name) {
+                return &entry->name;
+            }
+        }
+
+        // Publish the new entry only after it is fully constructed so that readers never see a partial entry
+        auto entry = new symbol_entry(name, head);
+        bucket.store(entry, memory_order_release);
+        return &entry->name;
+    }
+
+    symbol::symbol() :
+        _name(empty_name())
+    {
+    }
+
+    symbol::symbol(string const& name) :
+        _name(intern(name))
+    {
+    }
+
+    string const& symbol::str() const
+    {
+        return *_name;
+    }
+
+    bool symbol::empty() const
+    {
+        return _name->empty();
+    }
+
+    size_t symbol::hash() const
+    {
+        return std::hash<string const*>()(_name);
+    }
+
+    ostream& operator<<(ostream& os, symbol const& sym)
+    {
+        os << sym.str();
+        return os;
+    }
+
+}  // puppet
@@ -0,0 +1,36 @@
+#include <catch.hpp>
+#include <puppet/ast/arena.hpp>
+#include <puppet/compiler/parser.hpp>
+
+using namespace std;
+using namespace puppet;
+
+SCENARIO("allocating syntax tree nodes from an arena")
+{
+    ast::arena arena;
+    REQUIRE(arena.allocations() == 0);
+    REQUIRE(arena.bytes() == 0);
+    REQUIRE_FALSE(ast::arena::current());
+
+    WHEN("a syntax tree is parsed in an arena scope") {
+        {
+            ast::arena_scope scope{arena};
+            REQUIRE(ast::arena::current() == &arena);
+
+            auto tree = compiler::parser::parse("$x = [1, { a => 2 }]\nif $x { notice(-$x[0]) }");
+            REQUIRE(tree.body());
+        }
+        THEN("the nodes should be allocated from the arena") {
+            REQUIRE_FALSE(ast::arena::current());
+            REQUIRE(arena.allocations() > 0);
+            REQUIRE(arena.bytes() > 0);
+        }
+    }
+    WHEN("a syntax tree is parsed outside of an arena scope") {
+        auto tree = compiler::parser::parse("$x = [1, { a => 2 }]");
+        THEN("the nodes should not be allocated from the arena") {
+            REQUIRE(arena.allocations() == 0);
+            REQUIRE(arena.bytes() == 0);
+        }
+    }
+}
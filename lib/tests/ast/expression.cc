@@ -0,0 +1,44 @@
+#include <catch.hpp>
+#include <puppet/compiler/parser.hpp>
+
+using namespace std;
+using namespace puppet;
+
+static ast::expression parse_expression(string const& source)
+{
+    auto tree = compiler::parser::parse(source);
+    REQUIRE(tree.body());
+    REQUIRE(tree.body()->size() == 1);
+    return tree.body()->front();
+}
+
+static vector<size_t> operand_ends(ast::expression const& expression)
+{
+    vector<size_t> ends;
+    for (size_t i = 0; i < expression.binary().size(); ++i) {
+        ends.push_back(expression.operand_end(i));
+    }
+    return ends;
+}
+
+SCENARIO("resolving binary operator precedence")
+{
+    WHEN("an expression mixes operators of different precedence") {
+        auto expression = parse_expression("1 + 2 * 3 - 4");
+        THEN("the higher precedence operators should be part of the right operand") {
+            REQUIRE(operand_ends(expression) == (vector<size_t>{ 2, 2, 3 }));
+        }
+    }
+    WHEN("an expression has right associative operators") {
+        auto expression = parse_expression("$a = $b = 1 + 2");
+        THEN("the right operand should extend to the end of the expression") {
+            REQUIRE(operand_ends(expression) == (vector<size_t>{ 3, 3, 3 }));
+        }
+    }
+    WHEN("an expression has left associative operators") {
+        auto expression = parse_expression("1 - 2 - 3 and 4 or 5");
+        THEN("the right operand should not include operators of the same precedence") {
+            REQUIRE(operand_ends(expression) == (vector<size_t>{ 1, 2, 3, 4 }));
+        }
+    }
+}
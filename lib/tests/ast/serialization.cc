@@ -0,0 +1,138 @@
+#include <catch.hpp>
+#include <puppet/ast/serialization.hpp>
+#include <puppet/compiler/cache.hpp>
+#include <puppet/compiler/manifest.hpp>
+#include <puppet/compiler/parser.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+using namespace puppet;
+
+namespace fs = boost::filesystem;
+
+static string print_tree(ast::syntax_tree const& tree)
+{
+    ostringstream ss;
+    ss << tree;
+    return ss.str();
+}
+
+static string serialize_tree(ast::syntax_tree const& tree)
+{
+    ostringstream ss;
+    ast::serialize(ss, tree);
+    return ss.str();
+}
+
+static ast::syntax_tree deserialize_tree(string const& data)
+{
+    istringstream ss(data);
+    return ast::deserialize(ss);
+}
+
+static ast::syntax_tree parse_fixture()
+{
+    ifstream file(FIXTURES_DIR "ast/expressions.pp");
+    REQUIRE(file);
+    ostringstream contents;
+    contents << file.rdbuf();
+    return compiler::parser::parse(contents.str());
+}
+
+SCENARIO("serializing a syntax tree")
+{
+    auto tree = parse_fixture();
+    auto data = serialize_tree(tree);
+
+    WHEN("the syntax tree is deserialized") {
+        auto result = deserialize_tree(data);
+        THEN("it should be the same as the original syntax tree") {
+            REQUIRE(print_tree(result) == print_tree(tree));
+            REQUIRE(result.end().offset() == tree.end().offset());
+            REQUIRE(result.end().line() == tree.end().line());
+        }
+        THEN("it should serialize to the same data, including positions") {
+            REQUIRE(serialize_tree(result) == data);
+        }
+    }
+    WHEN("the data is truncated") {
+        THEN("deserializing should throw an exception") {
+            for (auto size : { data.size() - 1, data.size() / 2, static_cast<size_t>(5), static_cast<size_t>(0) }) {
+                CAPTURE(size);
+                REQUIRE_THROWS_AS(deserialize_tree(data.substr(0, size)), ast::serialization_exception const&);
+            }
+        }
+    }
+    WHEN("the data has trailing bytes") {
+        THEN("deserializing should throw an exception") {
+            REQUIRE_THROWS_AS(deserialize_tree(data + '\0'), ast::serialization_exception const&);
+        }
+    }
+    WHEN("the data is not a serialized syntax tree") {
+        THEN("deserializing should throw an exception") {
+            REQUIRE_THROWS_AS(deserialize_tree("not a syntax tree"), ast::serialization_exception const&);
+        }
+    }
+    WHEN("the format version does not match") {
+        auto corrupt = data;
+        corrupt[4] = static_cast<char>(ast::SERIALIZATION_FORMAT_VERSION + 1);
+        THEN("deserializing should throw an exception") {
+            REQUIRE_THROWS_AS(deserialize_tree(corrupt), ast::serialization_exception const&);
+        }
+    }
+}
+
+SCENARIO("caching a syntax tree")
+{
+    auto directory = fs::temp_directory_path() / fs::unique_path();
+    compiler::cache cache(directory.string());
+
+    lexer::source_buffer source(FIXTURES_DIR "ast/expressions.pp");
+    auto tree = parse_fixture();
+
+    REQUIRE_FALSE(cache.load(source));
+    REQUIRE(cache.store(source, tree));
+
+    auto cached = cache.load(source);
+    REQUIRE(cached);
+    REQUIRE(serialize_tree(*cached) == serialize_tree(tree));
+
+    fs::remove_all(directory);
+}
+
+struct null_logger : logging::logger
+{
+ protected:
+    void log_message(logging::level, size_t, size_t, string const&, string const&, string const&) override
+    {
+    }
+};
+
+SCENARIO("caching a syntax tree with deferred bodies")
+{
+    auto directory = fs::temp_directory_path() / fs::unique_path();
+    fs::create_directories(directory);
+    compiler::cache cache((directory / "cache").string());
+
+    // The syntax error is in a class body, so it is only found when the body is parsed
+    auto path = make_shared<string>((directory / "broken.pp").string());
+    {
+        ofstream file(*path);
+        file << "class broken {\n    $x =\n}\n";
+    }
+
+    null_logger logger;
+    compiler::manifest lazy(logger, path, &cache, true);
+    REQUIRE(cache.load(*lazy.source(), true));
+
+    WHEN("the manifest is loaded without deferring bodies") {
+        THEN("the deferred tree should not be loaded from the cache") {
+            REQUIRE_FALSE(cache.load(*lazy.source(), false));
+            REQUIRE_THROWS_AS(compiler::manifest(logger, path, &cache, false), compiler::compilation_exception const&);
+        }
+    }
+
+    fs::remove_all(directory);
+}
@@ -0,0 +1,100 @@
+#include "benchmark.hpp"
+#include <puppet/runtime/catalog.hpp>
+#include <puppet/runtime/values/value.hpp>
+#include <puppet/cast.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace puppet::runtime;
+
+namespace puppet { namespace benchmark {
+
+    // The attributes of a typical file resource
+    static vector<pair<string, values::value>> file_attributes(size_t index)
+    {
+        vector<pair<string, values::value>> attributes;
+        attributes.emplace_back("ensure", string("file"));
+        attributes.emplace_back("path", "/etc/generated/file" + to_string(index));
+        attributes.emplace_back("owner", string("root"));
+        attributes.emplace_back("group", string("wheel"));
+        attributes.emplace_back("mode", string("0644"));
+        attributes.emplace_back("content", "generated content for file " + to_string(index));
+        attributes.emplace_back("require", values::array{ types::resource("Package", "package" + to_string(index % 100)) });
+        return attributes;
+    }
+
+    static shared_ptr<runtime::attributes> create_attributes(size_t index, shared_ptr<runtime::attributes const> const& defaults)
+    {
+        auto attributes = make_shared<runtime::attributes>(defaults);
+        for (auto& attribute : file_attributes(index)) {
+            attributes->set(symbol(attribute.first), rvalue_cast(attribute.second));
+        }
+        return attributes;
+    }
+
+    static void report_per_resource(string const& name, size_t before, size_t size)
+    {
+        report(name, (live_bytes() - before) / static_cast<double>(size), "bytes per resource");
+    }
+
+    void attributes(size_t size)
+    {
+        // Resource defaults are shared by every resource through the parent chain
+        auto defaults = make_shared<runtime::attributes>();
+        defaults->set(symbol("backup"), string("false"));
+        defaults->set(symbol("replace"), true);
+
+        // Intern the attribute names up front so that they are not counted for the first resource
+        create_attributes(0, defaults);
+
+        {
+            vector<shared_ptr<runtime::attributes>> resources;
+            resources.reserve(size);
+            auto before = live_bytes();
+            for (size_t i = 0; i < size; ++i) {
+                resources.emplace_back(create_attributes(i, defaults));
+            }
+            report_per_resource("attributes", before, size);
+
+            for (auto& attributes : resources) {
+                attributes->flatten();
+            }
+            report_per_resource("attributes after flattening", before, size);
+        }
+
+        // For comparison, the former layout: a hash map of string keys to shared values, with the parent kept in the chain
+        {
+            using former_attributes = unordered_map<string, shared_ptr<values::value>>;
+            auto former_defaults = make_shared<former_attributes>();
+            former_defaults->emplace("backup", make_shared<values::value>(string("false")));
+            former_defaults->emplace("replace", make_shared<values::value>(true));
+
+            vector<pair<shared_ptr<former_attributes>, shared_ptr<former_attributes>>> resources;
+            resources.reserve(size);
+            auto before = live_bytes();
+            for (size_t i = 0; i < size; ++i) {
+                auto attributes = make_shared<former_attributes>();
+                for (auto& attribute : file_attributes(i)) {
+                    attributes->emplace(rvalue_cast(attribute.first), make_shared<values::value>(rvalue_cast(attribute.second)));
+                }
+                resources.emplace_back(rvalue_cast(attributes), former_defaults);
+            }
+            report_per_resource("attributes in the former hash map layout", before, size);
+        }
+
+        // The whole catalog, including the resources, their index and the dependency graph
+        {
+            auto path = make_shared<string>("site.pp");
+            auto before = live_bytes();
+            runtime::catalog catalog;
+            for (size_t i = 0; i < size; ++i) {
+                catalog.add_resource(types::resource("File", "file" + to_string(i)), path, i + 1, create_attributes(i, defaults));
+            }
+            report_per_resource("catalog", before, size);
+        }
+    }
+
+}}  // namespace puppet::benchmark
@@ -0,0 +1,173 @@
+#include "benchmark.hpp"
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <vector>
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace {
+
+    atomic<size_t> allocated(0);
+
+    // Each allocation is prefixed with its size so that it can be subtracted when freed
+    union allocation_header
+    {
+        size_t size;
+        max_align_t alignment;
+    };
+
+}  // namespace
+
+void* operator new(size_t size)
+{
+    auto header = static_cast<allocation_header*>(malloc(sizeof(allocation_header) + size));
+    if (!header) {
+        throw bad_alloc();
+    }
+    header->size = size;
+    allocated += size;
+    return header + 1;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, nothrow_t const&) noexcept
+{
+    try {
+        return operator new(size);
+    } catch (bad_alloc const&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, nothrow_t const&) noexcept
+{
+    return operator new(size, nothrow);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (!pointer) {
+        return;
+    }
+    auto header = static_cast<allocation_header*>(pointer) - 1;
+    allocated -= header->size;
+    free(header);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, nothrow_t const&) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, nothrow_t const&) noexcept
+{
+    operator delete(pointer);
+}
+
+namespace puppet { namespace benchmark {
+
+    size_t counting_logger::messages() const
+    {
+        return _messages;
+    }
+
+    ostream& counting_logger::get_stream(logging::level level) const
+    {
+        // Discard what was logged so far so that the stream does not grow with the number of messages
+        ++_messages;
+        _stream.str({});
+        return _stream;
+    }
+
+    size_t live_bytes()
+    {
+        return allocated;
+    }
+
+    scratch_directory::scratch_directory() :
+        _path((fs::temp_directory_path() / fs::unique_path("puppet-benchmark-%%%%-%%%%-%%%%")).string())
+    {
+        fs::create_directories(_path);
+    }
+
+    scratch_directory::~scratch_directory()
+    {
+        boost::system::error_code ec;
+        fs::remove_all(_path, ec);
+    }
+
+    string const& scratch_directory::path() const
+    {
+        return _path;
+    }
+
+    string scratch_directory::write(string const& name, string const& contents) const
+    {
+        auto path = fs::path(_path) / name;
+        fs::create_directories(path.parent_path());
+        ofstream file(path.string(), ios::trunc | ios::binary);
+        file << contents;
+        return path.string();
+    }
+
+    double measure(string const& name, size_t runs, function<void()> const& callback)
+    {
+        vector<double> times;
+        for (size_t i = 0; i < runs; ++i) {
+            auto start = chrono::steady_clock::now();
+            callback();
+            times.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+        }
+        sort(times.begin(), times.end());
+        cout << boost::format("%1%: fastest %2$.1f ms, median %3$.1f ms, slowest %4$.1f ms (%5% runs)") % name % times.front() % times[times.size() / 2] % times.back() % runs << endl;
+        return times[times.size() / 2];
+    }
+
+    void report(string const& name, double value, string const& unit)
+    {
+        cout << boost::format("%1%: %2$.1f %3%") % name % value % unit << endl;
+    }
+
+    void report(string const& name, size_t value, string const& unit)
+    {
+        cout << boost::format("%1%: %2% %3%") % name % value % unit << endl;
+    }
+
+    string generate_classes(size_t classes)
+    {
+        ostringstream manifest;
+        for (size_t i = 0; i < classes; ++i) {
+            manifest <<
+                "class generated::class" << i << "($ensure = present, $size = " << i << ") {\n"
+                "  $settings = { 'name' => \"class" << i << "\", 'size' => $size, 'tags' => ['a', 'b', 'c'] }\n"
+                "  if $size > 10 and $ensure == present {\n"
+                "    file { \"/tmp/generated/${settings['name']}\": ensure => file, content => \"size is ${size}\" }\n"
+                "  } elsif $size == 0 {\n"
+                "    notify { \"empty class" << i << "\": }\n"
+                "  } else {\n"
+                "    notify { \"class" << i << " has ${size} items\": }\n"
+                "  }\n"
+                "}\n";
+        }
+        return manifest.str();
+    }
+
+}}  // namespace puppet::benchmark
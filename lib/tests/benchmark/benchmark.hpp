@@ -0,0 +1,156 @@
+/**
+ * @file
+ * Declares the helpers shared by the compiler benchmarks.
+ */
+#pragma once
+
+#include <puppet/logging/logger.hpp>
+#include <cstddef>
+#include <functional>
+#include <sstream>
+#include <string>
+
+namespace puppet { namespace benchmark {
+
+    /**
+     * A logger that counts messages rather than writing them, so that logging is measured but the console is not.
+     */
+    struct counting_logger : logging::stream_logger
+    {
+        /**
+         * Gets the number of messages that were logged.
+         * @return Returns the number of messages that were logged.
+         */
+        std::size_t messages() const;
+
+     protected:
+        /**
+         * Gets the stream to log messages to.
+         * @param level The log level of the message.
+         * @return Returns the stream to log messages to.
+         */
+        std::ostream& get_stream(logging::level level) const override;
+
+     private:
+        mutable std::ostringstream _stream;
+        mutable std::size_t _messages = 0;
+    };
+
+    /**
+     * Represents a temporary directory that is removed when it goes out of scope.
+     */
+    struct scratch_directory
+    {
+        /**
+         * Creates a uniquely named directory in the system's temporary directory.
+         */
+        scratch_directory();
+
+        /**
+         * Removes the directory and everything in it.
+         */
+        ~scratch_directory();
+
+        /**
+         * Gets the path of the directory.
+         * @return Returns the path of the directory.
+         */
+        std::string const& path() const;
+
+        /**
+         * Writes a file in the directory, creating any parent directories.
+         * @param name The path of the file, relative to the directory.
+         * @param contents The contents of the file.
+         * @return Returns the full path of the file.
+         */
+        std::string write(std::string const& name, std::string const& contents) const;
+
+     private:
+        scratch_directory(scratch_directory const&) = delete;
+        scratch_directory& operator=(scratch_directory const&) = delete;
+
+        std::string _path;
+    };
+
+    /**
+     * Runs a measurement a number of times and reports the fastest, median and slowest times.
+     * @param name The name of the measurement to report.
+     * @param runs The number of times to run the measurement.
+     * @param callback The callback to measure; it is timed as a whole.
+     * @return Returns the median time in milliseconds.
+     */
+    double measure(std::string const& name, std::size_t runs, std::function<void()> const& callback);
+
+    /**
+     * Reports a value measured by a benchmark.
+     * @param name The name of the value.
+     * @param value The value.
+     * @param unit The unit of the value.
+     */
+    void report(std::string const& name, double value, std::string const& unit);
+
+    /**
+     * Reports a count measured by a benchmark.
+     * @param name The name of the count.
+     * @param value The count.
+     * @param unit The unit of the count.
+     */
+    void report(std::string const& name, std::size_t value, std::string const& unit);
+
+    /**
+     * Gets the number of bytes currently allocated with operator new.
+     * The benchmark executable replaces the global allocation functions to keep this count.
+     * @return Returns the number of bytes currently allocated.
+     */
+    std::size_t live_bytes();
+
+    /**
+     * Generates a manifest of classes that use conditionals, resources, hashes and string interpolation.
+     * @param classes The number of classes to generate.
+     * @return Returns the source of the manifest.
+     */
+    std::string generate_classes(std::size_t classes);
+
+    /**
+     * Measures parsing a manifest without the syntax tree cache, with an empty cache and with a warm cache.
+     * @param size The number of classes in the generated manifest.
+     */
+    void cache(std::size_t size);
+
+    /**
+     * Measures looking up the text and column of warnings in a large manifest and logging them.
+     * @param size The number of warnings to log.
+     */
+    void warnings(std::size_t size);
+
+    /**
+     * Measures building the dependency graph of a large catalog and detecting the few dense cycles in it.
+     * @param size The number of resources in the catalog.
+     */
+    void cycles(std::size_t size);
+
+    /**
+     * Measures the memory used by the attributes of a large catalog.
+     * @param size The number of resources to declare.
+     */
+    void attributes(std::size_t size);
+
+    /**
+     * Measures relating many resources to a single resource, directly and through the relationship metaparameters.
+     * @param size The number of resources related to the single resource.
+     */
+    void relationships(std::size_t size);
+
+    /**
+     * Measures the throughput of the static and DFA lexers on a large manifest.
+     * @param size The number of classes in the manifest.
+     */
+    void lexer(std::size_t size);
+
+    /**
+     * Measures compiling an iteration heavy manifest with the tree walker and with the stack machine.
+     * @param size The number of iterations of the outer lambda.
+     */
+    void engines(std::size_t size);
+
+}}  // namespace puppet::benchmark
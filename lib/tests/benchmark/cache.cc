@@ -0,0 +1,41 @@
+#include "benchmark.hpp"
+#include <puppet/compiler/cache.hpp>
+#include <puppet/compiler/manifest.hpp>
+#include <boost/filesystem.hpp>
+#include <memory>
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace puppet { namespace benchmark {
+
+    void cache(size_t size)
+    {
+        static size_t const runs = 5;
+
+        scratch_directory directory;
+        auto path = make_shared<string>(directory.write("site.pp", generate_classes(size)));
+        report("manifest size", fs::file_size(*path) / 1024.0, "KiB");
+
+        counting_logger logger;
+        measure("no cache (parse only)", runs, [&]() {
+            compiler::manifest manifest(logger, path);
+        });
+
+        // Each cold run starts with an empty cache directory, so the tree is parsed and then stored
+        size_t run = 0;
+        measure("cold cache (parse and store)", runs, [&]() {
+            compiler::cache cache((fs::path(directory.path()) / ("cold" + to_string(run++))).string());
+            compiler::manifest manifest(logger, path, &cache);
+        });
+
+        // Store the tree once, then every run loads it
+        compiler::cache cache((fs::path(directory.path()) / "warm").string());
+        compiler::manifest stored(logger, path, &cache);
+        measure("warm cache (load)", runs, [&]() {
+            compiler::manifest manifest(logger, path, &cache);
+        });
+    }
+
+}}  // namespace puppet::benchmark
@@ -0,0 +1,70 @@
+#include "benchmark.hpp"
+#include <puppet/runtime/catalog.hpp>
+#include <puppet/compiler/exceptions.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace puppet::runtime;
+
+namespace puppet { namespace benchmark {
+
+    static void build(runtime::catalog& catalog, size_t size)
+    {
+        // A few small groups of resources that all depend on each other
+        static size_t const groups = 4;
+        static size_t const group_size = 50;
+
+        auto path = make_shared<string>("site.pp");
+        vector<runtime::resource*> resources;
+        resources.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            resources.push_back(&catalog.add_resource(types::resource("File", "/tmp/file" + to_string(i)), path, i + 1));
+        }
+
+        // Chain every resource to the next so that the rest of the graph is large but acyclic
+        for (size_t i = 1; i < size; ++i) {
+            resources[i - 1]->relate(relationship::before, *resources[i]);
+        }
+
+        // Spread the groups over the catalog; every pair of resources in a group forms a cycle
+        for (size_t group = 0; group < groups && size >= group_size; ++group) {
+            auto first = (size - group_size) / groups * group;
+            for (size_t i = first; i < first + group_size; ++i) {
+                for (size_t j = first; j < first + group_size; ++j) {
+                    if (i != j) {
+                        resources[i]->relate(relationship::require, *resources[j]);
+                    }
+                }
+            }
+        }
+    }
+
+    void cycles(size_t size)
+    {
+        static size_t const runs = 3;
+
+        measure("build the catalog", runs, [&]() {
+            runtime::catalog catalog;
+            build(catalog, size);
+        });
+
+        size_t edges = 0;
+        string message;
+        measure("build and finalize the catalog", runs, [&]() {
+            runtime::catalog catalog;
+            build(catalog, size);
+            try {
+                catalog.finalize();
+            } catch (compiler::compilation_exception const& ex) {
+                message = ex.what();
+            }
+            edges = boost::num_edges(catalog.graph());
+        });
+        report("dependency edges", edges, "edges");
+        report("cycles reported", static_cast<size_t>(count(message.begin(), message.end(), '\n')), "cycles");
+    }
+
+}}  // namespace puppet::benchmark
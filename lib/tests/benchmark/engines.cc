@@ -0,0 +1,59 @@
+#include "benchmark.hpp"
+#include <puppet/compiler/environment.hpp>
+#include <puppet/compiler/node.hpp>
+#include <puppet/compiler/settings.hpp>
+#include <boost/filesystem.hpp>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace puppet { namespace benchmark {
+
+    static string generate_iteration(size_t size)
+    {
+        // Every iteration binds parameters and locals, branches, interpolates and calls nested lambdas
+        ostringstream manifest;
+        manifest <<
+            "each(" << size << ") |$index| {\n"
+            "  $squared = $index * $index\n"
+            "  $parity = if $index % 2 == 0 { 'even' } else { 'odd' }\n"
+            "  $label = \"${parity}-${squared}\"\n"
+            "  $multiples = [1, 2, 3, 4, 5, 6, 7, 8].filter |$factor| { ($factor + $index) % 3 == 0 }\n"
+            "  $multiples.each |$factor| {\n"
+            "    $sum = $index + $factor * 2\n"
+            "    if $sum > 100 and $sum % 7 == 0 {\n"
+            "      $message = \"${label}/${sum}\"\n"
+            "    }\n"
+            "  }\n"
+            "}\n"
+            "notify { 'iterated': }\n";
+        return manifest.str();
+    }
+
+    void engines(size_t size)
+    {
+        static size_t const runs = 5;
+
+        scratch_directory directory;
+        auto environments = (fs::path(directory.path()) / "environments").string();
+        auto facts = directory.write("facts.yaml", "fqdn: benchmark.example.com\n");
+        auto path = directory.write("environments/production/manifests/site.pp", generate_iteration(size));
+
+        counting_logger logger;
+        auto compile = [&](char const* engine) {
+            vector<char const*> arguments = { "puppetcpp", "--environment-dir", environments.c_str(), "--facts", facts.c_str(), "--engine", engine, path.c_str() };
+            compiler::settings settings(static_cast<int>(arguments.size()), arguments.data());
+            compiler::environment environment(settings.environment(), settings.environment_directory());
+            compiler::node node(settings.node_name(), environment, settings.facts());
+            node.compile(logger, settings);
+        };
+
+        auto tree = measure("tree walker", runs, [&]() { compile("tree"); });
+        auto vm = measure("stack machine", runs, [&]() { compile("vm"); });
+        report("stack machine speedup", tree / vm, "x");
+    }
+
+}}  // namespace puppet::benchmark
@@ -0,0 +1,48 @@
+#include "benchmark.hpp"
+#include <puppet/lexer/static_lexer.hpp>
+#include <puppet/lexer/lexer.hpp>
+#include <puppet/lexer/dfa_lexer.hpp>
+#include <string>
+
+using namespace std;
+using namespace puppet::lexer;
+
+namespace puppet { namespace benchmark {
+
+    template <typename Lexer>
+    static size_t lex(string const& input)
+    {
+        auto input_begin = lex_begin(input);
+        auto input_end = lex_end(input);
+
+        Lexer lexer;
+        size_t tokens = 0;
+        for (auto token = lexer.begin(input_begin, input_end), end = lexer.end(); token != end && token_is_valid(*token); ++token) {
+            ++tokens;
+        }
+        return tokens;
+    }
+
+    template <typename Lexer>
+    static void measure_lexer(string const& name, string const& input)
+    {
+        static size_t const runs = 5;
+
+        size_t tokens = 0;
+        auto milliseconds = measure(name, runs, [&]() {
+            tokens = lex<Lexer>(input);
+        });
+        report(name + " tokens", tokens, "tokens");
+        report(name + " throughput", input.size() / (1024.0 * 1024.0) / (milliseconds / 1000.0), "MiB/s");
+    }
+
+    void lexer(size_t size)
+    {
+        auto input = generate_classes(size);
+        report("manifest size", input.size() / 1024.0, "KiB");
+
+        measure_lexer<string_static_lexer>("static lexer", input);
+        measure_lexer<string_dfa_lexer>("DFA lexer", input);
+    }
+
+}}  // namespace puppet::benchmark
@@ -0,0 +1,72 @@
+#include "benchmark.hpp"
+#include <boost/lexical_cast.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace puppet;
+
+namespace {
+
+    struct benchmark_entry
+    {
+        char const* name;
+        char const* description;
+        size_t default_size;
+        void (*run)(size_t);
+    };
+
+    benchmark_entry const benchmarks[] = {
+        { "cache", "parse a manifest of SIZE classes without the syntax tree cache, cold and warm", 3000, &benchmark::cache },
+        { "warnings", "log SIZE warnings with their line text against a manifest of 20000 classes", 100000, &benchmark::warnings },
+        { "cycles", "finalize a catalog of SIZE chained resources with four groups of 50 resources that depend on each other", 200000, &benchmark::cycles },
+        { "attributes", "measure the memory used by the attributes of SIZE file resources", 100000, &benchmark::attributes },
+        { "relationships", "relate SIZE file resources to a single package resource", 10000, &benchmark::relationships },
+        { "lexer", "lex a manifest of SIZE classes with the static and DFA lexers", 20000, &benchmark::lexer },
+        { "engines", "compile a manifest that iterates SIZE times over nested lambdas with the tree walker and the stack machine", 20000, &benchmark::engines },
+    };
+
+    void print_usage()
+    {
+        cout << "usage: puppet_benchmark BENCHMARK [SIZE]\n\nbenchmarks:\n";
+        for (auto const& benchmark : benchmarks) {
+            cout << "  " << benchmark.name << ": " << benchmark.description << " (default size " << benchmark.default_size << ")\n";
+        }
+    }
+
+}  // namespace
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2 || argc > 3) {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    for (auto const& benchmark : benchmarks) {
+        if (argv[1] != string(benchmark.name)) {
+            continue;
+        }
+        auto size = benchmark.default_size;
+        if (argc == 3) {
+            try {
+                size = boost::lexical_cast<size_t>(argv[2]);
+            } catch (boost::bad_lexical_cast const&) {
+                cerr << "error: expected a number for the size but found '" << argv[2] << "'." << endl;
+                return EXIT_FAILURE;
+            }
+        }
+        try {
+            benchmark.run(size);
+        } catch (exception const& ex) {
+            cerr << "error: " << ex.what() << endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    cerr << "error: unknown benchmark '" << argv[1] << "'." << endl;
+    print_usage();
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,64 @@
+#include "benchmark.hpp"
+#include <puppet/runtime/catalog.hpp>
+#include <puppet/cast.hpp>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace puppet::runtime;
+
+namespace puppet { namespace benchmark {
+
+    static vector<runtime::resource*> declare_files(runtime::catalog& catalog, size_t size, bool require_package)
+    {
+        static const symbol require_parameter("require");
+
+        auto path = make_shared<string>("site.pp");
+        vector<runtime::resource*> files;
+        files.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            shared_ptr<runtime::attributes> attributes;
+            if (require_package) {
+                attributes = make_shared<runtime::attributes>();
+                attributes->set(require_parameter, values::array{ types::resource("Package", "package") });
+            }
+            files.push_back(&catalog.add_resource(types::resource("File", "/tmp/file" + to_string(i)), path, i + 2, rvalue_cast(attributes)));
+        }
+        return files;
+    }
+
+    void relationships(size_t size)
+    {
+        static size_t const runs = 3;
+        static const symbol before_parameter("before");
+
+        auto path = make_shared<string>("site.pp");
+
+        // Package['package'] -> File[...] for every file, as the relationship operator does
+        measure("relate the package before every file", runs, [&]() {
+            runtime::catalog catalog;
+            auto& package = catalog.add_resource(types::resource("Package", "package"), path, 1);
+            for (auto file : declare_files(catalog, size, false)) {
+                package.relate(relationship::before, *file);
+            }
+        });
+
+        // For comparison, the operator used to append each file to the package's before attribute, skipping duplicates
+        measure("append every file to the package's before attribute", runs, [&]() {
+            runtime::catalog catalog;
+            auto& package = catalog.add_resource(types::resource("Package", "package"), path, 1);
+            for (auto file : declare_files(catalog, size, false)) {
+                package.attributes().append(before_parameter, file->type(), true);
+            }
+        });
+
+        // Every file requires the package through its metaparameter; finalizing relates them and builds the graph
+        measure("declare files that require the package and finalize", runs, [&]() {
+            runtime::catalog catalog;
+            catalog.add_resource(types::resource("Package", "package"), path, 1);
+            declare_files(catalog, size, true);
+            catalog.finalize();
+        });
+    }
+
+}}  // namespace puppet::benchmark
@@ -0,0 +1,60 @@
+#include "benchmark.hpp"
+#include <puppet/lexer/lexer.hpp>
+#include <puppet/lexer/source_buffer.hpp>
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+using namespace puppet::lexer;
+
+namespace puppet { namespace benchmark {
+
+    void warnings(size_t size)
+    {
+        static size_t const classes = 20000;
+        static size_t const runs = 3;
+
+        scratch_directory directory;
+        auto path = directory.write("site.pp", generate_classes(classes));
+        source_buffer source(path);
+        report("manifest size", source.size() / 1024.0, "KiB");
+        report("manifest lines", source.lines(), "lines");
+
+        // Spread the warnings evenly over the manifest so that every lookup is for a different part of the file
+        vector<position> positions;
+        positions.reserve(size);
+        size_t line = 1;
+        size_t counted = 0;
+        for (size_t i = 0; i < size; ++i) {
+            auto offset = static_cast<size_t>(static_cast<double>(i) / size * source.size());
+            line += count(source.data() + counted, source.data() + offset, '\n');
+            counted = offset;
+            positions.emplace_back(offset, line);
+        }
+
+        // Log the warnings the way a compilation context does: look up the line's text and column, then log it with them
+        counting_logger logger;
+        measure("source buffer line index", runs, [&]() {
+            for (auto const& position : positions) {
+                string text;
+                size_t column;
+                tie(text, column) = get_text_and_column(source, position.offset());
+                logger.log(logging::level::warning, position.line(), column, text, path, "node '%1%': %2%", "benchmark", "this is deprecated.");
+            }
+        });
+
+        // For comparison, the file stream lookup seeks backwards through the file and reads the line for every warning
+        measure("file stream seek and read", runs, [&]() {
+            ifstream file(path);
+            for (auto const& position : positions) {
+                string text;
+                size_t column;
+                tie(text, column) = get_text_and_column(file, position.offset());
+                logger.log(logging::level::warning, position.line(), column, text, path, "node '%1%': %2%", "benchmark", "this is deprecated.");
+            }
+        });
+        report("warnings logged per run", logger.messages() / (runs * 2), "messages");
+    }
+
+}}  // namespace puppet::benchmark
@@ -0,0 +1,102 @@
+#include <catch.hpp>
+#include <puppet/compiler/autoloader.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+using namespace std;
+using namespace puppet;
+
+namespace fs = boost::filesystem;
+
+static string const modules = FIXTURES_DIR "autoloader/modules";
+static string const other = FIXTURES_DIR "autoloader/other";
+
+static void require_location(compiler::autoloader& autoloader, string const& name, string const& path)
+{
+    auto location = autoloader.find(name);
+    REQUIRE(location);
+    REQUIRE(fs::path(location->path) == fs::path(path));
+}
+
+SCENARIO("finding definitions in modules")
+{
+    compiler::autoloader autoloader({ modules, other });
+
+    THEN("classes and defined types at top-level or directly inside a class should be found") {
+        require_location(autoloader, "foo", modules + "/foo/manifests/init.pp");
+        require_location(autoloader, "foo::nested", modules + "/foo/manifests/init.pp");
+        require_location(autoloader, "foo::vhost", modules + "/foo/manifests/init.pp");
+        require_location(autoloader, "Foo::Bar", modules + "/foo/manifests/bar.pp");
+        require_location(autoloader, "foo::bar::baz", modules + "/foo/manifests/bar/baz.pp");
+        require_location(autoloader, "::baz", modules + "/baz/manifests/init.pp");
+    }
+    THEN("earlier module directories should take precedence") {
+        require_location(autoloader, "foo", modules + "/foo/manifests/init.pp");
+        require_location(autoloader, "foo::other", other + "/foo/manifests/init.pp");
+    }
+    THEN("definitions in strings, nested blocks, and defined types should not be found") {
+        REQUIRE_FALSE(autoloader.find("foo::not_a_class"));
+        REQUIRE_FALSE(autoloader.find("foo::bar::not_a_class"));
+        REQUIRE_FALSE(autoloader.find("foo::nested::not_definable"));
+        REQUIRE_FALSE(autoloader.find("foo::bar::baz::not_definable"));
+        REQUIRE_FALSE(autoloader.find("file"));
+    }
+}
+
+SCENARIO("persisting the definition index")
+{
+    auto directory = fs::temp_directory_path() / fs::unique_path();
+    auto index = (directory / "autoload.index").string();
+
+    {
+        compiler::autoloader autoloader({ modules }, index);
+        REQUIRE(autoloader.find("foo"));
+    }
+    REQUIRE(fs::exists(index));
+
+    WHEN("the index is read by another autoloader") {
+        compiler::autoloader autoloader({ modules }, index);
+        THEN("it should find the same definitions") {
+            require_location(autoloader, "foo::bar", modules + "/foo/manifests/bar.pp");
+            REQUIRE_FALSE(autoloader.find("foo::other"));
+        }
+    }
+    WHEN("the index was built for different module directories") {
+        compiler::autoloader autoloader({ other, modules }, index);
+        THEN("it should be rebuilt") {
+            require_location(autoloader, "foo", other + "/foo/manifests/init.pp");
+            require_location(autoloader, "foo::other", other + "/foo/manifests/init.pp");
+        }
+    }
+
+    fs::remove_all(directory);
+}
+
+SCENARIO("finding definitions in changed manifests")
+{
+    auto directory = fs::temp_directory_path() / fs::unique_path();
+    auto manifests = directory / "foo" / "manifests";
+    fs::create_directories(manifests);
+    auto path = (manifests / "init.pp").string();
+    ofstream(path) << "class foo {}\n";
+
+    compiler::autoloader autoloader({ directory.string() });
+    require_location(autoloader, "foo", path);
+
+    WHEN("the manifest is changed without changing its size or modification time") {
+        // Simulate a change made within the same clock tick as the scan
+        struct stat info;
+        REQUIRE(stat(path.c_str(), &info) == 0);
+        ofstream(path, ios::trunc) << "class fox {}\n";
+        timespec const times[2] = { info.st_atim, info.st_mtim };
+        REQUIRE(utimensat(AT_FDCWD, path.c_str(), times, 0) == 0);
+        THEN("the manifest should be scanned again") {
+            REQUIRE_FALSE(autoloader.find("foo"));
+            require_location(autoloader, "fox", path);
+        }
+    }
+
+    fs::remove_all(directory);
+}
@@ -0,0 +1,151 @@
+#include <catch.hpp>
+#include <puppet/compiler/environment.hpp>
+#include <puppet/compiler/node.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+using namespace std;
+using namespace puppet;
+
+namespace fs = boost::filesystem;
+
+struct counting_logger : logging::stream_logger
+{
+    size_t parses() const
+    {
+        // The manifest logs a debug message each time it parses a file
+        auto output = _stream.str();
+        size_t count = 0;
+        for (auto position = output.find("parsing '"); position != string::npos; position = output.find("parsing '", position + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+ protected:
+    ostream& get_stream(logging::level) const override
+    {
+        return _stream;
+    }
+
+ private:
+    mutable ostringstream _stream;
+};
+
+static void write_file(string const& path, string const& contents)
+{
+    ofstream file(path, ios::trunc);
+    file << contents;
+}
+
+SCENARIO("sharing manifests between nodes")
+{
+    auto directory = fs::temp_directory_path() / fs::unique_path();
+    fs::create_directories(directory);
+    auto path = (directory / "site.pp").string();
+    write_file(path, "notice('first')\n");
+
+    compiler::environment environment("production", directory.string());
+    compiler::node first_node("first.example.com", environment, nullptr);
+    compiler::node second_node("second.example.com", environment, nullptr);
+
+    WHEN("a manifest is loaded twice") {
+        counting_logger logger;
+        logger.level(logging::level::debug);
+        auto first = environment.load(logger, first_node, path);
+        auto second = environment.load(logger, second_node, path);
+        THEN("both nodes should share the manifest") {
+            REQUIRE(first->manifest() == second->manifest());
+            REQUIRE(logger.parses() == 1);
+        }
+        AND_WHEN("the file is changed") {
+            write_file(path, "notice('second')\nnotice('third')\n");
+            auto third = environment.load(logger, first_node, path);
+            THEN("the manifest should be parsed again") {
+                REQUIRE(third->manifest() != first->manifest());
+                REQUIRE(third->tree().body()->size() == 2);
+                REQUIRE(logger.parses() == 2);
+            }
+        }
+        AND_WHEN("the file is changed without changing its size or modification time") {
+            // Simulate a change made within the same clock tick as the load
+            struct stat info;
+            REQUIRE(stat(path.c_str(), &info) == 0);
+            write_file(path, "$x=12\nnotice(1)\n");
+            timespec const times[2] = { info.st_atim, info.st_mtim };
+            REQUIRE(utimensat(AT_FDCWD, path.c_str(), times, 0) == 0);
+            auto third = environment.load(logger, first_node, path);
+            THEN("the manifest should be parsed again") {
+                REQUIRE(third->manifest() != first->manifest());
+                REQUIRE(third->tree().body()->size() == 2);
+                REQUIRE(logger.parses() == 2);
+            }
+        }
+    }
+    WHEN("two threads load the same manifest at the same time") {
+        counting_logger first_logger;
+        counting_logger second_logger;
+        first_logger.level(logging::level::debug);
+        second_logger.level(logging::level::debug);
+        shared_ptr<compiler::context> first;
+        shared_ptr<compiler::context> second;
+        thread other([&]() { second = environment.load(second_logger, second_node, path); });
+        first = environment.load(first_logger, first_node, path);
+        other.join();
+        THEN("the manifest should only be parsed once") {
+            REQUIRE(first->manifest() == second->manifest());
+            auto parses = first_logger.parses() + second_logger.parses();
+            REQUIRE(parses == 1);
+        }
+    }
+
+    fs::remove_all(directory);
+}
+
+SCENARIO("parsing deferred bodies of a shared manifest")
+{
+    auto directory = fs::temp_directory_path() / fs::unique_path();
+    fs::create_directories(directory);
+    auto path = (directory / "site.pp").string();
+    write_file(path, "class foo {\n  notice('foo')\n  notice('bar')\n}\n");
+
+    compiler::environment environment("production", directory.string());
+    compiler::node node("first.example.com", environment, nullptr);
+    counting_logger logger;
+    auto context = environment.load(logger, node, path, nullptr, true);
+    auto catalog = boost::get<ast::catalog_expression>(&context->tree().body()->at(0).primary());
+    REQUIRE(catalog);
+    auto klass = boost::get<ast::class_definition_expression>(catalog);
+    REQUIRE(klass);
+    REQUIRE_FALSE(klass->body_parsed());
+
+    WHEN("many threads evaluate the definition at the same time") {
+        atomic<size_t> parses(0);
+        vector<thread> threads;
+        for (size_t i = 0; i < 4; ++i) {
+            threads.emplace_back([&]() {
+                if (context->manifest()->parse_body(*klass)) {
+                    ++parses;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        THEN("the body should be parsed once and then read without parsing again") {
+            REQUIRE(parses == 1);
+            REQUIRE(klass->body_parsed());
+            REQUIRE(klass->body());
+            REQUIRE(klass->body()->size() == 2);
+            REQUIRE_FALSE(context->manifest()->parse_body(*klass));
+        }
+    }
+
+    fs::remove_all(directory);
+}
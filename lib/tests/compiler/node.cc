@@ -0,0 +1,128 @@
+#include <catch.hpp>
+#include "../test_logger.hpp"
+#include <puppet/compiler/node.hpp>
+#include <puppet/compiler/environment.hpp>
+#include <puppet/compiler/exceptions.hpp>
+#include <puppet/compiler/settings.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace puppet;
+
+namespace fs = boost::filesystem;
+
+static string const fixtures = FIXTURES_DIR "node";
+
+static string manifest(string const& name)
+{
+    return (fs::path(fixtures) / "environments" / "production" / "manifests" / name).string();
+}
+
+static compiler::settings create_settings(vector<string> const& options, vector<string> const& manifests)
+{
+    auto environments = (fs::path(fixtures) / "environments").string();
+    auto facts = (fs::path(fixtures) / "facts.yaml").string();
+    vector<char const*> arguments = { "puppetcpp", "--environment-dir", environments.c_str(), "--facts", facts.c_str() };
+    for (auto const& option : options) {
+        arguments.push_back(option.c_str());
+    }
+    for (auto const& manifest : manifests) {
+        arguments.push_back(manifest.c_str());
+    }
+    return compiler::settings(static_cast<int>(arguments.size()), arguments.data());
+}
+
+SCENARIO("parsing manifests in parallel")
+{
+    test_logger logger;
+
+    WHEN("more than one manifest fails to parse") {
+        // The first failing manifest is the larger one, so it is likely to fail after the second
+        auto settings = create_settings({ "--jobs", "4" }, { manifest("good.pp"), manifest("first_bad.pp"), manifest("good.pp"), manifest("second_bad.pp") });
+        compiler::environment environment(settings.environment(), settings.environment_directory());
+        compiler::node node(settings.node_name(), environment, settings.facts());
+        THEN("the first failure in manifest order should be reported") {
+            for (int attempt = 0; attempt < 10; ++attempt) {
+                string path;
+                try {
+                    node.compile(logger, settings);
+                } catch (compiler::compilation_exception const& ex) {
+                    path = ex.path();
+                }
+                REQUIRE(path == manifest("first_bad.pp"));
+            }
+        }
+    }
+}
+
+SCENARIO("declaring defined types")
+{
+    test_logger logger;
+
+    WHEN("defined types are declared by their lowercase names") {
+        auto settings = create_settings({}, { manifest("defined_types.pp") });
+        compiler::environment environment(settings.environment(), settings.environment_directory());
+        compiler::node node(settings.node_name(), environment, settings.facts());
+        auto catalog = node.compile(logger, settings);
+        THEN("both manifest and module defined types should be found, as their names are not case sensitive") {
+            REQUIRE(catalog.find_resource(runtime::types::resource("Local::Thing", "one")));
+            REQUIRE(catalog.find_resource(runtime::types::resource("Notify", "local one")));
+            REQUIRE(catalog.find_resource(runtime::types::resource("Widget::Part", "two")));
+            REQUIRE(catalog.find_resource(runtime::types::resource("Notify", "widget two")));
+        }
+    }
+}
+
+static string compile(string const& engine, string const& path)
+{
+    test_logger logger;
+    auto settings = create_settings({ "--engine", engine }, { path });
+    compiler::environment environment(settings.environment(), settings.environment_directory());
+    compiler::node node(settings.node_name(), environment, settings.facts());
+
+    // Compare the catalog, or the error if the manifest fails to compile
+    ostringstream output;
+    try {
+        auto catalog = node.compile(logger, settings);
+        catalog.write(output, node.name(), settings.environment());
+    } catch (compiler::compilation_exception const& ex) {
+        output << boost::format("error: %1%:%2%:%3%: %4%") % ex.path() % ex.line() % ex.column() % ex.what();
+    }
+    return output.str();
+}
+
+SCENARIO("compiling with the stack machine")
+{
+    WHEN("the manifests of the corpus are compiled with both engines") {
+        vector<string> corpus = {
+            manifest("good.pp"),
+            manifest("defined_types.pp"),
+            manifest("engines/operators.pp"),
+            manifest("engines/iteration.pp"),
+            manifest("engines/reassigned.pp"),
+            manifest("engines/duplicate_parameter.pp"),
+            manifest("engines/unproductive.pp"),
+        };
+        THEN("the stack machine should produce the same catalog or error as the tree walker") {
+            for (auto const& path : corpus) {
+                auto tree = compile("tree", path);
+                CAPTURE(path);
+                CAPTURE(tree);
+                REQUIRE(compile("vm", path) == tree);
+            }
+        }
+    }
+    WHEN("the manifests of the corpus are compiled with the tree walker") {
+        THEN("they should cover both catalogs and errors") {
+            REQUIRE(compile("tree", manifest("engines/operators.pp")).find("\"title\": \"class 40\"") != string::npos);
+            REQUIRE(compile("tree", manifest("engines/iteration.pp")).find("\"title\": \"even 4\"") != string::npos);
+            REQUIRE(compile("tree", manifest("engines/reassigned.pp")).find("cannot assign to $value: variable was previously assigned at") != string::npos);
+            REQUIRE(compile("tree", manifest("engines/duplicate_parameter.pp")).find("parameter $value already exists in the parameter list.") != string::npos);
+            REQUIRE(compile("tree", manifest("engines/unproductive.pp")).find("unproductive expressions may only appear last in a block.") != string::npos);
+        }
+    }
+}
@@ -0,0 +1,151 @@
+#include <catch.hpp>
+#include <puppet/compiler/parser.hpp>
+#include <puppet/ast/serialization.hpp>
+#include <puppet/lexer/source_buffer.hpp>
+#include <fstream>
+#include <sstream>
+#include <boost/format.hpp>
+
+using namespace std;
+using namespace puppet;
+
+static string serialize(ast::syntax_tree const& tree)
+{
+    ostringstream ss;
+    ast::serialize(ss, tree);
+    return ss.str();
+}
+
+static string parse(string const& input, bool grammar)
+{
+    // Serialize the tree so that every node and position is compared
+    try {
+        return serialize(grammar ? compiler::parser::parse_with_grammar(input) : compiler::parser::parse(input));
+    } catch (compiler::parse_exception const& ex) {
+        return (boost::format("error @%1%:%2%: %3%") % ex.position().offset() % ex.position().line() % ex.what()).str();
+    }
+}
+
+static size_t parse_deferred_bodies(lexer::source_buffer const& buffer, boost::optional<vector<ast::expression>> const& expressions);
+
+template <typename Expression>
+static size_t parse_deferred_body(lexer::source_buffer const& buffer, Expression const& expression)
+{
+    size_t count = 0;
+    if (expression.deferred_body()) {
+        expression.body(compiler::parser::parse_body(buffer, *expression.deferred_body()));
+        ++count;
+    }
+    return count + parse_deferred_bodies(buffer, expression.body());
+}
+
+static size_t parse_deferred_bodies(lexer::source_buffer const& buffer, boost::optional<vector<ast::expression>> const& expressions)
+{
+    // Parse the deferred bodies of the definitions, including definitions nested in other definitions
+    size_t count = 0;
+    if (!expressions) {
+        return count;
+    }
+    for (auto const& expression : *expressions) {
+        auto catalog = boost::get<ast::catalog_expression>(&expression.primary());
+        if (!catalog) {
+            continue;
+        }
+        if (auto klass = boost::get<ast::class_definition_expression>(catalog)) {
+            count += parse_deferred_body(buffer, *klass);
+        } else if (auto type = boost::get<ast::defined_type_expression>(catalog)) {
+            count += parse_deferred_body(buffer, *type);
+        } else if (auto node = boost::get<ast::node_definition_expression>(catalog)) {
+            count += parse_deferred_body(buffer, *node);
+        }
+    }
+    return count;
+}
+
+static void require_same_tree(string const& input)
+{
+    CAPTURE(input);
+
+    auto expected = parse(input, true);
+    auto actual = parse(input, false);
+    REQUIRE(actual == expected);
+}
+
+SCENARIO("recursive descent parser produces the same syntax tree as the grammar for fixtures")
+{
+    for (auto fixture : {
+        "ast/expressions.pp",
+        "parser/control_flow.pp",
+        "parser/definitions.pp",
+        "parser/resources.pp"
+    }) {
+        CAPTURE(fixture);
+
+        ifstream file(string(FIXTURES_DIR) + fixture);
+        REQUIRE(file);
+        ostringstream contents;
+        contents << file.rdbuf();
+
+        require_same_tree(contents.str());
+    }
+}
+
+SCENARIO("recursive descent parser reports the same errors as the grammar")
+{
+    for (auto input : {
+        "",
+        ";",
+        "$x = ",
+        "$x = 1 +",
+        "notice(1",
+        "[1, 2",
+        "{ 'a' => 1",
+        "{ 'a' 1 }",
+        "(1 + 2",
+        "if $x { notice(1)",
+        "if $x notice(1)",
+        "unless { }",
+        "case $x { }",
+        "case $x { 1: notice(1) }",
+        "$x ? { 1 2 }",
+        "$x ? { }",
+        "$x[]",
+        "$x.",
+        "$x.foo(1",
+        "foo() |$x { }",
+        "class { }",
+        "class foo(",
+        "class foo inherits { }",
+        "define foo { ",
+        "node { }",
+        "file { 'x': ensure }",
+        "file { 'x': ensure => }",
+        "@file { }",
+        "@@ { 'x': }",
+        "File { mode => }",
+        "File['x'] { mode }",
+        "User <| title |>",
+        "User <| title == |>",
+        "User <| title == 'x' and |>",
+        "User <| title == 'x'",
+        "- ",
+        "$x = 1 }",
+        "$x = 1 ~",
+        "notice(\"${x\")",
+        "notice(\"${1 +}\")",
+    }) {
+        require_same_tree(input);
+    }
+}
+
+SCENARIO("deferring definition bodies")
+{
+    lexer::source_buffer buffer(string(FIXTURES_DIR) + "parser/deferred.pp");
+    auto expected = compiler::parser::parse(buffer);
+    auto tree = compiler::parser::parse(buffer, false, true);
+    REQUIRE(tree.body());
+
+    // Bodies that contain definitions or follow a heredoc in the signature are not deferred
+    REQUIRE(parse_deferred_bodies(buffer, tree.body()) == 8);
+    REQUIRE(serialize(tree) == serialize(expected));
+}
@@ -0,0 +1,62 @@
+#include <catch.hpp>
+#include "../test_logger.hpp"
+#include <puppet/compiler/process_pool.hpp>
+#include <stdexcept>
+#include <unistd.h>
+
+using namespace std;
+using namespace puppet;
+
+SCENARIO("running jobs in worker processes")
+{
+    test_logger logger;
+    compiler::process_pool pool(3);
+
+    WHEN("jobs are run") {
+        auto parent = getpid();
+        auto results = pool.run(logger, 20, [&](size_t job, size_t) {
+            // Jobs run in the workers, never in the calling process
+            return getpid() != parent && job % 5 != 0;
+        });
+        THEN("each job should complete in a worker and the failures should be counted") {
+            REQUIRE(results.jobs.size() == 20u);
+            for (size_t i = 0; i < results.jobs.size(); ++i) {
+                REQUIRE(results.jobs[i].completed);
+                REQUIRE(results.jobs[i].succeeded == (i % 5 != 0));
+            }
+            REQUIRE(results.workers.size() == 3u);
+            size_t jobs = 0;
+            size_t failed = 0;
+            for (auto const& worker : results.workers) {
+                REQUIRE(worker.exited);
+                REQUIRE(worker.peak_resident > 0u);
+                jobs += worker.jobs;
+                failed += worker.failed;
+            }
+            REQUIRE(jobs == 20u);
+            REQUIRE(failed == 4u);
+        }
+    }
+    WHEN("there are fewer jobs than workers") {
+        auto results = pool.run(logger, 2, [&](size_t, size_t) { return true; });
+        THEN("only one worker per job should be forked") {
+            REQUIRE(results.workers.size() == 2u);
+        }
+    }
+    WHEN("workers log errors and warnings") {
+        auto results = pool.run(logger, 4, [&](size_t job, size_t) -> bool {
+            if (job == 1) {
+                logger.log(logging::level::warning, "warning");
+            } else if (job == 2) {
+                throw runtime_error("failed");
+            }
+            return true;
+        });
+        THEN("the counts should be added to the parent's logger") {
+            REQUIRE(results.jobs[2].completed);
+            REQUIRE_FALSE(results.jobs[2].succeeded);
+            REQUIRE(logger.warnings() == 1u);
+            REQUIRE(logger.errors() == 1u);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include <catch.hpp>
+#include <puppet/compiler/scheduler.hpp>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace puppet;
+
+SCENARIO("scheduling jobs")
+{
+    compiler::scheduler scheduler(4);
+
+    WHEN("jobs are run") {
+        vector<atomic<size_t>> runs(100);
+        vector<size_t> workers(runs.size());
+        scheduler.run(runs.size(), [&](size_t job, size_t worker) {
+            ++runs[job];
+            workers[job] = worker;
+        });
+        THEN("each job should be run exactly once by a valid worker") {
+            for (size_t i = 0; i < runs.size(); ++i) {
+                REQUIRE(runs[i] == 1u);
+                REQUIRE(workers[i] < scheduler.workers());
+            }
+        }
+    }
+    WHEN("one worker's share of the jobs is slow") {
+        // Jobs 0 and 1 are the first worker's share; job 0 waits for job 1, so job 1 must be stolen by another worker
+        atomic<bool> stolen(false);
+        bool waited = false;
+        scheduler.run(8, [&](size_t job, size_t) {
+            if (job == 0) {
+                auto timeout = chrono::steady_clock::now() + chrono::seconds(10);
+                while (!stolen && chrono::steady_clock::now() < timeout) {
+                    this_thread::sleep_for(chrono::milliseconds(1));
+                }
+                waited = stolen;
+            } else if (job == 1) {
+                stolen = true;
+            }
+        });
+        THEN("another worker should steal the waiting job") {
+            REQUIRE(waited);
+        }
+    }
+    WHEN("jobs throw exceptions") {
+        atomic<size_t> runs(0);
+        string message;
+        try {
+            scheduler.run(10, [&](size_t job, size_t) {
+                ++runs;
+                if (job == 3 || job == 7) {
+                    throw runtime_error("job " + to_string(job));
+                }
+            });
+        } catch (runtime_error const& ex) {
+            message = ex.what();
+        }
+        THEN("every job should run and the first failure should be rethrown") {
+            REQUIRE(message == "job 3");
+            REQUIRE(runs == 10u);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include <catch.hpp>
+#include "../test_logger.hpp"
+#include <puppet/compiler/server.hpp>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace puppet;
+
+namespace fs = boost::filesystem;
+
+static string const fixtures = FIXTURES_DIR "server";
+
+static compiler::settings create_settings(string const& directory, string const& socket = "unused.sock")
+{
+    auto environments = (fs::path(directory) / "environments").string();
+    auto site = (fs::path(directory) / "site.pp").string();
+    vector<char const*> arguments = { "puppetcpp", "--serve", socket.c_str(), "--environment-dir", environments.c_str(), site.c_str() };
+    return compiler::settings(static_cast<int>(arguments.size()), arguments.data());
+}
+
+static string request(string const& path, string const& body)
+{
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    // Wait for the server to start listening
+    int connection = -1;
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        connection = socket(AF_UNIX, SOCK_STREAM, 0);
+        REQUIRE(connection >= 0);
+        if (connect(connection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            break;
+        }
+        close(connection);
+        connection = -1;
+        this_thread::sleep_for(chrono::milliseconds(50));
+    }
+    REQUIRE(connection >= 0);
+
+    REQUIRE(write(connection, body.data(), body.size()) == static_cast<ssize_t>(body.size()));
+    shutdown(connection, SHUT_WR);
+
+    string response;
+    char buffer[4096];
+    ssize_t count;
+    while ((count = read(connection, buffer, sizeof(buffer))) > 0) {
+        response.append(buffer, count);
+    }
+    close(connection);
+    return response;
+}
+
+SCENARIO("compiling requests")
+{
+    test_logger logger;
+    auto settings = create_settings(fixtures);
+    compiler::server server(logger, settings);
+
+    WHEN("the request has facts") {
+        auto response = server.compile("{\"facts\": {\"fqdn\": \"web.example.com\"}}", logger);
+        THEN("the response should be the node's catalog") {
+            REQUIRE(response.find("\"name\": \"web.example.com\"") != string::npos);
+            REQUIRE(response.find("\"title\": \"/tmp/web.example.com\"") != string::npos);
+        }
+    }
+    WHEN("the request names the node") {
+        auto response = server.compile("{\"node\": \"db\", \"facts\": {\"fqdn\": \"db.example.com\"}}", logger);
+        THEN("the catalog should be for the named node") {
+            REQUIRE(response.find("\"name\": \"db\"") != string::npos);
+        }
+    }
+    WHEN("the request is not valid") {
+        THEN("the response should be an error") {
+            REQUIRE(server.compile("{\"facts\": ", logger).find("{\"error\": \"invalid request: ") == 0);
+            REQUIRE(server.compile("{\"node\": \"db\"}", logger).find("{\"error\": \"invalid request: ") == 0);
+            REQUIRE(server.compile("{\"facts\": {}}", logger).find("{\"error\": \"invalid request: ") == 0);
+            REQUIRE(server.compile("{\"facts\": {\"fqdn\": \"db\"}, \"environment\": \"../production\"}", logger).find("{\"error\": \"invalid request: ") == 0);
+        }
+    }
+}
+
+SCENARIO("reloading changed manifests")
+{
+    auto directory = fs::temp_directory_path() / fs::unique_path();
+    auto manifest = directory / "environments" / "production" / "modules" / "greet" / "manifests" / "init.pp";
+    fs::create_directories(manifest.parent_path());
+    fs::copy_file(fs::path(fixtures) / "site.pp", directory / "site.pp");
+    fs::copy_file(fs::path(fixtures) / "environments" / "production" / "modules" / "greet" / "manifests" / "init.pp", manifest);
+
+    test_logger logger;
+    auto settings = create_settings(directory.string());
+    compiler::server server(logger, settings);
+    REQUIRE(server.compile("{\"facts\": {\"fqdn\": \"web\"}}", logger).find("\"title\": \"/tmp/web\"") != string::npos);
+
+    // Change the size of the manifest so the change is seen even if the modification time does not change
+    {
+        ofstream file(manifest.string(), ios::trunc);
+        file << "class greet {\n    file { \"/tmp/changed/${::fqdn}\": }\n}\n";
+    }
+    REQUIRE(server.compile("{\"facts\": {\"fqdn\": \"web\"}}", logger).find("\"title\": \"/tmp/changed/web\"") != string::npos);
+
+    fs::remove_all(directory);
+}
+
+SCENARIO("serving requests on a socket")
+{
+    auto socket = (fs::temp_directory_path() / fs::unique_path("%%%%-%%%%.sock")).string();
+
+    test_logger logger;
+    auto settings = create_settings(fixtures, socket);
+    compiler::server server(logger, settings);
+    thread serving([&]() { server.run(); });
+
+    auto response = request(socket, "{\"facts\": {\"fqdn\": \"web.example.com\"}}");
+
+    server.stop();
+    serving.join();
+
+    REQUIRE(response.find("\"title\": \"/tmp/web.example.com\"") != string::npos);
+    REQUIRE_FALSE(fs::exists(socket));
+}
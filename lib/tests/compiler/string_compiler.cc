@@ -0,0 +1,99 @@
+#include <catch.hpp>
+#include <puppet/compiler/parser.hpp>
+#include <puppet/ast/interpolated_string.hpp>
+#include <puppet/ast/expression_def.hpp>
+
+using namespace std;
+using namespace puppet;
+
+static ast::string parse_string(string const& source)
+{
+    auto tree = compiler::parser::parse(source);
+    REQUIRE(tree.body());
+    REQUIRE(tree.body()->size() == 1);
+    auto basic = boost::get<ast::basic_expression>(&tree.body()->front().primary());
+    REQUIRE(basic);
+    auto str = boost::get<ast::string>(basic);
+    REQUIRE(str);
+    REQUIRE(str->compiled());
+    return *str;
+}
+
+static string literal(ast::interpolated_string::segment const& segment)
+{
+    auto text = boost::get<string>(&segment);
+    REQUIRE(text);
+    return *text;
+}
+
+static vector<ast::expression> const& interpolation(ast::interpolated_string::segment const& segment)
+{
+    auto expressions = boost::get<vector<ast::expression>>(&segment);
+    REQUIRE(expressions);
+    return *expressions;
+}
+
+SCENARIO("compiling strings")
+{
+    WHEN("a single quoted string is parsed") {
+        auto str = parse_string("'a\\'b\\\\c $d'");
+        THEN("the escapes should be applied and no interpolation performed") {
+            auto& segments = str.compiled()->segments();
+            REQUIRE(segments.size() == 1);
+            REQUIRE(literal(segments[0]) == "a'b\\c $d");
+            REQUIRE(str.compiled()->warnings().empty());
+        }
+    }
+    WHEN("a double quoted string with interpolations is parsed") {
+        auto str = parse_string("\"a\\tb $x ${y[0]}\\n\"");
+        THEN("it should be split into literal and interpolation segments") {
+            auto& segments = str.compiled()->segments();
+            REQUIRE(segments.size() == 5);
+            REQUIRE(literal(segments[0]) == "a\tb ");
+            auto& variable = interpolation(segments[1]);
+            REQUIRE(variable.size() == 1);
+            auto basic = boost::get<ast::basic_expression>(&variable[0].primary());
+            REQUIRE(basic);
+            auto var = boost::get<ast::variable>(basic);
+            REQUIRE(var);
+            REQUIRE(var->name() == "x");
+            REQUIRE(var->position().offset() == 6);
+            REQUIRE(literal(segments[2]) == " ");
+            auto& access = interpolation(segments[3]);
+            REQUIRE(access.size() == 1);
+            auto postfix = boost::get<ast::postfix_expression>(&access[0].primary());
+            REQUIRE(postfix);
+            basic = boost::get<ast::basic_expression>(&postfix->primary());
+            REQUIRE(basic);
+            var = boost::get<ast::variable>(basic);
+            REQUIRE(var);
+            REQUIRE(var->name() == "y");
+            REQUIRE(var->position().offset() == 11);
+            REQUIRE(literal(segments[4]) == "\n");
+        }
+    }
+    WHEN("a double quoted string with an invalid escape sequence is parsed") {
+        auto str = parse_string("\"\\q\"");
+        THEN("a warning should be recorded") {
+            auto& warnings = str.compiled()->warnings();
+            REQUIRE(warnings.size() == 1);
+            REQUIRE(warnings[0].first.offset() == 1);
+            REQUIRE(warnings[0].second == "invalid escape sequence '\\q'.");
+            REQUIRE(literal(str.compiled()->segments().at(0)) == "\\q");
+        }
+    }
+    WHEN("a heredoc with a margin is parsed") {
+        auto str = parse_string("@(END/L)\n    first\n      second \\\n    third\n    |- END\n");
+        THEN("the margin should be removed") {
+            auto& segments = str.compiled()->segments();
+            REQUIRE(segments.size() == 1);
+            REQUIRE(literal(segments[0]) == "first\n  second third");
+        }
+    }
+    WHEN("an interpolation cannot be parsed") {
+        THEN("a parse exception should be thrown") {
+            REQUIRE_THROWS_AS(compiler::parser::parse("\"foo ${[}\""), compiler::parse_exception const&);
+            REQUIRE_THROWS_AS(compiler::parser::parse("\"foo $0x1\""), compiler::parse_exception const&);
+        }
+    }
+}
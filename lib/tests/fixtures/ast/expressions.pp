@@ -0,0 +1,58 @@
+# Exercises every kind of expression in the syntax tree
+$undef = undef
+$default = default
+$booleans = [true, false]
+$numbers = [0, 42, -7, 0x1F, 017, 1.5, 2e-3]
+$strings = ['single', "double ${undef}", @("END"/L)
+  heredoc ${numbers[0]}
+  | - END
+]
+$regex = /^foo.bar$/
+$hash = { 'key' => 'value', bare => Integer, empty => {}, nested => [[]] }
+$type = String[1, 10]
+
+if $numbers[1] > 10 and !$booleans[0] {
+    notice('if')
+} elsif $numbers[1] in $numbers {
+    notice('elsif')
+} else {
+    notice('else')
+}
+
+unless $undef =~ /foo/ {
+    info('unless')
+} else {
+    info('unless else')
+}
+
+case $numbers[1] {
+    1, 2: { notice('one or two') }
+    default: {}
+}
+
+$selected = $numbers[1] ? { 42 => 'answer', default => -$numbers[1] }
+$method = $numbers.each |$index, Integer *$value = 1| { notice($value * 2 / 3 % 4 + 5 - 6 << 1 >> 1) }
+$splat = foo(*$numbers)
+
+class foo::bar(String $x = 'x', $y) inherits foo {
+    file { '/tmp/foo':
+        ensure  => file,
+        content => $x,
+    }
+}
+
+define foo::baz($z = 1) {
+    @@package { ['a', 'b']: ensure => present }
+    @user { 'u': }
+}
+
+node default, 'example.com', /\.example\.org$/, www.example.net {
+    include foo::bar
+}
+
+File { mode => '0644' }
+File['/tmp/foo'] { owner +> root }
+Package['a'] -> Package['b'] ~> Service['c'] <- File['/tmp/foo'] <~ User['u']
+User <| title == 'u' and groups != 'wheel' or uid == 0 |>
+User <<| tag == 'exported' |>>
+$assigned = $numbers[1] != 1 or $numbers[2] <= 2 or $numbers[3] >= 3 or $numbers[4] < 4 or $undef !~ /bar/
@@ -0,0 +1,4 @@
+# Defines Class[Foo::Bar]
+class foo::bar inherits foo {
+    notice('class foo::bar::not_a_class {')
+}
@@ -0,0 +1,3 @@
+define foo::bar::baz($x = 1) {
+    class not_definable { }
+}
@@ -0,0 +1,9 @@
+class foo($value = { 'class' => 'foo::not_a_class' }) {
+    class nested {
+        if true {
+            class not_definable { }
+        }
+    }
+    define vhost { }
+    class { 'foo::bar': }
+}
@@ -0,0 +1,6 @@
+define local::thing {
+  notify { "local ${title}": }
+}
+
+local::thing { 'one': }
+widget::part { 'two': }
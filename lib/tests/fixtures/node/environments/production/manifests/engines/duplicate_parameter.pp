@@ -0,0 +1,3 @@
+with(1, 2) |$value, $value| {
+    notify { 'duplicate': }
+}
@@ -0,0 +1,58 @@
+$numbers = [1, 2, 3, 4, 5, 6]
+$prefix = 'outer'
+
+# Parameters and locals are bound to slots; unassigned names are looked up in the enclosing scopes
+$numbers.each |$index, $number| {
+    $squared = $number * $number
+    $label = "${prefix}-${index}"
+    if $squared > 10 {
+        $size = 'large'
+    } elsif $squared > 3 {
+        $size = 'medium'
+    } else {
+        $size = 'small'
+    }
+    $kind = case $number % 3 { 0: { 'three' } 1: { 'one' } default: { 'two' } }
+    notify { "number ${label}":
+        message => [$number, $squared, $size, $kind],
+    }
+}
+
+# Nested lambdas see the variables of the lambdas that enclose them, and may shadow them
+$evens = $numbers.filter |$number| { $number % 2 == 0 }
+each($evens) |$even| {
+    $doubled = $even * 2
+    $pairs = $numbers.filter |$number| {
+        $doubled = $number + $even
+        $doubled % 4 == 0 and $number != $even
+    }
+    with($doubled, $pairs) |$total, $matching = []| {
+        notify { "even ${even}": message => [$total, $matching, $doubled] }
+    }
+}
+
+# Hashes yield keys and values; the variables of one call are not seen by the next
+$settings = { 'a' => 1, 'b' => 2 }
+$settings.each |$key, $value| {
+    unless $key == 'b' {
+        $first = true
+    }
+    notify { "setting ${key}": message => [$value, $first, $value ? { 1 => 'one', default => 'many' }] }
+}
+
+# Match variables come from the match scopes of the if expressions in the lambda
+['abc', 'xyz'].each |$text| {
+    if $text =~ /^a(.)/ {
+        notify { "matched ${text}": message => $1 }
+    } else {
+        notify { "unmatched ${text}": message => [$text, $1] }
+    }
+}
+
+# Lambdas with captured and default parameters
+$captured = with(1, 2, 3) |$first, *$rest| { [$first, $rest] }
+$defaulted = with(1) |$first, $second = $first + 1| { $first + $second }
+$empty = with(1) |$unused| { }
+file { '/tmp/iteration':
+    content => "${captured} ${defaulted} ${empty}",
+}
@@ -0,0 +1,43 @@
+$arithmetic = 1 + 2 * 3 - 8 / 4 % 3 << 2
+$float = -$arithmetic * 2.5
+$collections = [1, 2, $arithmetic] + [[4, 5]]
+$hash = { 'a' => $arithmetic, 'b' => "${arithmetic} items", c => [$float] }
+$comparisons = [1 < 2, 2 <= 1, 'a' == 'A', $arithmetic != 7, 3 in [1, 2, 3], 'abc' =~ /b/]
+
+# The right operands would fail if they were evaluated
+$short_and = false and fail('and did not short circuit')
+$short_or = true or fail('or did not short circuit')
+$chained = 1 > 2 and fail('and did not short circuit') or 2 > 1 and !false
+
+# These are not compiled to bytecode and fall back to the tree walker
+$conditional = if $arithmetic == 20 { 'twenty' } else { 'other' }
+$matched = case $arithmetic { 20: { 'case' } default: { 'default' } }
+$selected = $arithmetic ? { 20 => 'selector', default => 'default' }
+$called = split("a,b,${arithmetic}", ',')
+$splatted = [*$collections, *[6]]
+
+class engines(
+    $value = $arithmetic * 2,
+) {
+    notify { "class ${value}":
+        message => [$value, $::hash['b'], $::called[2]],
+    }
+}
+
+define engines::define($value) {
+    notify { "define ${title}":
+        message => $value and $title,
+    }
+}
+
+include engines
+engines::define { ['one', 'two']: value => $short_or or $short_and }
+
+file { '/tmp/engines':
+    ensure  => present,
+    content => "${arithmetic} ${float} ${collections} ${hash}",
+    mode    => $comparisons,
+    owner   => [$short_and, $short_or, $chained],
+    group   => [$conditional, $matched, $selected, $called, $splatted],
+    require => Notify['class 40'],
+}
@@ -0,0 +1,4 @@
+[1, 2].each |$number| {
+    $value = $number
+    $value = $number + 1
+}
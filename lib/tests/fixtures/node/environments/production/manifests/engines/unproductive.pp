@@ -0,0 +1,4 @@
+with(1) |$value| {
+    $value + 1
+    notify { 'unproductive': }
+}
@@ -0,0 +1,201 @@
+notify { 'first 1': }
+notify { 'first 2': }
+notify { 'first 3': }
+notify { 'first 4': }
+notify { 'first 5': }
+notify { 'first 6': }
+notify { 'first 7': }
+notify { 'first 8': }
+notify { 'first 9': }
+notify { 'first 10': }
+notify { 'first 11': }
+notify { 'first 12': }
+notify { 'first 13': }
+notify { 'first 14': }
+notify { 'first 15': }
+notify { 'first 16': }
+notify { 'first 17': }
+notify { 'first 18': }
+notify { 'first 19': }
+notify { 'first 20': }
+notify { 'first 21': }
+notify { 'first 22': }
+notify { 'first 23': }
+notify { 'first 24': }
+notify { 'first 25': }
+notify { 'first 26': }
+notify { 'first 27': }
+notify { 'first 28': }
+notify { 'first 29': }
+notify { 'first 30': }
+notify { 'first 31': }
+notify { 'first 32': }
+notify { 'first 33': }
+notify { 'first 34': }
+notify { 'first 35': }
+notify { 'first 36': }
+notify { 'first 37': }
+notify { 'first 38': }
+notify { 'first 39': }
+notify { 'first 40': }
+notify { 'first 41': }
+notify { 'first 42': }
+notify { 'first 43': }
+notify { 'first 44': }
+notify { 'first 45': }
+notify { 'first 46': }
+notify { 'first 47': }
+notify { 'first 48': }
+notify { 'first 49': }
+notify { 'first 50': }
+notify { 'first 51': }
+notify { 'first 52': }
+notify { 'first 53': }
+notify { 'first 54': }
+notify { 'first 55': }
+notify { 'first 56': }
+notify { 'first 57': }
+notify { 'first 58': }
+notify { 'first 59': }
+notify { 'first 60': }
+notify { 'first 61': }
+notify { 'first 62': }
+notify { 'first 63': }
+notify { 'first 64': }
+notify { 'first 65': }
+notify { 'first 66': }
+notify { 'first 67': }
+notify { 'first 68': }
+notify { 'first 69': }
+notify { 'first 70': }
+notify { 'first 71': }
+notify { 'first 72': }
+notify { 'first 73': }
+notify { 'first 74': }
+notify { 'first 75': }
+notify { 'first 76': }
+notify { 'first 77': }
+notify { 'first 78': }
+notify { 'first 79': }
+notify { 'first 80': }
+notify { 'first 81': }
+notify { 'first 82': }
+notify { 'first 83': }
+notify { 'first 84': }
+notify { 'first 85': }
+notify { 'first 86': }
+notify { 'first 87': }
+notify { 'first 88': }
+notify { 'first 89': }
+notify { 'first 90': }
+notify { 'first 91': }
+notify { 'first 92': }
+notify { 'first 93': }
+notify { 'first 94': }
+notify { 'first 95': }
+notify { 'first 96': }
+notify { 'first 97': }
+notify { 'first 98': }
+notify { 'first 99': }
+notify { 'first 100': }
+notify { 'first 101': }
+notify { 'first 102': }
+notify { 'first 103': }
+notify { 'first 104': }
+notify { 'first 105': }
+notify { 'first 106': }
+notify { 'first 107': }
+notify { 'first 108': }
+notify { 'first 109': }
+notify { 'first 110': }
+notify { 'first 111': }
+notify { 'first 112': }
+notify { 'first 113': }
+notify { 'first 114': }
+notify { 'first 115': }
+notify { 'first 116': }
+notify { 'first 117': }
+notify { 'first 118': }
+notify { 'first 119': }
+notify { 'first 120': }
+notify { 'first 121': }
+notify { 'first 122': }
+notify { 'first 123': }
+notify { 'first 124': }
+notify { 'first 125': }
+notify { 'first 126': }
+notify { 'first 127': }
+notify { 'first 128': }
+notify { 'first 129': }
+notify { 'first 130': }
+notify { 'first 131': }
+notify { 'first 132': }
+notify { 'first 133': }
+notify { 'first 134': }
+notify { 'first 135': }
+notify { 'first 136': }
+notify { 'first 137': }
+notify { 'first 138': }
+notify { 'first 139': }
+notify { 'first 140': }
+notify { 'first 141': }
+notify { 'first 142': }
+notify { 'first 143': }
+notify { 'first 144': }
+notify { 'first 145': }
+notify { 'first 146': }
+notify { 'first 147': }
+notify { 'first 148': }
+notify { 'first 149': }
+notify { 'first 150': }
+notify { 'first 151': }
+notify { 'first 152': }
+notify { 'first 153': }
+notify { 'first 154': }
+notify { 'first 155': }
+notify { 'first 156': }
+notify { 'first 157': }
+notify { 'first 158': }
+notify { 'first 159': }
+notify { 'first 160': }
+notify { 'first 161': }
+notify { 'first 162': }
+notify { 'first 163': }
+notify { 'first 164': }
+notify { 'first 165': }
+notify { 'first 166': }
+notify { 'first 167': }
+notify { 'first 168': }
+notify { 'first 169': }
+notify { 'first 170': }
+notify { 'first 171': }
+notify { 'first 172': }
+notify { 'first 173': }
+notify { 'first 174': }
+notify { 'first 175': }
+notify { 'first 176': }
+notify { 'first 177': }
+notify { 'first 178': }
+notify { 'first 179': }
+notify { 'first 180': }
+notify { 'first 181': }
+notify { 'first 182': }
+notify { 'first 183': }
+notify { 'first 184': }
+notify { 'first 185': }
+notify { 'first 186': }
+notify { 'first 187': }
+notify { 'first 188': }
+notify { 'first 189': }
+notify { 'first 190': }
+notify { 'first 191': }
+notify { 'first 192': }
+notify { 'first 193': }
+notify { 'first 194': }
+notify { 'first 195': }
+notify { 'first 196': }
+notify { 'first 197': }
+notify { 'first 198': }
+notify { 'first 199': }
+notify { 'first 200': }
+notify { "unclosed":
@@ -0,0 +1 @@
+file { '/tmp/good': }
@@ -0,0 +1 @@
+notify { 'second':
@@ -0,0 +1,3 @@
+define widget::part {
+  notify { "widget ${title}": }
+}
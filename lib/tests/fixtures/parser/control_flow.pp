@@ -0,0 +1,40 @@
+# Control flow, calls, and lambdas
+case $facts['os']['family'] {
+    'RedHat', 'CentOS': { $pkg = 'httpd' }
+    /^Deb/: { $pkg = 'apache2' }
+    default: { fail("unsupported ${facts['os']['family']}") }
+}
+if $x { } elsif $y { notice(1) } elsif $z {} else { }
+unless $a == 1 { notice('a') }
+$v = $x ? { undef => 1, /re/ => 2, default => 3, }
+$sum = [1, 2, 3].reduce |$memo, $value| { $memo + $value }
+$arr.each |String $k, Optional[Integer] $v = undef,| { notice "${k}=${v}" }
+notice($a.map |$x| { $x * 2 }.filter |$y| { $y > 2 })
+$size = $arr.length
+$joined = $arr.join(',')
+with(1, 2) |$a, *$rest| { notice $a, $rest }
+include foo, bar
+require foo
+contain ::foo::bar
+realize User['alice']
+$neg = - $y
+$not = !($a or $b) and $c in [1, 2]
+$splat = [*$arr, *[1]]
+$h = { 'a' => { 'b' => [1, { c => d }] }, }
+$s = "plain ${var} and ${h['a']['b'][0]} and ${func(1)} and ${$x + 1} and $simple"
+$doc = @("EOT")
+    text ${x}
+    | EOT
+$r = $str =~ /^a(b)c$/
+$m = $str !~ /x/
+$shift = 1 << 2 >> 1
+$cmp = 1 < 2 and 2 <= 3 and 4 > 3 and 4 >= 4 and 1 != 2 and 1 == 1
+$chained = $a = $b = 3
+$f = 1.5e3 + 0x1f - 017 % 3 * 2 / 1
+$t = Hash[String, Array[Integer, 1]]
+$n = $numbers[1, 2][0]
+$e = []
+$g = {}
+$q = (1 + 2) * 3
+$arr
+[1, 2].each |$x| { }
@@ -0,0 +1,33 @@
+# Bodies of these definitions are deferred
+class deferred::simple {
+    notice('}')
+    $hash = { 'a' => { 'b' => [1, 2] } }
+    $result = $hash.map |$key, $value| { "${key} => {${value}}" }
+}
+class deferred::declares(String $x = '{') inherits deferred::simple {
+    class { 'deferred::simple': }
+    file { '/tmp/x': content => @("END") }
+      {${x}
+      | END
+}
+define deferred::type($value = { 'a' => 1 }) {
+    if $value { notice($value) } else { notice('{') }
+}
+node 'deferred.example.com' {
+    include deferred::simple
+}
+class deferred::empty {}
+
+# Bodies of these definitions are parsed with the rest of the manifest
+class deferred::outer {
+    class inner { }
+    define inner_type { }
+}
+node default {
+    class nested { }
+}
+class deferred::heredoc($text = @(END)) {
+  text
+  | END
+    notice($text)
+}
@@ -0,0 +1,23 @@
+# Classes, defined types, nodes, and collectors
+class base { }
+class app::config(
+    String $path = '/etc/app',
+    Integer $port,
+    Optional[Hash] $extra = undef,
+) inherits base {
+    file { $path: ensure => directory }
+}
+class empty() {}
+define app::vhost($docroot, $port = 80,) {
+    notify { "vhost ${title}": }
+}
+define nothing {}
+node 'www1.example.com', www2.example.com, /^db\d+$/, {
+    class { 'app::config': port => 8080 }
+}
+node default {}
+User <| |>
+User <| title == 'alice' |>
+User <| groups == wheel and uid != 0 or shell == $shell or managehome == true |>
+Host <<| tag == 'exported' |>>
+User <| title == 'a' |> -> Package <| |>
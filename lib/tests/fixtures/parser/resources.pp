@@ -0,0 +1,25 @@
+# Resource, defaults, override, and relationship statements
+file { '/tmp/a':
+    ensure => file,
+    mode   => '0644';
+  '/tmp/b':
+    ensure => directory,
+    ;
+}
+file { ['/tmp/c', '/tmp/d']: }
+file { "/tmp/${name}": content => template('x/y.erb'), }
+@user { 'alice': uid => 1000, groups +> ['wheel'] }
+@@host { $::fqdn: ip => $::ipaddress, tag => [exported] }
+class { 'apache': version => '2.4' }
+Exec { path => ['/bin', '/usr/bin'], require => Package['y'], }
+Exec['x'] { refreshonly => true }
+$resource { owner => root }
+Resource[File, '/tmp/e'] { group => wheel }
+Package['a'] -> File['/tmp/a'] ~> Service['b']
+package { 'c': } -> service { 'd': ensure => running }
+notify { 'attributes':
+    and => 1, case => 2, class => 3, default => 4, define => 5, else => 6, elsif => 7, if => 8, in => 9,
+    inherits => 10, node => 11, or => 12, undef => 13, unless => 14, type => 15, attr => 16, function => 17,
+    private => 18, include => 19,
+}
+File { mode => '0644' } File['/tmp/a'] { owner => root }; notice('done')
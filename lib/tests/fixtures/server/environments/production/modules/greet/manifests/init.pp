@@ -0,0 +1,3 @@
+class greet {
+    file { "/tmp/${::fqdn}": }
+}
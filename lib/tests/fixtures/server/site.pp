@@ -0,0 +1 @@
+include greet
@@ -0,0 +1,157 @@
+#include <catch.hpp>
+#include <puppet/lexer/static_lexer.hpp>
+#include <puppet/lexer/lexer.hpp>
+#include <puppet/lexer/dfa_lexer.hpp>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <boost/format.hpp>
+
+using namespace std;
+using namespace puppet::lexer;
+
+struct token_description_visitor : boost::static_visitor<string>
+{
+    result_type operator()(number_token const& token) const
+    {
+        ostringstream os;
+        os << "number " << token << " @" << token.position().offset() << ":" << token.position().line();
+        return os.str();
+    }
+
+    result_type operator()(string_token<lexer_string_iterator> const& token) const
+    {
+        return (boost::format("string '%1%' @%2%:%3% escapes '%4%' quote %5% interpolated %6% format '%7%' margin %8% remove_break %9%") %
+            string(token.begin(), token.end()) %
+            token.position().offset() %
+            token.position().line() %
+            token.escapes() %
+            static_cast<int>(token.quote()) %
+            token.interpolated() %
+            token.format() %
+            token.margin() %
+            token.remove_break()).str();
+    }
+
+    result_type operator()(boost::iterator_range<lexer_string_iterator> const& range) const
+    {
+        return (boost::format("'%1%' @%2%:%3%") %
+            string(range.begin(), range.end()) %
+            range.begin().position().offset() %
+            range.begin().position().line()).str();
+    }
+};
+
+template <typename Lexer>
+vector<string> lex(string const& input)
+{
+    vector<string> tokens;
+    try {
+        auto input_begin = lex_begin(input);
+        auto input_end = lex_end(input);
+
+        Lexer lexer;
+        for (auto token = lexer.begin(input_begin, input_end), end = lexer.end(); token != end; ++token) {
+            // The static lexer may end with an invalid token; the parser treats this as the end of input
+            if (!token_is_valid(*token)) {
+                break;
+            }
+            ostringstream ss;
+            ss << static_cast<token_id>(token->id()) << ": " << boost::apply_visitor(token_description_visitor(), token->value());
+            tokens.push_back(ss.str());
+        }
+    } catch (lexer_exception<lexer_string_iterator> const& ex) {
+        tokens.push_back((boost::format("error @%1%:%2%: %3%") % ex.location().position().offset() % ex.location().position().line() % ex.what()).str());
+    }
+    return tokens;
+}
+
+void require_same_tokens(string const& input)
+{
+    CAPTURE(input);
+
+    auto expected = lex<string_static_lexer>(input);
+    auto actual = lex<string_dfa_lexer>(input);
+
+    for (size_t i = 0; i < min(expected.size(), actual.size()); ++i) {
+        CAPTURE(i);
+        REQUIRE(actual[i] == expected[i]);
+    }
+    REQUIRE(actual.size() == expected.size());
+}
+
+SCENARIO("DFA lexer produces the same tokens as the static lexer for fixtures")
+{
+    for (auto fixture : {
+        "double_quoted_strings.pp",
+        "heredocs.pp",
+        "keywords.pp",
+        "numbers.pp",
+        "single_quoted_strings.pp",
+        "statement_calls.pp",
+        "symbolic_tokens.pp"
+    }) {
+        CAPTURE(fixture);
+
+        ifstream file(string(FIXTURES_DIR "lexer/") + fixture);
+        REQUIRE(file);
+        ostringstream contents;
+        contents << file.rdbuf();
+
+        require_same_tokens(contents.str());
+    }
+}
+
+SCENARIO("DFA lexer produces the same tokens as the static lexer for ambiguous input")
+{
+    for (auto input : {
+        "",
+        "   ",
+        "$x = [1, 2]\n$y = $x [0]",
+        "$a = $b / $c / $d",
+        "$a = 1 / 2 /* comment */ / 3",
+        "$a = foo /* one */ /* two */ / 2",
+        "$a = 'str' / 2",
+        "$a = /regex/ / 2",
+        "if $a =~ /^foo\\/bar$/ { }",
+        "$a = // /",
+        "$a = /* unterminated",
+        "# comment only",
+        "$::foo::bar $foo:: $ $::",
+        "Foo::Bar ::Foo::Bar ::foo::bar foo::Bar Foo::bar",
+        "foo-bar _foo foo- foo_ -foo truex true false",
+        "include require contain includes in inherits",
+        "a <<| b |>> c <| d |> e -> f ~> g <- h <~ i",
+        "a += b -= c == d != e =~ f !~ g >= h <= i => j +> k << l >> m @@ n",
+        "{ } ( ) [ ] = > < + - / * % ! . | @ : , ; ? ~ ^ &",
+        "\"unclosed 'unclosed",
+        "\"escaped \\\" quote\" 'escaped \\' quote'",
+        "\"trailing backslash\\",
+        "\"line\\\ncontinuation\"",
+        "1 1.5 1e5 1e-5 1.5e-5 0x1F 017 0 1.0e",
+        "1.5.6 1.x 1e5x 1-2",
+        "$a = @(END)\nfoo\nEND\n$b = 1 / 2",
+        "$a = @(END) / 2\nfoo\nEND\n",
+        "foo(@(A), @(B))\na\nA\nb\nB\n",
+        "@(\"END\":json/t)\n  a\\tb\n  |-END\n",
+        "@ @@ @(",
+        "\t\r\n\f\v[1]",
+    }) {
+        require_same_tokens(input);
+    }
+
+    for (auto input : {
+        "0x",
+        "08",
+        "123abc",
+        "123.456D0H",
+        "123.0e-",
+        "123bad.2bad2e-bad",
+        "99999999999999999999",
+        "1e100000",
+        "@(END)\nfoo\n",
+        "@(END/x)\nfoo\nEND\n",
+    }) {
+        require_same_tokens(input);
+    }
+}
@@ -2,11 +2,15 @@
 #include <puppet/lexer/static_lexer.hpp>
 #include <puppet/lexer/lexer.hpp>
 #include <limits>
+#include <fstream>
 #include <boost/format.hpp>
+#include <boost/filesystem.hpp>
 
 using namespace std;
 using namespace puppet::lexer;
 
+namespace fs = boost::filesystem;
+
 struct token_value_visitor : boost::static_visitor<string>
 {
     result_type operator()(number_token const& token) const
@@ -410,3 +414,55 @@ SCENARIO("lexing numbers")
     lex_bad_string("123bad.2bad2e-bad", 0, 1, "'123bad.2bad2e-bad' is not a valid number.");
     lex_bad_string("1e100000", 0, 1, (boost::format("'1e100000' is not in the range of %1% to %2%.") % numeric_limits<long double>::min() % numeric_limits<long double>::max()).str());
 }
+
+SCENARIO("lexing a source buffer")
+{
+    source_buffer input(FIXTURES_DIR "lexer/statement_calls.pp");
+    REQUIRE(input.size() > 0);
+
+    auto input_begin = lex_begin(input);
+    auto input_end = lex_end(input);
+
+    string_static_lexer lexer;
+    auto token = lexer.begin(input_begin, input_end);
+    auto end = lexer.end();
+    require_token(token, end, token_id::statement_call, "require");
+    require_token(token, end, token_id::statement_call, "realize");
+
+    string text;
+    size_t column;
+    tie(text, column) = get_text_and_column(input, 61);
+    REQUIRE(text == "realize");
+    REQUIRE(column == 3);
+
+    REQUIRE(input.lines() == 14);
+    tie(text, column) = get_text_and_column(input, input.size() - 1);
+    REQUIRE(text == "import");
+    REQUIRE(column == 7);
+    tie(text, column) = get_text_and_column(input, input.size());
+    REQUIRE(text == "");
+    REQUIRE(column == 1);
+
+    REQUIRE_THROWS_AS(source_buffer(FIXTURES_DIR "lexer/does_not_exist.pp"), source_exception const&);
+}
+
+SCENARIO("copying a source buffer")
+{
+    auto path = (fs::temp_directory_path() / fs::unique_path()).string();
+    ofstream(path) << "notice('first')\nnotice('second')\n";
+
+    source_buffer mapped(path);
+    source_buffer copied(path, true);
+    REQUIRE(string(copied.data(), copied.size()) == string(mapped.data(), mapped.size()));
+    REQUIRE(copied.lines() == mapped.lines());
+
+    WHEN("the file is rewritten in place") {
+        ofstream(path, ios::trunc) << "notice('third')\n";
+        THEN("the copy should keep the original contents") {
+            REQUIRE(string(copied.data(), copied.size()) == "notice('first')\nnotice('second')\n");
+            REQUIRE(copied.lines() == 3);
+        }
+    }
+
+    fs::remove(path);
+}
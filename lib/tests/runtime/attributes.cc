@@ -0,0 +1,60 @@
+#include <catch.hpp>
+#include <puppet/runtime/catalog.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace puppet;
+using namespace puppet::runtime;
+
+SCENARIO("storing resource attributes")
+{
+    WHEN("attributes are set out of order") {
+        attributes attrs;
+        attrs.set(symbol("owner"), string("root"));
+        attrs.set(symbol("ensure"), string("present"));
+        attrs.set(symbol("mode"), string("0644"));
+        attrs.set(symbol("owner"), string("nobody"));
+        THEN("they should be enumerated by name with the last value set") {
+            vector<string> names;
+            attrs.each([&](symbol const& name, values::value const& value) {
+                names.push_back(name.str());
+                return true;
+            });
+            REQUIRE((names == vector<string>{ "ensure", "mode", "owner" }));
+            REQUIRE(attrs.get(symbol("owner")));
+            REQUIRE(*values::as<string>(*attrs.get(symbol("owner"))) == "nobody");
+            REQUIRE_FALSE(attrs.get(symbol("group")));
+        }
+    }
+    WHEN("attributes inherit from a parent") {
+        auto parent = make_shared<attributes>();
+        parent->set(symbol("ensure"), string("present"));
+        parent->set(symbol("owner"), string("root"));
+        parent->set(symbol("require"), values::array{ string("first") });
+        attributes attrs(parent);
+        attrs.set(symbol("owner"), values::undef());
+        attrs.append(symbol("require"), string("second"));
+        THEN("undefined values should hide the parent's values") {
+            REQUIRE(attrs.get(symbol("ensure")));
+            REQUIRE_FALSE(attrs.get(symbol("owner")));
+            REQUIRE(attrs.get(symbol("owner"), false) == nullptr);
+        }
+        THEN("appending should not change the parent's value") {
+            REQUIRE(values::as<values::array>(*parent->get(symbol("require")))->size() == 1);
+            REQUIRE(values::as<values::array>(*attrs.get(symbol("require")))->size() == 2);
+        }
+        THEN("flattening should copy the inherited values and release the parent") {
+            attrs.flatten();
+            parent->set(symbol("group"), string("wheel"));
+            REQUIRE(*values::as<string>(*attrs.get(symbol("ensure"), false)) == "present");
+            REQUIRE_FALSE(attrs.get(symbol("owner")));
+            REQUIRE_FALSE(attrs.get(symbol("group")));
+            REQUIRE(values::as<values::array>(*attrs.get(symbol("require")))->size() == 2);
+            size_t count = 0;
+            attrs.each([&](symbol const&, values::value const&) { ++count; return true; });
+            REQUIRE(count == 2);
+        }
+    }
+}
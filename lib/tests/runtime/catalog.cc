@@ -0,0 +1,294 @@
+#include <catch.hpp>
+#include <puppet/runtime/catalog.hpp>
+#include <puppet/runtime/expression_evaluator.hpp>
+#include <puppet/compiler/exceptions.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace puppet;
+using namespace puppet::runtime;
+
+SCENARIO("relating resources")
+{
+    catalog catalog;
+    auto path = make_shared<string>("test.pp");
+    auto& first = catalog.add_resource(types::resource("File", "first"), path, 1);
+    auto& second = catalog.add_resource(types::resource("File", "second"), path, 2);
+
+    WHEN("the same relationship is added more than once") {
+        REQUIRE(first.relate(relationship::before, second));
+        REQUIRE_FALSE(first.relate(relationship::before, second));
+        REQUIRE(first.relate(relationship::notify, second));
+        THEN("it should only be stored once") {
+            size_t count = 0;
+            first.each_relationship([&](relationship, resource const& target) {
+                REQUIRE(&target == &second);
+                ++count;
+                return true;
+            });
+            REQUIRE(count == 2);
+        }
+    }
+    WHEN("relationships come from both operators and metaparameters") {
+        first.relate(relationship::before, second);
+        second.attributes().set(symbol("require"), values::array{ types::resource("File", "first") });
+        first.attributes().set(symbol("before"), values::array{ types::resource("File", "second") });
+        catalog.finalize();
+        THEN("the graph should have a single edge between the resources") {
+            auto const& graph = catalog.graph();
+            REQUIRE(boost::num_edges(graph) == 1);
+            auto edge = *boost::edges(graph).first;
+            REQUIRE(graph[boost::source(edge, graph)] == &first);
+            REQUIRE(graph[boost::target(edge, graph)] == &second);
+        }
+    }
+    WHEN("the catalog is written") {
+        auto& third = catalog.add_resource(types::resource("Notify", "third"), path, 3);
+        first.relate(relationship::before, second);
+        third.attributes().set(symbol("require"), values::array{ types::resource("File", "second") });
+        catalog.finalize();
+        THEN("relationships should be edges and only metaparameters should be parameters") {
+            ostringstream json;
+            catalog.write(json, "node", "production");
+            REQUIRE(json.str() ==
+                "{\n"
+                "  \"name\": \"node\",\n"
+                "  \"environment\": \"production\",\n"
+                "  \"resources\": [\n"
+                "    {\n"
+                "      \"type\": \"File\",\n"
+                "      \"title\": \"first\",\n"
+                "      \"file\": \"test.pp\",\n"
+                "      \"line\": 1,\n"
+                "      \"exported\": false\n"
+                "    },\n"
+                "    {\n"
+                "      \"type\": \"File\",\n"
+                "      \"title\": \"second\",\n"
+                "      \"file\": \"test.pp\",\n"
+                "      \"line\": 2,\n"
+                "      \"exported\": false\n"
+                "    },\n"
+                "    {\n"
+                "      \"type\": \"Notify\",\n"
+                "      \"title\": \"third\",\n"
+                "      \"file\": \"test.pp\",\n"
+                "      \"line\": 3,\n"
+                "      \"exported\": false,\n"
+                "      \"parameters\": {\n"
+                "        \"require\": [\"File[second]\"]\n"
+                "      }\n"
+                "    }\n"
+                "  ],\n"
+                "  \"edges\": [\n"
+                "    { \"source\": \"File[first]\", \"target\": \"File[second]\" },\n"
+                "    { \"source\": \"File[second]\", \"target\": \"Notify[third]\" }\n"
+                "  ],\n"
+                "  \"classes\": []\n"
+                "}\n"
+            );
+        }
+    }
+    WHEN("many resources form the same relationships in both directions") {
+        vector<resource*> files;
+        for (size_t i = 0; i < 100; ++i) {
+            files.push_back(&catalog.add_resource(types::resource("File", "file" + to_string(i)), path, 3 + i));
+        }
+        for (auto file : files) {
+            first.relate(relationship::before, *file);
+            file->relate(relationship::require, first);
+        }
+        catalog.finalize();
+        THEN("the graph should have one edge per pair of resources") {
+            REQUIRE(boost::num_edges(catalog.graph()) == files.size());
+        }
+    }
+}
+
+static string finalize(catalog& catalog)
+{
+    // Returns the error message if finalizing the catalog fails
+    try {
+        catalog.finalize();
+    } catch (compiler::compilation_exception const& ex) {
+        return ex.what();
+    }
+    return string();
+}
+
+SCENARIO("detecting dependency cycles")
+{
+    catalog catalog;
+    auto path = make_shared<string>("test.pp");
+    vector<resource*> files;
+    auto add = [&](string const& title) {
+        files.push_back(&catalog.add_resource(types::resource("File", title), path, files.size() + 1));
+        return files.back();
+    };
+
+    WHEN("the resources form a chain") {
+        auto a = add("a");
+        auto b = add("b");
+        auto c = add("c");
+        a->relate(relationship::before, *b);
+        c->relate(relationship::require, *b);
+        THEN("no cycle should be found") {
+            REQUIRE(finalize(catalog) == "");
+        }
+    }
+    WHEN("two resources depend on each other") {
+        auto a = add("a");
+        auto b = add("b");
+        a->relate(relationship::before, *b);
+        a->relate(relationship::require, *b);
+        THEN("the cycle should be reported") {
+            REQUIRE(finalize(catalog) ==
+                "found 1 resource dependency cycle:\n"
+                "  1. File[a] declared at test.pp:1 => File[b] declared at test.pp:2 => File[a]");
+        }
+    }
+    WHEN("a cycle is part of a larger component") {
+        // The longer cycle is found first by following the first edges, but the shortest path back to the first resource should be reported
+        auto root = add("root");
+        auto a = add("a");
+        auto b = add("b");
+        auto c = add("c");
+        auto d = add("d");
+        root->relate(relationship::before, *a);
+        a->relate(relationship::before, *b);
+        b->relate(relationship::before, *c);
+        c->relate(relationship::before, *root);
+        root->relate(relationship::before, *d);
+        d->relate(relationship::before, *root);
+        THEN("only the shortest cycle through the first resource should be reported") {
+            REQUIRE(finalize(catalog) ==
+                "found 1 resource dependency cycle:\n"
+                "  1. File[root] declared at test.pp:1 => File[d] declared at test.pp:5 => File[root]");
+        }
+    }
+    WHEN("there are separate cycles") {
+        auto a = add("a");
+        auto b = add("b");
+        auto c = add("c");
+        auto d = add("d");
+        auto e = add("e");
+        a->relate(relationship::before, *c);
+        c->relate(relationship::before, *a);
+        b->relate(relationship::before, *a);
+        d->relate(relationship::notify, *e);
+        e->relate(relationship::subscribe, *b);
+        e->relate(relationship::before, *d);
+        THEN("one cycle should be reported for each") {
+            REQUIRE(finalize(catalog) ==
+                "found 2 resource dependency cycles:\n"
+                "  1. File[a] declared at test.pp:1 => File[c] declared at test.pp:3 => File[a]\n"
+                "  2. File[d] declared at test.pp:4 => File[e] declared at test.pp:5 => File[d]");
+        }
+    }
+    WHEN("a large component has exponentially many cycles") {
+        // Each resource comes before the next two, wrapping around; enumerating every cycle would never finish
+        size_t const count = 20000;
+        for (size_t i = 0; i < count; ++i) {
+            add("r" + to_string(i));
+        }
+        for (size_t i = 0; i < count; ++i) {
+            files[i]->relate(relationship::before, *files[(i + 1) % count]);
+            files[i]->relate(relationship::before, *files[(i + 2) % count]);
+        }
+        THEN("the shortest cycle should be reported") {
+            auto message = finalize(catalog);
+            REQUIRE(message.find("found 1 resource dependency cycle:\n  1. File[r0] declared at test.pp:1 => File[r2] declared at test.pp:3 => ") == 0);
+            string end = "File[r19998] declared at test.pp:19999 => File[r0]";
+            REQUIRE(message.size() > end.size());
+            REQUIRE(message.compare(message.size() - end.size(), end.size(), end) == 0);
+        }
+    }
+}
+
+static void require_resources(catalog& catalog, vector<resource*> const& resources)
+{
+    for (auto resource : resources) {
+        REQUIRE(catalog.find_resource(resource->type()) == resource);
+    }
+}
+
+SCENARIO("finding resources")
+{
+    auto path = make_shared<string>("test.pp");
+
+    WHEN("the catalog is empty") {
+        catalog catalog;
+        THEN("no resource should be found") {
+            REQUIRE_FALSE(catalog.find_resource(types::resource("File", "missing")));
+        }
+    }
+    WHEN("the index grows more than once") {
+        catalog catalog;
+        vector<resource*> resources;
+        for (size_t i = 0; i < 200; ++i) {
+            resources.push_back(&catalog.add_resource(types::resource("File", "file" + to_string(i)), path, i + 1));
+            if (resources.size() == 65 || resources.size() == 129) {
+                require_resources(catalog, resources);
+            }
+        }
+        THEN("every resource should still be found") {
+            require_resources(catalog, resources);
+            REQUIRE_FALSE(catalog.find_resource(types::resource("File", "file200")));
+        }
+    }
+    WHEN("resources have the same title but different types") {
+        catalog catalog;
+        auto& file = catalog.add_resource(types::resource("File", "same"), path, 1);
+        auto& notify = catalog.add_resource(types::resource("Notify", "same"), path, 2);
+        THEN("each should be found by its type") {
+            REQUIRE(catalog.find_resource(types::resource("File", "same")) == &file);
+            REQUIRE(catalog.find_resource(types::resource("Notify", "same")) == &notify);
+            REQUIRE_FALSE(catalog.find_resource(types::resource("Package", "same")));
+        }
+    }
+    WHEN("a resource is declared twice") {
+        catalog catalog;
+        catalog.add_resource(types::resource("File", "first"), path, 1);
+        catalog.add_resource(types::resource("File", "second"), path, 2);
+        THEN("the second declaration should fail") {
+            string message;
+            try {
+                catalog.add_resource(types::resource("File", "first"), path, 3);
+            } catch (evaluation_exception const& ex) {
+                message = ex.what();
+            }
+            REQUIRE(message == "resource File[first] was previously declared at test.pp:1.");
+        }
+    }
+    WHEN("resources collide in the index") {
+        // The index finds a resource's slot from the low bits of its boost::hash value and starts with 64 slots, so titles
+        // that agree in the low 8 bits of their hash collide until the index has grown past 256 slots
+        auto slot_of = [](string const& title) {
+            return boost::hash<types::resource>()(types::resource("File", title)) & 0xFF;
+        };
+        auto slot = slot_of("file0");
+        vector<string> titles;
+        for (size_t i = 0; titles.size() < 41; ++i) {
+            auto title = "file" + to_string(i);
+            if (slot_of(title) == slot) {
+                titles.emplace_back(rvalue_cast(title));
+            }
+        }
+        auto missing = titles.back();
+        titles.pop_back();
+
+        catalog catalog;
+        vector<resource*> resources;
+        for (size_t i = 0; i < titles.size(); ++i) {
+            resources.push_back(&catalog.add_resource(types::resource("File", titles[i]), path, i + 1));
+        }
+        THEN("resources should be told apart by their titles") {
+            require_resources(catalog, resources);
+            REQUIRE_FALSE(catalog.find_resource(types::resource("File", missing)));
+            REQUIRE_THROWS_AS(catalog.add_resource(types::resource("File", titles[20]), path, 41), evaluation_exception const&);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#include <catch.hpp>
+#include "../test_logger.hpp"
+#include <puppet/runtime/constant_folder.hpp>
+#include <puppet/runtime/expression_evaluator.hpp>
+#include <puppet/compiler/context.hpp>
+#include <puppet/compiler/environment.hpp>
+#include <puppet/compiler/node.hpp>
+#include <puppet/ast/constant.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+using namespace puppet;
+using namespace puppet::runtime;
+
+namespace fs = boost::filesystem;
+
+static string const manifest_source =
+    "1 + 2 * 3\n"
+    "[1, 'two', [3]]\n"
+    "{ 'a' => 1, b => [2] }\n"
+    "Integer[1, 10]\n"
+    "\"a${1 + 2}b\"\n"
+    "1 / 0\n"
+    "'abc' =~ /b/\n"
+    "1 in [1, 2]\n"
+    "$x = 1\n"
+    "$x + 1\n"
+    "\"\\q\"\n";
+
+static string to_json(values::value const& value)
+{
+    ostringstream ss;
+    values::write_json(ss, value);
+    return ss.str();
+}
+
+static string to_json(ast::expression const& expression)
+{
+    REQUIRE(expression.constant());
+    return to_json(expression.constant()->value());
+}
+
+SCENARIO("folding constant expressions")
+{
+    auto path = fs::temp_directory_path() / fs::unique_path("%%%%-%%%%.pp");
+    {
+        ofstream file(path.string());
+        file << manifest_source;
+    }
+
+    test_logger logger;
+    compiler::environment environment("production", fs::temp_directory_path().string());
+    compiler::node node("test", environment, nullptr);
+    auto context = make_shared<compiler::context>(logger, make_shared<string>(path.string()), node);
+    constant_folder::fold(context);
+
+    auto& body = *context->tree().body();
+    REQUIRE(body.size() == 11u);
+
+    WHEN("expressions have only constant operands") {
+        THEN("they should be folded into constants") {
+            REQUIRE(to_json(body[0]) == "7");
+            REQUIRE(to_json(body[1]) == "[1,\"two\",[3]]");
+            REQUIRE(body[2].constant());
+            auto hash = values::as<values::hash>(body[2].constant()->value());
+            REQUIRE(hash);
+            REQUIRE(hash->size() == 2u);
+            auto a = hash->find(values::value(string("a")));
+            REQUIRE(a != hash->end());
+            REQUIRE(to_json(a->second) == "1");
+            auto b = hash->find(values::value(string("b")));
+            REQUIRE(b != hash->end());
+            REQUIRE(to_json(b->second) == "[2]");
+            REQUIRE(to_json(body[3]) == "\"Integer[1, 10]\"");
+            REQUIRE(values::as<values::type>(body[3].constant()->value()));
+            REQUIRE(to_json(body[4]) == "\"a3b\"");
+        }
+    }
+    WHEN("a constant expression fails to evaluate") {
+        THEN("it should not be folded") {
+            REQUIRE_FALSE(body[5].constant());
+        }
+        THEN("the failure should be raised when it is evaluated") {
+            runtime::context evaluation_context;
+            expression_evaluator evaluator{ context, evaluation_context };
+            string message;
+            size_t offset = 0;
+            try {
+                evaluator.evaluate(body[5]);
+            } catch (evaluation_exception const& ex) {
+                message = ex.what();
+                offset = ex.position().offset();
+            }
+            REQUIRE(message == "cannot divide by zero.");
+            REQUIRE(offset == manifest_source.find("1 / 0") + 4);
+        }
+    }
+    WHEN("expressions have side effects or depend on scope") {
+        THEN("they should not be folded") {
+            REQUIRE_FALSE(body[6].constant());
+            REQUIRE_FALSE(body[7].constant());
+            REQUIRE_FALSE(body[8].constant());
+            REQUIRE_FALSE(body[9].constant());
+        }
+    }
+    WHEN("a string has compilation warnings") {
+        THEN("it should not be folded so the warnings are reported when evaluated") {
+            REQUIRE_FALSE(body[10].constant());
+        }
+    }
+
+    fs::remove(path);
+}
@@ -0,0 +1,77 @@
+#include <catch.hpp>
+#include <puppet/compiler/parser.hpp>
+#include <puppet/runtime/vm/program.hpp>
+#include <vector>
+
+using namespace std;
+using namespace puppet;
+using namespace puppet::runtime::vm;
+
+static vector<opcode> opcodes(program const& program)
+{
+    vector<opcode> codes;
+    for (auto const& instruction : program.instructions()) {
+        codes.push_back(instruction.code);
+    }
+    return codes;
+}
+
+SCENARIO("compiling expressions to bytecode")
+{
+    WHEN("an expression uses logical operators") {
+        auto tree = compiler::parser::parse("$a and $b or $c");
+        REQUIRE(tree.body());
+        program compiled(*tree.body());
+        THEN("each operator should branch past its right operand") {
+            REQUIRE(opcodes(compiled) == (vector<opcode>{ opcode::load, opcode::branch_and, opcode::load, opcode::binary, opcode::branch_or, opcode::load, opcode::binary }));
+            REQUIRE(compiled.instructions()[1].operand == 4u);
+            REQUIRE(compiled.instructions()[4].operand == 7u);
+            REQUIRE(compiled.variables().size() == 3u);
+            REQUIRE(compiled.binary_operations()[0].function);
+        }
+    }
+    WHEN("an expression is not supported by the bytecode compiler") {
+        auto tree = compiler::parser::parse("[1, *$a] + 2");
+        REQUIRE(tree.body());
+        program compiled(*tree.body());
+        THEN("it should be evaluated by the tree walker") {
+            REQUIRE(opcodes(compiled) == (vector<opcode>{ opcode::evaluate, opcode::push, opcode::binary }));
+            REQUIRE(compiled.expressions().size() == 1u);
+            REQUIRE(compiled.expressions()[0] == &tree.body()->front().primary());
+        }
+    }
+    WHEN("a block has an if expression and an unproductive expression that is not last") {
+        auto tree = compiler::parser::parse("if $a { 1 } else { 2 }\n$b\n$c");
+        REQUIRE(tree.body());
+        program compiled(*tree.body());
+        THEN("the if expression should branch within a match scope and the unproductive expression should raise an error") {
+            REQUIRE(opcodes(compiled) == (vector<opcode>{
+                opcode::enter_match_scope, opcode::load, opcode::branch_false, opcode::push, opcode::jump, opcode::push, opcode::leave_match_scope,
+                opcode::pop, opcode::unproductive, opcode::load,
+                opcode::pop, opcode::load
+            }));
+            REQUIRE(compiled.instructions()[2].operand == 5u);
+            REQUIRE(compiled.instructions()[4].operand == 6u);
+            REQUIRE(compiled.stack_size() == 1u);
+        }
+    }
+}
+
+SCENARIO("compiling lambdas to bytecode")
+{
+    auto tree = compiler::parser::parse("with(1) |$x| { $y = $x + 1\n$y + $z }");
+    REQUIRE(tree.body());
+    auto& call = boost::get<ast::function_call_expression>(boost::get<ast::control_flow_expression>(tree.body()->front().primary()));
+    REQUIRE(call.lambda());
+    program compiled(*call.lambda());
+    THEN("parameters and assigned variables should be bound to slots") {
+        REQUIRE(compiled.slots().size() == 2u);
+        REQUIRE(compiled.slots()[0] == symbol("x"));
+        REQUIRE(compiled.slots()[1] == symbol("y"));
+        REQUIRE(opcodes(compiled) == (vector<opcode>{
+            opcode::load_slot, opcode::push, opcode::binary, opcode::assign_slot,
+            opcode::pop, opcode::load_slot, opcode::load, opcode::binary
+        }));
+        REQUIRE(compiled.variables()[1].slot == 1u);
+    }
+}
@@ -0,0 +1,38 @@
+#include <catch.hpp>
+#include <puppet/runtime/values/value.hpp>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+
+using namespace std;
+using namespace puppet;
+using namespace puppet::runtime;
+
+static string to_json(values::value const& value)
+{
+    ostringstream ss;
+    values::write_json(ss, value);
+    return ss.str();
+}
+
+SCENARIO("writing floating point values as JSON")
+{
+    WHEN("the value is finite") {
+        THEN("it should read back as the same value") {
+            long double third = 1.0L / 3;
+            REQUIRE(strtold(to_json(third).c_str(), nullptr) == third);
+            REQUIRE(to_json(0.1L) == "0.1");
+            REQUIRE(to_json(1e300L) == "1e+300");
+        }
+        THEN("integral values should still be written as floats") {
+            REQUIRE(to_json(2.0L) == "2.0");
+        }
+    }
+    WHEN("the value is not finite") {
+        THEN("it should be written as a string") {
+            REQUIRE(to_json(numeric_limits<long double>::infinity()) == "\"inf\"");
+            REQUIRE(to_json(-numeric_limits<long double>::infinity()) == "\"-inf\"");
+            REQUIRE(to_json(numeric_limits<long double>::quiet_NaN()) == "\"nan\"");
+        }
+    }
+}
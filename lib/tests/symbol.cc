@@ -0,0 +1,72 @@
+#include <catch.hpp>
+#include <puppet/symbol.hpp>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace puppet;
+
+SCENARIO("interning symbols")
+{
+    WHEN("two symbols have the same name") {
+        symbol first("foo::bar");
+        symbol second(string("foo::") + "bar");
+        THEN("they should be the same symbol") {
+            REQUIRE(first == second);
+            REQUIRE(&first.str() == &second.str());
+            REQUIRE(first.hash() == second.hash());
+        }
+    }
+    WHEN("two symbols have different names") {
+        symbol first("foo");
+        symbol second("bar");
+        THEN("they should be different symbols ordered by name") {
+            REQUIRE(first != second);
+            REQUIRE(second < first);
+            REQUIRE_FALSE(first < second);
+        }
+    }
+    WHEN("symbols with the same name are created on different threads") {
+        symbol first("foo::baz");
+        string const* other = nullptr;
+        thread([&]() { other = &symbol("foo::baz").str(); }).join();
+        THEN("they should be the same symbol") {
+            REQUIRE(&first.str() == other);
+        }
+    }
+    WHEN("many threads intern the same new names at once") {
+        vector<vector<string const*>> interned(4);
+        vector<thread> threads;
+        for (size_t i = 0; i < interned.size(); ++i) {
+            threads.emplace_back([&, i]() {
+                for (int name = 0; name < 1000; ++name) {
+                    interned[i].push_back(&symbol("concurrent::" + to_string(name)).str());
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        THEN("every thread should get the same symbol for each name") {
+            for (size_t i = 1; i < interned.size(); ++i) {
+                REQUIRE(interned[i] == interned[0]);
+            }
+        }
+    }
+    WHEN("a symbol is default constructed") {
+        symbol empty;
+        THEN("it should be the same as a symbol with an empty name") {
+            REQUIRE(empty.empty());
+            REQUIRE(empty.str().empty());
+            REQUIRE(empty == symbol(""));
+        }
+    }
+    WHEN("a symbol is written to a stream") {
+        ostringstream ss;
+        ss << symbol("$foo");
+        THEN("it should write the name") {
+            REQUIRE(ss.str() == "$foo");
+        }
+    }
+}
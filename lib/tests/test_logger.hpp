@@ -0,0 +1,28 @@
+/**
+ * @file
+ * Declares the logger used by tests that compile manifests.
+ */
+#pragma once
+
+#include <puppet/logging/logger.hpp>
+#include <sstream>
+
+/**
+ * A logger that writes messages to a string stream so that tests do not write to the console.
+ */
+struct test_logger : puppet::logging::stream_logger
+{
+ protected:
+    /**
+     * Gets the stream to log messages to.
+     * @param level The log level of the message.
+     * @return Returns the stream to log messages to.
+     */
+    std::ostream& get_stream(puppet::logging::level level) const override
+    {
+        return _stream;
+    }
+
+ private:
+    mutable std::ostringstream _stream;
+};